@@ -0,0 +1,156 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/extensions/algorithms/columnar_rings.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Star shaped rings of a varying number of points, and some degenerate rings
+template <typename Ring>
+std::vector<Ring> make_rings(std::size_t count, bool closed, bool clockwise)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    typedef typename bg::coordinate_type<Ring>::type coordinate_type;
+
+    std::vector<Ring> result(count);
+    unsigned int state = 12345;
+    for (std::size_t r = 0; r < count; r++)
+    {
+        Ring& ring = result[r];
+        std::size_t const n = 1 + r % 50;
+        double const cx = 1000.0 * (r % 100), cy = 1000.0 * (r / 100);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            double const radius = 100.0 + (state >> 16) % 300;
+            double const angle = (clockwise ? -2.0 : 2.0) * 3.14159265358979 * i / n;
+            ring.push_back(point_type(
+                static_cast<coordinate_type>(cx + radius * std::cos(angle)),
+                static_cast<coordinate_type>(cy + radius * std::sin(angle))));
+        }
+        if (closed)
+        {
+            ring.push_back(ring.front());
+        }
+    }
+    return result;
+}
+
+template <typename T, bool Clockwise, bool Closed>
+void test_rings(std::size_t thread_count)
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::ring<point_type, Clockwise, Closed> ring_type;
+    typedef bg::columnar_rings
+        <
+            T,
+            Clockwise ? bg::clockwise : bg::counterclockwise,
+            Closed ? bg::closed : bg::open
+        > rings_type;
+    typedef typename rings_type::calculation_type ct;
+    typedef bg::model::point<ct, 2, bg::cs::cartesian> centroid_type;
+
+    std::vector<ring_type> const rings
+        = make_rings<ring_type>(2500, Closed, Clockwise);
+
+    // Columnar copy
+    std::vector<T> x, y;
+    std::vector<std::size_t> offsets(1, 0);
+    for (std::size_t r = 0; r < rings.size(); r++)
+    {
+        for (std::size_t i = 0; i < rings[r].size(); i++)
+        {
+            x.push_back(bg::get<0>(rings[r][i]));
+            y.push_back(bg::get<1>(rings[r][i]));
+        }
+        offsets.push_back(x.size());
+    }
+
+    std::size_t const n = rings.size();
+    rings_type const columns(&x[0], &y[0], &offsets[0], n);
+
+    std::vector<T> min_x(n), min_y(n), max_x(n), max_y(n);
+    std::vector<ct> areas(n), perimeters(n), cx(n), cy(n);
+    bg::envelope_n(columns, &min_x[0], &min_y[0], &max_x[0], &max_y[0],
+                   thread_count);
+    bg::area_n(columns, &areas[0], thread_count);
+    bg::perimeter_n(columns, &perimeters[0], thread_count);
+    bg::centroid_n(columns, &cx[0], &cy[0], thread_count);
+
+    std::size_t differences = 0;
+    for (std::size_t r = 0; r < n; r++)
+    {
+        ring_type const& ring = rings[r];
+        bg::model::box<point_type> box;
+        bg::envelope(ring, box);
+        centroid_type c;
+        bg::centroid(ring, c);
+
+        if (bg::get<bg::min_corner, 0>(box) != min_x[r]
+            || bg::get<bg::min_corner, 1>(box) != min_y[r]
+            || bg::get<bg::max_corner, 0>(box) != max_x[r]
+            || bg::get<bg::max_corner, 1>(box) != max_y[r]
+            || bg::get<0>(c) != cx[r]
+            || bg::get<1>(c) != cy[r])
+        {
+            differences++;
+        }
+
+        if (ct(bg::area(ring)) != areas[r]
+            || ct(bg::perimeter(ring)) != perimeters[r])
+        {
+            differences++;
+        }
+    }
+    BOOST_CHECK_EQUAL(differences, 0u);
+    BOOST_CHECK(areas[10] > 0);
+}
+
+template <typename T>
+void test_all()
+{
+    for (std::size_t thread_count = 1; thread_count <= 4; thread_count += 3)
+    {
+        test_rings<T, true, true>(thread_count);
+        test_rings<T, true, false>(thread_count);
+        test_rings<T, false, true>(thread_count);
+        test_rings<T, false, false>(thread_count);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<double>();
+    test_all<float>();
+    test_all<int>();
+
+    // Empty rings have no centroid
+    {
+        double const x[] = { 0, 0, 1, 0 }, y[] = { 0, 1, 1, 0 };
+        std::size_t const offsets[] = { 0, 4, 4 };
+        bg::columnar_rings<double> const rings(x, y, offsets, 2);
+        double cx[2], cy[2], areas[2];
+        bg::area_n(rings, areas);
+        BOOST_CHECK_EQUAL(areas[0], 0.5);
+        BOOST_CHECK_EQUAL(areas[1], 0.0);
+        BOOST_CHECK_THROW(bg::centroid_n(rings, cx, cy), bg::centroid_exception);
+    }
+
+    return 0;
+}
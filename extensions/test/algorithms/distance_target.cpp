@@ -0,0 +1,237 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/extensions/algorithms/distance_target.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry, typename Target>
+void test_target(std::string const& wkt, std::string const& target_wkt,
+                 double expected)
+{
+    Geometry geometry;
+    Target target_geometry;
+    bg::read_wkt(wkt, geometry);
+    bg::read_wkt(target_wkt, target_geometry);
+
+    bg::distance_target<Target> const target(target_geometry);
+
+    // The results should be exactly the same as unprepared
+    double const d = bg::distance(geometry, target_geometry);
+    double const cd = bg::comparable_distance(geometry, target_geometry);
+
+    BOOST_CHECK_CLOSE(d, expected, 0.0001);
+    BOOST_CHECK_EQUAL(bg::distance(geometry, target), d);
+    BOOST_CHECK_EQUAL(bg::distance(target, geometry), d);
+    BOOST_CHECK_EQUAL(bg::comparable_distance(geometry, target), cd);
+    BOOST_CHECK_EQUAL(bg::comparable_distance(target, geometry), cd);
+
+    // Explicit strategy
+    typedef typename bg::point_type<Geometry>::type point_type;
+    bg::strategy::distance::projected_point<> const strategy;
+    BOOST_CHECK_EQUAL(bg::distance(geometry, target, strategy), d);
+
+    boost::ignore_unused<point_type>();
+}
+
+template <typename Geometry, typename Target>
+void test_targets(std::string const& wkt, std::string const& target_wkt,
+                  double expected)
+{
+    test_target<Geometry, Target>(wkt, target_wkt, expected);
+
+    Geometry geometry;
+    Target target_geometry;
+    bg::read_wkt(wkt, geometry);
+    bg::read_wkt(target_wkt, target_geometry);
+
+    // Two prepared targets
+    bg::distance_target<Geometry> const target1(geometry);
+    bg::distance_target<Target> const target2(target_geometry);
+    BOOST_CHECK_EQUAL(bg::distance(target1, target2),
+                      bg::distance(geometry, target_geometry));
+    BOOST_CHECK_EQUAL(bg::comparable_distance(target1, target2),
+                      bg::comparable_distance(geometry, target_geometry));
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> mls;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    std::string const target_ls = "LINESTRING(0 0,10 0,10 10)";
+    std::string const target_mls
+        = "MULTILINESTRING((0 0,10 0,10 10),(20 0,30 0))";
+    std::string const target_poly
+        = "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))";
+    std::string const target_mpoly
+        = "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 5,25 5,25 0,20 0)))";
+
+    // Point queries
+    test_target<P, ls>("POINT(5 3)", target_ls, 3.0);
+    test_target<P, poly>("POINT(5 5)", target_poly, 1.0);
+    test_target<P, poly>("POINT(2 2)", target_poly, 0.0);
+    test_target<P, mpoly>("POINT(15 3)", target_mpoly, 5.0);
+
+    // Multi point
+    test_targets<mp, ls>("MULTIPOINT(5 3,12 12,1 -1)", target_ls, 1.0);
+    test_targets<mp, mls>("MULTIPOINT(25 2,5 5)", target_mls, 2.0);
+    test_targets<mp, poly>("MULTIPOINT(5 5,12 12)", target_poly, 1.0);
+    test_targets<mp, poly>("MULTIPOINT(2 2,12 12)", target_poly, 0.0);
+
+    // Linear
+    test_targets<ls, ls>("LINESTRING(2 3,8 3)", target_ls, 2.0);
+    test_targets<ls, ls>("LINESTRING(5 -5,5 5)", target_ls, 0.0);
+    test_targets<ls, mls>("LINESTRING(15 2,18 2,18 8)", target_mls, std::sqrt(8.0));
+    test_targets<mls, mls>("MULTILINESTRING((15 2,18 2),(40 0,50 0))",
+                          target_mls, std::sqrt(8.0));
+    test_targets<ls, poly>("LINESTRING(12 0,12 10)", target_poly, 2.0);
+    test_targets<ls, poly>("LINESTRING(4.5 5,5.5 5)", target_poly, 0.5);
+    test_targets<ls, poly>("LINESTRING(1 1,2 2)", target_poly, 0.0);
+    test_targets<mls, mpoly>("MULTILINESTRING((12 1,12 2),(30 0,30 5))",
+                            target_mpoly, 2.0);
+
+    // Areal
+    test_targets<poly, poly>("POLYGON((12 0,12 5,15 5,15 0,12 0))",
+                            target_poly, 2.0);
+    test_targets<poly, poly>("POLYGON((4.5 4.5,4.5 5.5,5.5 5.5,5.5 4.5,4.5 4.5))",
+                            target_poly, 0.5);
+    test_targets<poly, poly>("POLYGON((1 1,1 2,2 2,2 1,1 1))",
+                            target_poly, 0.0);
+    // Target inside the geometry
+    test_targets<poly, ls>("POLYGON((-5 -5,-5 15,15 15,15 -5,-5 -5))",
+                          target_ls, 0.0);
+    test_targets<mpoly, mpoly>("MULTIPOLYGON(((12 0,12 5,15 5,15 0,12 0)),"
+                              "((30 30,30 31,31 31,31 30,30 30)))",
+                              target_mpoly, 2.0);
+
+    // Degenerate target without segments
+    test_targets<ls, ls>("LINESTRING(2 3,8 3)", "LINESTRING(5 5)", 2.0);
+}
+
+
+template <typename P>
+void test_many()
+{
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::polygon<P> poly;
+
+    poly target_geometry;
+    for (int i = 0; i < 360; i += 3)
+    {
+        double const a = i * 3.14159265358979323846 / 180.0;
+        bg::append(target_geometry.outer(),
+                   P(100.0 * std::cos(-a), 100.0 * std::sin(-a)));
+    }
+    bg::correct(target_geometry);
+
+    bg::distance_target<poly> const target(target_geometry);
+    for (int i = 0; i < 50; i++)
+    {
+        ls query;
+        bg::append(query, P(150.0 + i, -20.0 * i));
+        bg::append(query, P(130.0 - i, 10.0 * i));
+        bg::append(query, P(-200.0 + 3 * i, 5.0 * i));
+        BOOST_CHECK_EQUAL(bg::distance(query, target),
+                          bg::distance(query, target_geometry));
+        BOOST_CHECK_EQUAL(bg::comparable_distance(query, target),
+                          bg::comparable_distance(query, target_geometry));
+    }
+}
+
+
+// The nearest queries of the rtree compare cartesian distances, which
+// differ from the distances on the sphere or the spheroid. The results
+// should still be the same as unprepared.
+template <typename P>
+P next_point(unsigned int& state)
+{
+    state = state * 1103515245u + 12345u;
+    double const lon = static_cast<int>((state >> 8) % 3600) / 10.0 - 180.0;
+    state = state * 1103515245u + 12345u;
+    double const lat = static_cast<int>((state >> 8) % 1700) / 10.0 - 85.0;
+    return P(lon, lat);
+}
+
+template <typename P>
+void test_non_cartesian()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::linestring<P> ls;
+
+    unsigned int state = 1;
+    ls target_geometry;
+    for (int i = 0; i < 200; i++)
+    {
+        bg::append(target_geometry, next_point<P>(state));
+    }
+    bg::distance_target<ls> const target(target_geometry);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        mp points;
+        bg::append(points, next_point<P>(state));
+        bg::append(points, next_point<P>(state));
+
+        BOOST_CHECK_EQUAL(bg::distance(points.front(), target),
+                          bg::distance(points.front(), target_geometry));
+        BOOST_CHECK_EQUAL(bg::comparable_distance(points.front(), target),
+                          bg::comparable_distance(points.front(), target_geometry));
+        BOOST_CHECK_EQUAL(bg::distance(points, target),
+                          bg::distance(points, target_geometry));
+    }
+}
+
+template <typename P>
+void test_geographic()
+{
+    typedef bg::model::multi_point<P> mp;
+
+    mp target_geometry, points;
+    bg::read_wkt("MULTIPOINT(-170 80,-10 80,0 0,10 0,20 -70,170 -75)",
+                 target_geometry);
+    bg::read_wkt("MULTIPOINT(179 -75,5 85,-90 80,15 -30)", points);
+    bg::distance_target<mp> const target(target_geometry);
+
+    for (typename boost::range_iterator<mp const>::type it = boost::begin(points);
+         it != boost::end(points); ++it)
+    {
+        BOOST_CHECK_EQUAL(bg::distance(*it, target),
+                          bg::distance(*it, target_geometry));
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_many<bg::model::d2::point_xy<double> >();
+
+    test_non_cartesian<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+    test_geographic<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
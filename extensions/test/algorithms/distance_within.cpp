@@ -0,0 +1,273 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/extensions/algorithms/distance_within.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Checks distance_within at, just below and just above the distance
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void check_within(std::string const& caseid,
+                  Geometry1 const& geometry1, Geometry2 const& geometry2,
+                  Strategy const& strategy)
+{
+    double const d = bg::distance(geometry1, geometry2, strategy);
+    double const eps = 1.0e-6 * (1.0 + d);
+
+    BOOST_CHECK_MESSAGE(bg::distance_within(geometry1, geometry2, d + eps, strategy),
+                        caseid << " distance: " << d);
+    BOOST_CHECK_MESSAGE(bg::distance_within(geometry2, geometry1, d + eps, strategy),
+                        caseid << " reversed, distance: " << d);
+    BOOST_CHECK_MESSAGE(bg::dwithin(geometry1, geometry2, 2.0 * d + 1.0, strategy),
+                        caseid << " distance: " << d);
+    if (d > eps)
+    {
+        BOOST_CHECK_MESSAGE(! bg::distance_within(geometry1, geometry2, d - eps, strategy),
+                            caseid << " distance: " << d);
+        BOOST_CHECK_MESSAGE(! bg::distance_within(geometry2, geometry1, d / 2.0, strategy),
+                            caseid << " reversed, distance: " << d);
+    }
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_geometry(std::string const& caseid,
+                   std::string const& wkt1, std::string const& wkt2,
+                   double expected_distance)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    BOOST_CHECK_CLOSE(bg::distance(geometry1, geometry2), expected_distance, 0.0001);
+
+    check_within(caseid, geometry1, geometry2,
+        typename bg::detail::distance::default_strategy<Geometry1, Geometry2>::type());
+
+    double const d = bg::distance(geometry1, geometry2);
+    BOOST_CHECK(bg::distance_within(geometry1, geometry2, d + 1.0e-6));
+    if (d > 0)
+    {
+        BOOST_CHECK(! bg::distance_within(geometry1, geometry2, d * 0.999));
+    }
+}
+
+
+template <typename P>
+void test_cartesian()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> mls;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    std::string const square = "POLYGON((0 0,0 10,10 10,10 0,0 0))";
+    std::string const holey
+        = "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))";
+
+    test_geometry<P, P>("p_p", "POINT(0 0)", "POINT(3 4)", 5.0);
+    test_geometry<P, ls>("p_ls", "POINT(5 3)", "LINESTRING(0 0,10 0,10 10)", 3.0);
+    test_geometry<P, poly>("p_poly_in", "POINT(5 3)", square, 0.0);
+    test_geometry<P, poly>("p_poly_hole", "POINT(5 5)", holey, 1.0);
+    test_geometry<mp, mp>("mp_mp", "MULTIPOINT(0 0,10 10)", "MULTIPOINT(3 4,20 20)", 5.0);
+    test_geometry<mp, ls>("mp_ls", "MULTIPOINT(5 3,12 12)",
+                          "LINESTRING(0 0,10 0,10 10)", std::sqrt(8.0));
+    test_geometry<ls, ls>("ls_ls", "LINESTRING(2 3,8 3)",
+                          "LINESTRING(0 0,10 0,10 10)", 2.0);
+    test_geometry<ls, ls>("ls_ls_cross", "LINESTRING(5 -5,5 5)",
+                          "LINESTRING(0 0,10 0,10 10)", 0.0);
+    test_geometry<mls, mls>("mls_mls", "MULTILINESTRING((15 2,18 2),(40 0,50 0))",
+                            "MULTILINESTRING((0 0,10 0,10 10),(20 0,30 0))",
+                            std::sqrt(8.0));
+    test_geometry<ls, poly>("ls_poly", "LINESTRING(12 0,12 10)", square, 2.0);
+    test_geometry<ls, poly>("ls_poly_in", "LINESTRING(1 1,2 2)", square, 0.0);
+    test_geometry<ls, poly>("ls_poly_hole", "LINESTRING(4.5 5,5.5 5)", holey, 0.5);
+    test_geometry<poly, poly>("poly_poly", "POLYGON((12 0,12 5,15 5,15 0,12 0))",
+                              square, 2.0);
+    test_geometry<poly, poly>("poly_poly_in", "POLYGON((1 1,1 2,2 2,2 1,1 1))",
+                              square, 0.0);
+    test_geometry<mpoly, mpoly>("mpoly_mpoly",
+        "MULTIPOLYGON(((12 0,12 5,15 5,15 0,12 0)),((30 30,30 31,31 31,31 30,30 30)))",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 5,25 5,25 0,20 0)))",
+        2.0);
+    // Degenerate linestring
+    test_geometry<ls, ls>("ls_ls_degenerate", "LINESTRING(2 3,8 3)",
+                          "LINESTRING(5 5)", 2.0);
+
+    // Many segments, all sections of the far geometry are skipped
+    ls spiral, line;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const a = i * 0.05;
+        bg::append(spiral, P(a * std::cos(a), a * std::sin(a)));
+        bg::append(line, P(100.0 + i * 0.1, 60.0 - i * 0.05));
+    }
+    check_within("spiral", spiral, line,
+                 bg::strategy::distance::projected_point<>());
+
+    // Comparable strategy: compared with the comparable distance
+    ls ls1, ls2;
+    bg::read_wkt("LINESTRING(2 3,8 3)", ls1);
+    bg::read_wkt("LINESTRING(0 0,10 0,10 10)", ls2);
+    typedef bg::strategy::distance::projected_point
+        <
+            void, bg::strategy::distance::comparable::pythagoras<>
+        > comparable_strategy;
+    BOOST_CHECK(bg::distance_within(ls1, ls2, 4.0, comparable_strategy()));
+    BOOST_CHECK(! bg::distance_within(ls1, ls2, 3.9, comparable_strategy()));
+}
+
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > P;
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::linestring<P> ls;
+
+    double const earth_radius = 6372795.0;
+
+    mp mp1, mp2;
+    bg::read_wkt("MULTIPOINT(4.9 52.4,2.3 48.9,13.4 52.5)", mp1);
+    bg::read_wkt("MULTIPOINT(-0.1 51.5,-3.7 40.4,12.5 41.9)", mp2);
+    check_within("sph_mp_mp", mp1, mp2,
+                 bg::strategy::distance::haversine<double>(earth_radius));
+
+    ls line;
+    bg::read_wkt("LINESTRING(0 50,5 51,10 50,15 52)", line);
+    P const point(4.9, 52.4);
+    check_within("sph_p_ls", point, line,
+                 bg::strategy::distance::cross_track<>(earth_radius));
+    check_within("sph_mp_ls", mp2, line,
+                 bg::strategy::distance::cross_track<>(earth_radius));
+
+    ls line2;
+    bg::read_wkt("LINESTRING(0 40,5 41,10 42,15 41)", line2);
+    check_within("sph_ls_ls", line, line2,
+                 bg::strategy::distance::cross_track<>(earth_radius));
+}
+
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > P;
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::srs::spheroid<double> spheroid;
+
+    mp mp1, mp2;
+    bg::read_wkt("MULTIPOINT(4.9 52.4,2.3 48.9,13.4 52.5)", mp1);
+    bg::read_wkt("MULTIPOINT(-0.1 51.5,-3.7 40.4,12.5 41.9)", mp2);
+
+    // The distance between multi points is not (yet) supported for
+    // geographic coordinates, compare with the minimal distance of the points
+    bg::strategy::distance::andoyer<spheroid> const andoyer;
+    double d = -1.0;
+    for (std::size_t i = 0; i < mp1.size(); i++)
+    {
+        for (std::size_t j = 0; j < mp2.size(); j++)
+        {
+            double const dp = bg::distance(mp1[i], mp2[j], andoyer);
+            if (d < 0 || dp < d)
+            {
+                d = dp;
+            }
+        }
+    }
+    BOOST_CHECK(bg::distance_within(mp1, mp2, d + 0.01, andoyer));
+    BOOST_CHECK(bg::distance_within(mp2, mp1, d + 0.01, andoyer));
+    BOOST_CHECK(! bg::distance_within(mp1, mp2, d - 0.01, andoyer));
+    BOOST_CHECK(! bg::distance_within(mp1, mp2, d / 2.0, andoyer));
+
+    check_within("geo_p_p", mp1[0], mp2[0],
+                 bg::strategy::distance::vincenty<spheroid>());
+}
+
+
+template <typename P>
+void test_rtree()
+{
+    namespace bgi = bg::index;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::box<P> box;
+
+    std::vector<P> points;
+    for (int x = 0; x < 50; x++)
+    {
+        for (int y = 0; y < 50; y++)
+        {
+            points.push_back(P(x, y));
+        }
+    }
+    bgi::rtree<P, bgi::quadratic<16> > const point_tree(points);
+
+    ls line;
+    bg::read_wkt("LINESTRING(10.5 10.5,30.5 20.5,30.5 40.5)", line);
+
+    std::vector<P> result;
+    point_tree.query(bgi::dwithin(line, 2.0), std::back_inserter(result));
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        if (bg::distance(points[i], line) <= 2.0)
+        {
+            expected++;
+        }
+    }
+    BOOST_CHECK_EQUAL(result.size(), expected);
+    BOOST_CHECK(expected > 0);
+
+    // Combined with another predicate
+    result.clear();
+    point_tree.query(bgi::dwithin(line, 2.0) && bgi::intersects(box(P(0, 0), P(20, 20))),
+                     std::back_inserter(result));
+    BOOST_CHECK(result.size() > 0 && result.size() < expected);
+
+    // Boxes as indexables
+    std::vector<box> boxes;
+    for (int i = 0; i < 50; i++)
+    {
+        boxes.push_back(box(P(i, i % 7), P(i + 0.5, i % 7 + 0.5)));
+    }
+    bgi::rtree<box, bgi::linear<8> > const box_tree(boxes);
+    std::vector<box> box_result;
+    box_tree.query(bgi::dwithin(line, 1.0), std::back_inserter(box_result));
+    std::size_t expected_boxes = 0;
+    for (std::size_t i = 0; i < boxes.size(); i++)
+    {
+        if (bg::distance(boxes[i], line) <= 1.0)
+        {
+            expected_boxes++;
+        }
+    }
+    BOOST_CHECK_EQUAL(box_result.size(), expected_boxes);
+}
+
+
+int test_main(int, char* [])
+{
+    test_cartesian<bg::model::d2::point_xy<double> >();
+    test_spherical();
+    test_geographic();
+    test_rtree<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/reverse.hpp>
+#include <boost/geometry/extensions/algorithms/equals_fingerprint.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry1, typename Geometry2>
+void test_same(std::string const& caseid,
+               std::string const& wkt1, std::string const& wkt2)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    BOOST_CHECK_MESSAGE(bg::equals_fingerprint(geometry1)
+                        == bg::equals_fingerprint(geometry2),
+        caseid << " fingerprints differ");
+}
+
+template <typename Geometry1, typename Geometry2>
+void test_different(std::string const& caseid,
+                    std::string const& wkt1, std::string const& wkt2)
+{
+    Geometry1 geometry1;
+    Geometry2 geometry2;
+    bg::read_wkt(wkt1, geometry1);
+    bg::read_wkt(wkt2, geometry2);
+
+    BOOST_CHECK_MESSAGE(bg::equals_fingerprint(geometry1)
+                        != bg::equals_fingerprint(geometry2),
+        caseid << " fingerprints are the same");
+}
+
+template <typename Polygon>
+std::vector<Polygon> make_parcels(int n, int shift)
+{
+    // Parcels, of which the start point is shifted over the ring
+    std::vector<Polygon> result;
+    for (int i = 0; i < n; i++)
+    {
+        double const x = i % 20, y = i / 20;
+        double const c[4][2] = { {x, y}, {x, y + 1}, {x + 1, y + 1}, {x + 1, y} };
+        Polygon parcel;
+        for (int j = 0; j <= 4; j++)
+        {
+            int const k = (i * shift + j) % 4;
+            bg::exterior_ring(parcel).push_back(
+                typename bg::point_type<Polygon>::type(c[k][0], c[k][1]));
+        }
+        result.push_back(parcel);
+    }
+    return result;
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+
+    std::string const square = "POLYGON((0 0,0 10,10 10,10 0,0 0))";
+
+    test_same<polygon, polygon>("start_point", square,
+        "POLYGON((10 10,10 0,0 0,0 10,10 10))");
+    test_same<polygon, polygon>("orientation", square,
+        "POLYGON((0 0,10 0,10 10,0 10,0 0))");
+    test_same<polygon, polygon>("collinear", square,
+        "POLYGON((0 0,0 5,0 10,10 10,10 0,5 0,0 0))");
+    test_same<polygon, polygon>("collinear_start", square,
+        "POLYGON((0 5,0 10,10 10,10 0,0 0,0 5))");
+    test_same<polygon, polygon>("duplicate", square,
+        "POLYGON((0 0,0 10,0 10,10 10,10 0,0 0))");
+    test_same<polygon, ring>("polygon_ring", square,
+        "POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    test_same<polygon, box>("polygon_box", square, "BOX(0 0,10 10)");
+    test_same<polygon, multi_polygon>("polygon_multi", square,
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)))");
+    test_same<polygon, polygon>("holes",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 1),(5 5,6 5,6 6,5 5))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(6 6,5 5,6 5,6 6),(1 1,2 1,2 2,1 1))");
+    test_same<multi_polygon, multi_polygon>("multi",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)))",
+        "MULTIPOLYGON(((20 0,20 10,30 10,30 0,20 0)),((0 0,0 10,10 10,10 0,0 0)))");
+
+    test_different<polygon, polygon>("other", square,
+        "POLYGON((0 0,0 10,10 10,11 0,0 0))");
+    test_different<polygon, polygon>("swapped", square,
+        "POLYGON((0 0,0 10,10 10,10 1,0 0))");
+    test_different<polygon, polygon>("hole", square,
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 1))");
+    test_different<polygon, multi_polygon>("more", square,
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)))");
+    test_different<polygon, polygon>("transposed",
+        "POLYGON((0 0,1 2,2 0,0 0))",
+        "POLYGON((0 0,2 1,0 2,0 0))");
+
+    // Spatially equal geometries have the same fingerprint
+    {
+        polygon p1, p2;
+        bg::read_wkt("POLYGON((0 0,0 7,3 9,9 4,8 1,0 0),(2 2,4 2,3 4,2 2))", p1);
+        p2 = p1;
+        bg::reverse(p2);
+        bg::correct(p2);
+        BOOST_CHECK(bg::equals(p1, p2));
+        BOOST_CHECK_EQUAL(bg::equals_fingerprint(p1), bg::equals_fingerprint(p2));
+    }
+
+    // Join, compared with comparing all pairs
+    std::vector<polygon> const parcels1 = make_parcels<polygon>(200, 1);
+    std::vector<polygon> parcels2 = make_parcels<polygon>(150, 3);
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", parcels2[100]);
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,2 0,0 0))", parcels2[101]);
+
+    typedef std::vector<std::pair<std::size_t, std::size_t> > pairs_type;
+    pairs_type expected, detected;
+    for (std::size_t i = 0; i < parcels1.size(); i++)
+    {
+        for (std::size_t j = 0; j < parcels2.size(); j++)
+        {
+            if (bg::equals(parcels1[i], parcels2[j]))
+            {
+                expected.push_back(std::make_pair(i, j));
+            }
+        }
+    }
+    bg::equals_join(parcels1, parcels2, std::back_inserter(detected));
+    BOOST_CHECK_EQUAL(expected.size(), 149u);
+    BOOST_CHECK(expected == detected);
+
+    // Duplicates
+    std::vector<polygon> all = parcels1;
+    all.insert(all.end(), parcels2.begin(), parcels2.end());
+    std::vector<std::size_t> first_equal;
+    std::size_t const unique_count = bg::equals_duplicates(all, first_equal);
+    BOOST_CHECK_EQUAL(unique_count, 201u);
+    BOOST_CHECK_EQUAL(first_equal.size(), all.size());
+    for (std::size_t i = 0; i < all.size(); i++)
+    {
+        std::size_t expected_first = i;
+        for (std::size_t j = 0; j < i; j++)
+        {
+            if (bg::equals(all[j], all[i]))
+            {
+                expected_first = j;
+                break;
+            }
+        }
+        BOOST_CHECK_EQUAL(first_equal[i], expected_first);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<int> >();
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/extensions/algorithms/convex_hull_accumulator.hpp>
+#include <boost/geometry/extensions/algorithms/parallel_convex_hull.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename MultiPoint>
+void test_points(MultiPoint const& points, std::size_t buffer_size)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+    typedef bg::model::polygon<point_type> polygon;
+
+    polygon expected;
+    bg::convex_hull(points, expected);
+
+    bg::convex_hull_accumulator<point_type> accumulator(buffer_size);
+    accumulator.add_range(points);
+    polygon streamed;
+    accumulator.result(streamed);
+    BOOST_CHECK_EQUAL(to_wkt(expected), to_wkt(streamed));
+
+    for (std::size_t threads = 1; threads <= 4; threads *= 2)
+    {
+        polygon parallel;
+        bg::parallel_convex_hull(points, parallel, threads, 1024);
+        BOOST_CHECK_EQUAL(to_wkt(expected), to_wkt(parallel));
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> multi_point;
+
+    {
+        multi_point mp;
+        bg::read_wkt("MULTIPOINT(0 0,2 0)", mp);
+        test_points(mp, 16);
+        bg::read_wkt("MULTIPOINT(1 1,0 0,2 2,3 0,1 2,0 3,2 1)", mp);
+        test_points(mp, 16);
+    }
+
+    // Points on a grid, many of them collinear on the hull
+    {
+        multi_point mp;
+        for (int i = 0; i < 100; i++)
+        {
+            for (int j = 0; j < 100; j++)
+            {
+                mp.push_back(P(i, j));
+            }
+        }
+        test_points(mp, 100);
+    }
+
+    // Pseudo random points in a disc
+    {
+        multi_point mp;
+        unsigned int seed = 12345;
+        for (int i = 0; i < 20000; i++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            double const angle = (seed % 36000) / 36000.0 * 6.28318530718;
+            seed = seed * 1103515245u + 12345u;
+            double const radius = (seed % 10000) / 100.0;
+            mp.push_back(P(radius * std::cos(angle), radius * std::sin(angle)));
+        }
+        test_points(mp, 500);
+    }
+
+    // Empty input results in an empty hull, like convex_hull
+    {
+        bg::convex_hull_accumulator<P> accumulator;
+        bg::model::polygon<P> hull;
+        accumulator.result(hull);
+        BOOST_CHECK(bg::is_empty(hull));
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
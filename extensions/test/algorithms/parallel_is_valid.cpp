@@ -0,0 +1,156 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/extensions/algorithms/parallel_is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+void check_same(std::string const& caseid, Geometry const& geometry,
+                std::size_t threads)
+{
+    std::string expected_message, detected_message;
+    bg::validity_failure_type expected_failure, detected_failure;
+
+    bool const expected = bg::is_valid(geometry, expected_message);
+    bool const detected = bg::parallel_is_valid(geometry, detected_message,
+                                                threads);
+    bg::is_valid(geometry, expected_failure);
+    bg::parallel_is_valid(geometry, detected_failure, threads);
+
+    BOOST_CHECK_MESSAGE(expected == detected,
+        caseid << " expected: " << expected << " detected: " << detected);
+    BOOST_CHECK_EQUAL(expected_message, detected_message);
+    BOOST_CHECK_EQUAL(expected_failure, detected_failure);
+    BOOST_CHECK_EQUAL(expected, bg::parallel_is_valid(geometry, threads));
+}
+
+template <typename Geometry>
+void test_wkt(std::string const& caseid, std::string const& wkt,
+              bool expected, std::size_t threads)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    BOOST_CHECK_EQUAL(bg::is_valid(geometry), expected);
+    check_same(caseid, geometry, threads);
+}
+
+// A grid of n x n squares with a hole, touching each other at corners
+template <typename MultiPolygon>
+MultiPolygon make_grid(int n)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon;
+    MultiPolygon result;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            std::ostringstream out;
+            out << "POLYGON((" << 2 * i << " " << 2 * j << ","
+                << 2 * i << " " << 2 * j + 1 << ","
+                << 2 * i + 1 << " " << 2 * j + 1 << ","
+                << 2 * i + 1 << " " << 2 * j << ","
+                << 2 * i << " " << 2 * j << "),("
+                << 2 * i + 0.2 << " " << 2 * j + 0.2 << ","
+                << 2 * i + 0.8 << " " << 2 * j + 0.2 << ","
+                << 2 * i + 0.8 << " " << 2 * j + 0.8 << ","
+                << 2 * i + 0.2 << " " << 2 * j + 0.2 << "))";
+            polygon p;
+            bg::read_wkt(out.str(), p);
+            result.push_back(p);
+        }
+    }
+    return result;
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    for (std::size_t threads = 1; threads <= 4; threads += 3)
+    {
+        test_wkt<multi_polygon>("empty", "MULTIPOLYGON()", true, threads);
+        test_wkt<multi_polygon>("two",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((20 0,20 10,30 10,30 0,20 0)))", true, threads);
+        test_wkt<multi_polygon>("touching",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((10 10,10 20,20 20,20 10,10 10)))", true, threads);
+        test_wkt<multi_polygon>("few_points",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,20 0)))",
+            false, threads);
+        test_wkt<multi_polygon>("spike",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((20 0,20 10,30 10,30 0,35 0,30 0,20 0)))", false, threads);
+        test_wkt<multi_polygon>("hole_outside",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((20 0,20 10,30 10,30 0,20 0),(40 1,41 1,41 2,40 1)))",
+            false, threads);
+        test_wkt<multi_polygon>("disconnected_interior",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((20 0,20 10,30 10,30 0,20 0),(20 5,25 0,30 5,25 10,20 5)))",
+            false, threads);
+        test_wkt<multi_polygon>("overlapping",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((5 5,5 15,15 15,15 5,5 5)))", false, threads);
+        test_wkt<multi_polygon>("nested",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),"
+            "((2 2,2 8,8 8,8 2,2 2)))", false, threads);
+        test_wkt<polygon>("polygon",
+            "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 1))",
+            true, threads);
+    }
+
+    // Many polygons, so that several threads are really used
+    multi_polygon grid = make_grid<multi_polygon>(40);
+    check_same("grid", grid, 4);
+    BOOST_CHECK(bg::parallel_is_valid(grid));
+
+    // Invalid polygons in several chunks, the first is reported
+    multi_polygon invalid = grid;
+    bg::exterior_ring(invalid[1000]).resize(3);
+    bg::exterior_ring(invalid[1000]).push_back(bg::exterior_ring(invalid[1000]).front());
+    bg::interior_rings(invalid[700]).front()[1] = P(1500.0, 1.0);
+    bg::interior_rings(invalid[300]).front().resize(2);
+    check_same("grid_invalid", invalid, 4);
+
+    // Range of geometries
+    std::vector<polygon> polygons(invalid.begin(), invalid.end());
+    std::vector<bg::validity_failure_type> failures;
+    BOOST_CHECK(! bg::parallel_is_valid_each(polygons, failures, 4));
+    BOOST_CHECK_EQUAL(failures.size(), polygons.size());
+    for (std::size_t i = 0; i < polygons.size(); i++)
+    {
+        bg::validity_failure_type failure;
+        bool const valid = bg::is_valid(polygons[i], failure);
+        BOOST_CHECK_EQUAL(failures[i], valid ? bg::no_failure : failure);
+    }
+
+    std::vector<polygon> valid_polygons(grid.begin(), grid.end());
+    BOOST_CHECK(bg::parallel_is_valid_each(valid_polygons, failures));
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
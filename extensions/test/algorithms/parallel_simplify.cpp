@@ -0,0 +1,107 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/extensions/algorithms/parallel_simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Linestring>
+Linestring make_wave(int n, double phase)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+    Linestring result;
+    for (int i = 0; i < n; i++)
+    {
+        double const x = i * 0.1;
+        double const y = std::sin(x + phase) * 10.0
+                       + std::sin(x * 7.0 + phase) * 0.5;
+        bg::append(result, point_type(x, y));
+    }
+    return result;
+}
+
+template <typename Geometry>
+void check_same(Geometry const& expected, Geometry const& detected)
+{
+    std::ostringstream e, d;
+    e << bg::wkt(expected);
+    d << bg::wkt(detected);
+    BOOST_CHECK_EQUAL(e.str(), d.str());
+}
+
+template <typename Geometry>
+void test_wkt(std::string const& wkt, double max_distance, std::size_t threads)
+{
+    Geometry geometry, expected, detected;
+    bg::read_wkt(wkt, geometry);
+
+    bg::simplify(geometry, expected, max_distance);
+    bg::parallel_simplify(geometry, detected, max_distance,
+                          bg::default_strategy(), threads);
+    check_same(expected, detected);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    for (std::size_t threads = 1; threads <= 4; threads += 3)
+    {
+        test_wkt<linestring>("LINESTRING(0 0,5 5,10 10)", 1.0, threads);
+        test_wkt<multi_linestring>("MULTILINESTRING((0 0,5 5,10 10),(0 0,5 6,10 10))",
+                                   0.5, threads);
+        test_wkt<multi_polygon>("MULTIPOLYGON(((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0)),"
+                                "((5 5,5 6,6 6,6 5.1,5 5)))", 1.0, threads);
+        test_wkt<multi_polygon>("MULTIPOLYGON()", 1.0, threads);
+    }
+
+    // Many members, so that several threads are really used
+    multi_linestring multi, expected, detected;
+    for (int i = 0; i < 500; i++)
+    {
+        multi.push_back(make_wave<linestring>(200 + i % 17, i * 0.01));
+    }
+    bg::simplify(multi, expected, 0.1);
+    bg::parallel_simplify(multi, detected, 0.1);
+    BOOST_CHECK_EQUAL(bg::num_points(expected), bg::num_points(detected));
+    check_same(expected, detected);
+
+    // Range of geometries
+    std::vector<linestring> input(multi.begin(), multi.end());
+    std::vector<linestring> output;
+    bg::parallel_simplify_each(input, output, 0.1);
+    BOOST_CHECK_EQUAL(output.size(), input.size());
+    for (std::size_t i = 0; i < output.size(); i++)
+    {
+        check_same(expected[i], output[i]);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/extensions/algorithms/simplify_preserve_topology.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt, double max_area,
+                   std::string const& expected)
+{
+    Geometry geometry, simplified;
+    bg::read_wkt(wkt, geometry);
+    bg::simplify_preserve_topology(geometry, simplified, max_area);
+
+    std::ostringstream out;
+    out << bg::wkt(simplified);
+    BOOST_CHECK_MESSAGE(out.str() == expected,
+        "simplify_preserve_topology: " << wkt
+        << " expected " << expected
+        << " got " << out.str());
+}
+
+template <typename Geometry>
+void test_valid(std::string const& wkt, double max_area,
+                std::size_t expected_points)
+{
+    Geometry geometry, simplified;
+    bg::read_wkt(wkt, geometry);
+    BOOST_CHECK(bg::is_valid(geometry));
+
+    bg::simplify_preserve_topology(geometry, simplified, max_area);
+    BOOST_CHECK_MESSAGE(bg::is_valid(simplified),
+        "simplify_preserve_topology: " << wkt
+        << " result is not valid: " << bg::wkt(simplified));
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), expected_points);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // Collinear points are removed, end points are kept
+    test_geometry<linestring>("LINESTRING(0 0,1 0,2 0,3 1,4 0)", 0.0,
+                              "LINESTRING(0 0,2 0,3 1,4 0)");
+    test_geometry<linestring>("LINESTRING(0 0,1 0.1,2 0,3 1,4 0)", 0.2,
+                              "LINESTRING(0 0,2 0,3 1,4 0)");
+    test_geometry<linestring>("LINESTRING(0 0,1 1)", 10.0,
+                              "LINESTRING(0 0,1 1)");
+
+    // Rings keep at least three points
+    test_geometry<polygon>("POLYGON((0 0,0 4,4 4,4 0,0 0))", 100.0,
+                           "POLYGON((0 4,4 4,4 0,0 4))");
+
+    // The hole is inside a bump of the exterior ring: removing (5 -2)
+    // would cut off the hole, removing the collinear (2 -0.8) is allowed
+    test_valid<polygon>("POLYGON((0 0,0 10,10 10,10 0,5 -2,2 -0.8,0 0),"
+                        "(4 -1,6 -1,5 -0.5,4 -1))", 20.0, 10);
+
+    // The spiral is not allowed to cross itself, it is unwound from inside
+    test_geometry<linestring>("LINESTRING(0 0,10 0,10 10,2 10,2 2,8 2,8 8,4 8,4 4)",
+                              1000.0, "LINESTRING(0 0,4 4)");
+    test_geometry<linestring>("LINESTRING(0 0,10 0,10 10,2 10,2 2,8 2,8 8,4 8,4 4)",
+                              10.0, "LINESTRING(0 0,10 0,10 10,2 10,2 2,8 2,8 8,4 4)");
+
+    // Two members may not start to intersect each other
+    {
+        multi_linestring ml, simplified;
+        bg::read_wkt("MULTILINESTRING((0 0,5 2,10 0),(3 1,7 1))", ml);
+        bg::simplify_preserve_topology(ml, simplified, 100.0);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 5u);
+        BOOST_CHECK(! bg::intersects(simplified[0], simplified[1]));
+    }
+
+    // Neighbouring wavy polygons, separated by a small gap
+    {
+        polygon left, right;
+        bg::append(bg::exterior_ring(left), P(-10, 0));
+        bg::append(bg::exterior_ring(left), P(-10, 50));
+        for (int i = 50; i >= 0; i--)
+        {
+            double const y = i;
+            bg::append(bg::exterior_ring(left), P(std::sin(y) * 0.4 - 0.05, y));
+        }
+        bg::append(bg::exterior_ring(left), P(-10, 0));
+
+        bg::append(bg::exterior_ring(right), P(10, 0));
+        for (int i = 0; i <= 50; i++)
+        {
+            double const y = i;
+            bg::append(bg::exterior_ring(right), P(std::sin(y) * 0.4 + 0.05, y));
+        }
+        bg::append(bg::exterior_ring(right), P(10, 50));
+        bg::append(bg::exterior_ring(right), P(10, 0));
+
+        multi_polygon mp, simplified;
+        bg::correct(left);
+        bg::correct(right);
+        mp.push_back(left);
+        mp.push_back(right);
+        BOOST_CHECK(bg::is_valid(mp));
+
+        bg::simplify_preserve_topology(mp, simplified, 5.0);
+        BOOST_CHECK(bg::is_valid(simplified));
+        BOOST_CHECK(bg::num_points(simplified) < bg::num_points(mp));
+        BOOST_CHECK(! bg::intersects(simplified[0], simplified[1]));
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/extensions/geometries/geometry_table.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+namespace bgi = bg::index;
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+std::vector<unsigned char> to_wkb(Geometry const& geometry)
+{
+    std::vector<unsigned char> result;
+    bg::write_wkb(geometry, std::back_inserter(result));
+    return result;
+}
+
+template <typename View, typename Model>
+void check_areal(View const& view, Model const& model)
+{
+    BOOST_CHECK_EQUAL(to_wkt(view), to_wkt(model));
+    BOOST_CHECK(to_wkb(view) == to_wkb(model));
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(model));
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view), bg::num_interior_rings(model));
+    BOOST_CHECK_EQUAL(bg::area(view), bg::area(model));
+    BOOST_CHECK_EQUAL(bg::perimeter(view), bg::perimeter(model));
+    BOOST_CHECK_EQUAL(bg::is_valid(view), bg::is_valid(model));
+    BOOST_CHECK(bg::equals(view, model));
+
+    typedef typename bg::point_type<Model>::type point_type;
+    bg::model::box<point_type> b1, b2;
+    bg::envelope(view, b1);
+    bg::envelope(model, b2);
+    BOOST_CHECK(bg::equals(b1, b2));
+
+    if (bg::num_points(model) > 0)
+    {
+        point_type c1, c2;
+        bg::centroid(view, c1);
+        bg::centroid(model, c2);
+        BOOST_CHECK_EQUAL(bg::get<0>(c1), bg::get<0>(c2));
+        BOOST_CHECK_EQUAL(bg::get<1>(c1), bg::get<1>(c2));
+
+        BOOST_CHECK_EQUAL(bg::distance(point_type(-5, -5), view),
+                          bg::distance(point_type(-5, -5), model));
+    }
+
+    point_type const p(2.5, 2.5);
+    BOOST_CHECK_EQUAL(bg::within(p, view), bg::within(p, model));
+
+    Model copy;
+    bg::convert(view, copy);
+    BOOST_CHECK_EQUAL(to_wkt(copy), to_wkt(model));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::geometry_table<P> table_type;
+
+    std::string const wkts[] =
+    {
+        "MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1)),((6 0,6 5,9 5,6 0)))",
+        "MULTIPOLYGON(((2 2,2 8,8 8,8 2,2 2)))",
+        "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1),(1.5 1.5,2.5 1.5,2.5 2.5,1.5 1.5)))",
+        "MULTIPOLYGON()",
+        "MULTIPOLYGON(((10 10,10 12,12 12,12 10,10 10)),((13 10,13 12,15 12,13 10)),((0 10,0 12,2 12,0 10)))"
+    };
+    std::size_t const count = sizeof(wkts) / sizeof(wkts[0]);
+
+    std::vector<multi_polygon> models(count);
+    table_type table;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        bg::read_wkt(wkts[i], models[i]);
+        table.push_back(models[i]);
+    }
+    BOOST_CHECK_EQUAL(table.size(), count);
+    BOOST_CHECK_EQUAL(table.points().size(), 45u);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        check_areal(table.multi_polygon(i), models[i]);
+        check_areal(table.polygon(i),
+                    models[i].empty() ? polygon() : models[i].front());
+    }
+
+    // Overlay and relations between rows
+    {
+        multi_polygon result1, result2;
+        bg::intersection(table.multi_polygon(0), table.multi_polygon(1), result1);
+        bg::intersection(models[0], models[1], result2);
+        BOOST_CHECK_CLOSE(bg::area(result1), bg::area(result2), 0.0001);
+        BOOST_CHECK_CLOSE(bg::area(result1), 14.4666667, 0.0001);
+
+        bg::union_(table.polygon(1), table.multi_polygon(2), result1);
+        bg::union_(models[1].front(), models[2], result2);
+        BOOST_CHECK_CLOSE(bg::area(result1), bg::area(result2), 0.0001);
+
+        BOOST_CHECK(bg::intersects(table.multi_polygon(0), table.multi_polygon(1)));
+        BOOST_CHECK(! bg::intersects(table.multi_polygon(1), table.multi_polygon(4)));
+        BOOST_CHECK_EQUAL(bg::relation(table.multi_polygon(0), table.multi_polygon(1)).str(),
+                          bg::relation(models[0], models[1]).str());
+    }
+
+    // Linestrings
+    {
+        linestring ls;
+        bg::read_wkt("LINESTRING(0 0,3 4,3 8)", ls);
+        table.push_back(ls);
+        typename table_type::linestring_view_type const view
+            = table.linestring(count);
+        BOOST_CHECK_EQUAL(to_wkt(view), "LINESTRING(0 0,3 4,3 8)");
+        BOOST_CHECK_CLOSE(bg::length(view), 9.0, 0.0001);
+        BOOST_CHECK(bg::intersects(view, table.multi_polygon(0)));
+
+        polygon hull;
+        bg::convex_hull(view, hull);
+        BOOST_CHECK_CLOSE(bg::area(hull), 6.0, 0.0001);
+    }
+
+    // Empty last row
+    {
+        table.push_back(multi_polygon());
+        std::size_t const last = table.size() - 1;
+        BOOST_CHECK(table.multi_polygon(last).empty());
+        BOOST_CHECK_EQUAL(bg::num_points(table.polygon(last)), 0u);
+        BOOST_CHECK(table.linestring(last).empty());
+        check_areal(table.polygon(last), polygon());
+    }
+
+    // Rtree of the envelopes of the rows
+    {
+        typedef bg::model::box<P> box;
+        typedef std::pair<box, std::size_t> value;
+        std::vector<value> values;
+        for (std::size_t i = 0; i < table.size(); i++)
+        {
+            if (! table.multi_polygon(i).empty())
+            {
+                box b;
+                bg::envelope(table.multi_polygon(i), b);
+                values.push_back(value(b, i));
+            }
+        }
+        bgi::rtree<value, bgi::quadratic<4> > rtree(values);
+
+        std::vector<value> found;
+        rtree.query(bgi::intersects(P(11, 11)), std::back_inserter(found));
+        BOOST_CHECK_EQUAL(found.size(), 1u);
+        BOOST_CHECK_EQUAL(found.front().second, 4u);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,331 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/included/test_exec_monitor.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/extensions/gis/io/shapelib/shp_reader.hpp>
+
+namespace bg = boost::geometry;
+
+namespace { // anonymous
+
+typedef std::vector<unsigned char> byte_vector;
+typedef std::pair<double, double> xy;
+typedef std::vector<xy> part;
+
+void add_little(byte_vector& bytes, boost::uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        bytes.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+void add_big(byte_vector& bytes, boost::uint32_t value)
+{
+    for (int i = 3; i >= 0; i--)
+    {
+        bytes.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+void add_double(byte_vector& bytes, double value)
+{
+    boost::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    add_little(bytes, static_cast<boost::uint32_t>(bits));
+    add_little(bytes, static_cast<boost::uint32_t>(bits >> 32));
+}
+
+// Contents of a polyline or polygon record (without Z, the box is not used)
+byte_vector parts_content(int shape_type, std::vector<part> const& parts)
+{
+    byte_vector result;
+    add_little(result, shape_type);
+    for (int i = 0; i < 4; i++)
+    {
+        add_double(result, 0.0);
+    }
+    std::size_t point_count = 0;
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        point_count += parts[i].size();
+    }
+    add_little(result, static_cast<boost::uint32_t>(parts.size()));
+    add_little(result, static_cast<boost::uint32_t>(point_count));
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        add_little(result, static_cast<boost::uint32_t>(start));
+        start += parts[i].size();
+    }
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        for (std::size_t j = 0; j < parts[i].size(); j++)
+        {
+            add_double(result, parts[i][j].first);
+            add_double(result, parts[i][j].second);
+        }
+    }
+    return result;
+}
+
+byte_vector point_z_content(double x, double y, double z)
+{
+    byte_vector result;
+    add_little(result, bg::shp_shape_type::pointz);
+    add_double(result, x);
+    add_double(result, y);
+    add_double(result, z);
+    add_double(result, 0.0); // m
+    return result;
+}
+
+byte_vector file_header(int shape_type, std::size_t length)
+{
+    byte_vector result;
+    add_big(result, 9994);
+    for (int i = 0; i < 5; i++)
+    {
+        add_big(result, 0);
+    }
+    add_big(result, static_cast<boost::uint32_t>(length / 2));
+    add_little(result, 1000);
+    add_little(result, shape_type);
+    double const box[8] = { -1, -2, 11, 12, 0, 0, 0, 0 };
+    for (int i = 0; i < 8; i++)
+    {
+        add_double(result, box[i]);
+    }
+    return result;
+}
+
+void write_file(std::string const& filename, byte_vector const& bytes)
+{
+    std::ofstream out(filename.c_str(), std::ios::binary);
+    out.write(reinterpret_cast<char const*>(&bytes[0]), bytes.size());
+}
+
+void write_shapefile(std::string const& name, int shape_type,
+                     std::vector<byte_vector> const& contents)
+{
+    byte_vector records, index;
+    for (std::size_t i = 0; i < contents.size(); i++)
+    {
+        add_big(index, static_cast<boost::uint32_t>((100 + records.size()) / 2));
+        add_big(index, static_cast<boost::uint32_t>(contents[i].size() / 2));
+
+        add_big(records, static_cast<boost::uint32_t>(i + 1));
+        add_big(records, static_cast<boost::uint32_t>(contents[i].size() / 2));
+        records.insert(records.end(), contents[i].begin(), contents[i].end());
+    }
+
+    byte_vector shp = file_header(shape_type, 100 + records.size());
+    shp.insert(shp.end(), records.begin(), records.end());
+    byte_vector shx = file_header(shape_type, 100 + index.size());
+    shx.insert(shx.end(), index.begin(), index.end());
+
+    write_file(name + ".shp", shp);
+    write_file(name + ".shx", shx);
+}
+
+part make_part(double const* coordinates, std::size_t count)
+{
+    part result;
+    for (std::size_t i = 0; i + 1 < count; i += 2)
+    {
+        result.push_back(xy(coordinates[i], coordinates[i + 1]));
+    }
+    return result;
+}
+
+struct area_per_record
+{
+    std::vector<double>& areas;
+
+    template <typename Record>
+    void operator()(std::size_t index, Record const& record) const
+    {
+        areas[index] = bg::area(record.polygons());
+    }
+};
+
+} // namespace anonymous
+
+
+void test_polygons()
+{
+    // Clockwise outer rings, counter clockwise holes
+    double const outer1[] = { 0, 0, 0, 10, 10, 10, 10, 0, 0, 0 };
+    double const hole1[] = { 2, 2, 4, 2, 4, 4, 2, 4, 2, 2 };
+    double const outer2[] = { 20, 0, 20, 5, 25, 5, 25, 0, 20, 0 };
+
+    std::vector<part> parts;
+    parts.push_back(make_part(outer1, 10));
+    parts.push_back(make_part(hole1, 10));
+    parts.push_back(make_part(outer2, 10));
+
+    std::vector<part> single;
+    single.push_back(make_part(outer1, 10));
+
+    std::vector<byte_vector> contents;
+    contents.push_back(parts_content(bg::shp_shape_type::polygon, parts));
+    contents.push_back(byte_vector(4, 0)); // null shape
+    contents.push_back(parts_content(bg::shp_shape_type::polygon, single));
+    for (int i = 0; i < 100; i++)
+    {
+        contents.push_back(contents[i % 3]);
+    }
+
+    // Corrupt: second part starts beyond the points
+    byte_vector corrupt = parts_content(bg::shp_shape_type::polygon, parts);
+    corrupt[48] = 200;
+    contents.push_back(corrupt);
+
+    write_shapefile("shp_reader_polygons", bg::shp_shape_type::polygon, contents);
+
+    typedef bg::shp_reader<> reader_type;
+    reader_type reader("shp_reader_polygons.shp");
+
+    BOOST_CHECK_EQUAL(reader.count(), 104u);
+    BOOST_CHECK_EQUAL(reader.shape_type(), int(bg::shp_shape_type::polygon));
+
+    bg::model::box<bg::model::d2::point_xy<double> > box;
+    reader.bounds(box);
+    BOOST_CHECK_CLOSE(bg::area(box), 12.0 * 14.0, 0.0001);
+
+    reader_type::record_type const record = reader.record(0);
+    BOOST_CHECK_EQUAL(record.part_count(), 3u);
+    BOOST_CHECK_EQUAL(record.point_count(), 15u);
+    BOOST_CHECK_EQUAL(bg::num_points(record.points()), 15u);
+    BOOST_CHECK_CLOSE(record.point(5).get<0>(), 2.0, 0.0001);
+
+    // As rings
+    BOOST_CHECK_CLOSE(bg::area(record.ring(0)), 100.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::area(record.ring(1)), -4.0, 0.0001);
+
+    // As multi polygon, grouped on orientation
+    bg::shp_multi_polygon_view<> const polygons = record.polygons();
+    BOOST_CHECK_EQUAL(polygons.size(), 2u);
+    BOOST_CHECK_CLOSE(bg::area(polygons), 100.0 - 4.0 + 25.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::area(polygons[0]), 96.0, 0.0001);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(polygons[0]), 1u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(polygons[1]), 0u);
+
+    bg::model::d2::point_xy<double> const inside(1, 1), in_hole(3, 3);
+    BOOST_CHECK(bg::within(inside, polygons));
+    BOOST_CHECK(! bg::within(in_hole, polygons));
+
+    bg::envelope(polygons, box);
+    BOOST_CHECK_CLOSE(bg::area(box), 250.0, 0.0001);
+
+    // Null shape
+    BOOST_CHECK(reader.record(1).is_null());
+    BOOST_CHECK_EQUAL(reader.record(1).polygons().size(), 0u);
+    BOOST_CHECK_CLOSE(bg::area(reader.record(2).polygon()), 100.0, 0.0001);
+
+    // Corrupt and out of range records
+    reader_type::record_type invalid;
+    BOOST_CHECK(! reader.get_record(103, invalid));
+    BOOST_CHECK(! reader.get_record(104, invalid));
+    BOOST_CHECK_THROW(reader.record(103), bg::shp_read_exception);
+
+    // In parallel (the corrupt record is excluded)
+    std::vector<double> areas(reader.count(), 0.0);
+    area_per_record const visitor = { areas };
+    BOOST_CHECK_THROW(bg::for_each_shp_record(reader, visitor, 4, 8),
+                      bg::shp_read_exception);
+
+    std::fill(areas.begin(), areas.end(), 0.0);
+    for (std::size_t i = 0; i < 103; i++)
+    {
+        visitor(i, reader.record(i));
+    }
+    double total = 0;
+    for (std::size_t i = 0; i < areas.size(); i++)
+    {
+        total += areas[i];
+    }
+    BOOST_CHECK_CLOSE(total, 35 * 121.0 + 34 * 100.0, 0.0001);
+}
+
+void test_polylines()
+{
+    double const line1[] = { 0, 0, 3, 4 };
+    double const line2[] = { 10, 10, 10, 15, 20, 15 };
+
+    std::vector<part> parts;
+    parts.push_back(make_part(line1, 4));
+    parts.push_back(make_part(line2, 6));
+
+    std::vector<byte_vector> contents;
+    contents.push_back(parts_content(bg::shp_shape_type::polyline, parts));
+    write_shapefile("shp_reader_polylines", bg::shp_shape_type::polyline, contents);
+
+    bg::shp_reader<> reader("shp_reader_polylines");
+    BOOST_CHECK_EQUAL(reader.count(), 1u);
+
+    bg::shp_record<> const record = reader.record(0);
+    BOOST_CHECK_CLOSE(bg::length(record.linestring(0)), 5.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::length(record.linestrings()), 20.0, 0.0001);
+    BOOST_CHECK_EQUAL(boost::size(record.linestrings()), 2u);
+}
+
+void test_points()
+{
+    std::vector<byte_vector> contents;
+    contents.push_back(point_z_content(1.5, 2.5, 3.5));
+    write_shapefile("shp_reader_points", bg::shp_shape_type::pointz, contents);
+
+    bg::shp_reader<> reader("shp_reader_points");
+    bg::shp_record<> const record = reader.record(0);
+    BOOST_CHECK_EQUAL(record.point_count(), 1u);
+    BOOST_CHECK_CLOSE(bg::get<0>(record.point()), 1.5, 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<1>(record.point()), 2.5, 0.0001);
+    BOOST_CHECK(record.has_z());
+    BOOST_CHECK_CLOSE(record.z(0), 3.5, 0.0001);
+
+    BOOST_CHECK_THROW(bg::shp_reader<> missing("shp_reader_missing"),
+                      bg::shp_read_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_polygons();
+    test_polylines();
+    test_points();
+
+    std::remove("shp_reader_polygons.shp");
+    std::remove("shp_reader_polygons.shx");
+    std::remove("shp_reader_polylines.shp");
+    std::remove("shp_reader_polylines.shx");
+    std::remove("shp_reader_points.shp");
+    std::remove("shp_reader_points.shx");
+
+    return 0;
+}
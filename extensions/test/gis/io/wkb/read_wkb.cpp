@@ -8,6 +8,7 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -26,6 +27,7 @@
 #include <boost/geometry/io/wkt/wkt.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
 #include <boost/assign/list_of.hpp>
+#include <boost/variant/variant.hpp>
 
 namespace bg = boost::geometry;
 
@@ -71,6 +73,30 @@ void test_geometry_equals(Geometry const& g_expected, std::string const& wkbhex)
         ", ACTUAL  : " << bg::wkt(g_wkb) );
 }
 
+template <typename Geometry>
+void test_geometry_wkt(std::string const& wkbhex, std::string const& wkt)
+{
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(wkbhex, std::back_inserter(wkb)) );
+
+    Geometry g_wkb;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), g_wkb) );
+
+    std::ostringstream out;
+    out << bg::wkt(g_wkb);
+    BOOST_CHECK_EQUAL(out.str(), wkt);
+}
+
+template <typename Geometry>
+void test_geometry_invalid(std::string const& wkbhex)
+{
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(wkbhex, std::back_inserter(wkb)) );
+
+    Geometry g_wkb;
+    BOOST_CHECK( ! bg::read_wkb(wkb.begin(), wkb.end(), g_wkb) );
+}
+
 //template <typename P, bool Result>
 //void test_polygon_wkt(std::string const& wkt)
 //{
@@ -270,5 +296,94 @@ int test_main(int, char* [])
 
     }
 
+    {
+        typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+        typedef bg::model::linestring<point_type> linestring_type;
+        typedef bg::model::polygon<point_type> polygon_type;
+        typedef bg::model::multi_point<point_type> multi_point_type;
+        typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+        typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+        std::string const point_ndr = "0101000000000000000000F03F0000000000000040";
+        std::string const point_xdr = "00000000013FF00000000000004000000000000000";
+        std::string const linestring_ndr = "010200000002000000"
+            "000000000000F03F0000000000000040"
+            "00000000000008400000000000001040";
+        std::string const polygon_ndr = "01030000000100000004000000"
+            "00000000000000000000000000000000"
+            "0000000000000000000000000000F03F"
+            "000000000000F03F0000000000000000"
+            "00000000000000000000000000000000";
+
+        test_geometry_wkt<point_type>(point_xdr, "POINT(1 2)");
+
+        //
+        // MULTIPOINT, of which the points have their own byte order
+        //
+        test_geometry_wkt<multi_point_type>(
+            "010400000002000000" + point_ndr + point_xdr,
+            "MULTIPOINT((1 2),(1 2))");
+        test_geometry_wkt<multi_point_type>(
+            "010400000000000000", "MULTIPOINT()");
+
+        //
+        // MULTILINESTRING
+        //
+        test_geometry_wkt<multi_linestring_type>(
+            "010500000002000000" + linestring_ndr + linestring_ndr,
+            "MULTILINESTRING((1 2,3 4),(1 2,3 4))");
+
+        //
+        // MULTIPOLYGON
+        //
+        test_geometry_wkt<multi_polygon_type>(
+            "010600000001000000" + polygon_ndr,
+            "MULTIPOLYGON(((0 0,0 1,1 0,0 0)))");
+
+        // Wrong type, truncated, or a too large number of geometries
+        test_geometry_invalid<multi_point_type>(point_ndr);
+        test_geometry_invalid<multi_point_type>("010400000002000000" + point_ndr);
+        test_geometry_invalid<multi_point_type>("0104000000FFFFFFFF" + point_ndr);
+        test_geometry_invalid<multi_polygon_type>(
+            "010600000001000000" + linestring_ndr);
+
+        //
+        // Variants and GEOMETRYCOLLECTION
+        //
+        typedef boost::variant
+            <
+                point_type, linestring_type, polygon_type, multi_point_type
+            > variant_type;
+
+        test_geometry_wkt<variant_type>(linestring_ndr, "LINESTRING(1 2,3 4)");
+        test_geometry_wkt<variant_type>(
+            "010400000001000000" + point_ndr, "MULTIPOINT((1 2))");
+        test_geometry_invalid<variant_type>(
+            "010600000001000000" + polygon_ndr);
+
+        {
+            byte_vector wkb;
+            bg::hex2wkb("010700000003000000" + point_xdr + polygon_ndr
+                + linestring_ndr, std::back_inserter(wkb));
+            std::vector<variant_type> collection;
+            BOOST_CHECK( bg::read_wkb_collection(wkb.begin(), wkb.end(), collection) );
+            BOOST_CHECK_EQUAL(collection.size(), 3u);
+
+            std::ostringstream out;
+            for (std::size_t i = 0; i < collection.size(); i++)
+            {
+                out << bg::wkt(collection[i]) << ";";
+            }
+            BOOST_CHECK_EQUAL(out.str(), "POINT(1 2);"
+                "POLYGON((0 0,0 1,1 0,0 0));LINESTRING(1 2,3 4);");
+
+            // Nested collections are not supported
+            wkb.clear();
+            bg::hex2wkb("010700000001000000010700000000000000",
+                        std::back_inserter(wkb));
+            BOOST_CHECK( ! bg::read_wkb_collection(wkb.begin(), wkb.end(), collection) );
+        }
+    }
+
     return 0;
 }
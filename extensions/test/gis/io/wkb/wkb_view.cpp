@@ -0,0 +1,164 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/test_exec_monitor.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+namespace bg = boost::geometry;
+
+typedef std::vector<boost::uint8_t> byte_vector;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::box<point_type> box_type;
+
+typedef bg::wkb_point_view<> point_view;
+typedef bg::wkb_linestring_view<> linestring_view;
+typedef bg::wkb_polygon_view<> polygon_view;
+
+
+template <typename Geometry>
+byte_vector to_wkb(Geometry const& geometry)
+{
+    byte_vector wkb;
+    bg::write_wkb(geometry, std::back_inserter(wkb));
+    return wkb;
+}
+
+template <typename View, typename Geometry>
+void check_box(View const& view, Geometry const& geometry)
+{
+    box_type b1, b2;
+    bg::envelope(view, b1);
+    bg::envelope(geometry, b2);
+    BOOST_CHECK(bg::equals(b1, b2));
+}
+
+void test_polygon(std::string const& wkt)
+{
+    polygon_type polygon;
+    bg::read_wkt(wkt, polygon);
+    byte_vector const wkb = to_wkb(polygon);
+
+    polygon_view view;
+    BOOST_CHECK(view.assign(&wkb[0], wkb.size()));
+    BOOST_CHECK_EQUAL(view.wkb_size(), wkb.size());
+
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(polygon));
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view), bg::num_interior_rings(polygon));
+    BOOST_CHECK_CLOSE(bg::area(view), bg::area(polygon), 1.0e-10);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(polygon), 1.0e-10);
+    check_box(view, polygon);
+
+    point_type const points[] = { point_type(1, 1), point_type(2.5, 2.5),
+                                  point_type(-1, 4), point_type(7, 7) };
+    for (std::size_t i = 0; i < sizeof(points) / sizeof(points[0]); i++)
+    {
+        BOOST_CHECK_EQUAL(bg::within(points[i], view),
+                          bg::within(points[i], polygon));
+        BOOST_CHECK_CLOSE(bg::distance(points[i], view) + 1.0,
+                          bg::distance(points[i], polygon) + 1.0, 1.0e-10);
+    }
+
+    // Truncated, or of another type
+    BOOST_CHECK(! view.assign(&wkb[0], wkb.size() - 1));
+    BOOST_CHECK(! linestring_view().assign(&wkb[0], wkb.size()));
+    BOOST_CHECK(! bg::wkb_polygon_view<3>().assign(&wkb[0], wkb.size()));
+}
+
+int test_main(int, char* [])
+{
+    // POINT, in both byte orders
+    {
+        byte_vector ndr, xdr;
+        bg::hex2wkb("0101000000000000000000F03F0000000000000040", std::back_inserter(ndr));
+        bg::hex2wkb("00000000013FF00000000000004000000000000000", std::back_inserter(xdr));
+
+        point_view p1, p2;
+        BOOST_CHECK(p1.assign(&ndr[0], ndr.size()));
+        BOOST_CHECK(p2.assign(&xdr[0], xdr.size()));
+        BOOST_CHECK_EQUAL(bg::get<0>(p1), 1.0);
+        BOOST_CHECK_EQUAL(bg::get<1>(p1), 2.0);
+        BOOST_CHECK_EQUAL(bg::get<0>(p2), 1.0);
+        BOOST_CHECK_EQUAL(bg::get<1>(p2), 2.0);
+        BOOST_CHECK_EQUAL(bg::distance(p1, point_type(4, 6)), 5.0);
+
+        BOOST_CHECK(! p1.assign(&ndr[0], ndr.size() - 1));
+    }
+
+    // LINESTRING, in both byte orders
+    {
+        byte_vector ndr, xdr;
+        bg::hex2wkb("010200000003000000"
+            "000000000000F03F0000000000000040"
+            "00000000000010400000000000001840"
+            "00000000000010400000000000002240", std::back_inserter(ndr));
+        bg::hex2wkb("000000000200000003"
+            "3FF00000000000004000000000000000"
+            "40100000000000004018000000000000"
+            "40100000000000004022000000000000", std::back_inserter(xdr));
+
+        linestring_view ls1, ls2;
+        BOOST_CHECK(ls1.assign(&ndr[0], ndr.size()));
+        BOOST_CHECK(ls2.assign(&xdr[0], xdr.size()));
+        BOOST_CHECK_EQUAL(ls1.wkb_size(), ndr.size());
+        BOOST_CHECK_EQUAL(boost::size(ls1), 3u);
+        BOOST_CHECK_EQUAL(bg::length(ls1), 8.0);
+        BOOST_CHECK_EQUAL(bg::length(ls2), 8.0);
+        BOOST_CHECK_EQUAL(bg::get<1>(ls2[2]), 9.0);
+
+        std::ostringstream out;
+        out << bg::wkt(ls2);
+        BOOST_CHECK_EQUAL(out.str(), "LINESTRING(1 2,4 6,4 9)");
+
+        linestring_type ls;
+        bg::read_wkt("LINESTRING(1 2,4 6,4 9)", ls);
+        check_box(ls1, ls);
+        BOOST_CHECK_EQUAL(bg::distance(point_type(0, 2), ls2), 1.0);
+
+        // The number of points does not fit
+        BOOST_CHECK(! ls1.assign(&ndr[0], ndr.size() - 8));
+    }
+
+    // POLYGON
+    test_polygon("POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_polygon("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 2,1 1),"
+                 "(3 3,4 3,4 4,3 4,3 3))");
+    {
+        polygon_type empty;
+        byte_vector const wkb = to_wkb(empty);
+        polygon_view view;
+        BOOST_CHECK(view.assign(&wkb[0], wkb.size()));
+        BOOST_CHECK_EQUAL(bg::num_points(view), 0u);
+        BOOST_CHECK_EQUAL(bg::area(view), 0.0);
+    }
+
+    return 0;
+}
@@ -22,7 +22,9 @@
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_writer.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
 
 #include <boost/geometry/io/wkt/wkt.hpp>
@@ -44,6 +46,94 @@ void test_geometry_equals(Geometry const& geometry, std::string const& wkbhex)
     BOOST_CHECK( bg::wkb2hex(wkb_out.begin(), wkb_out.end(), hex_out) );
 
     BOOST_CHECK_EQUAL( wkbhex, hex_out);
+
+    // The buffer writer should write the same, of the precomputed size
+    bg::wkb_writer writer;
+    std::vector<unsigned char> const& wkb = writer.write(geometry);
+    BOOST_CHECK_EQUAL(bg::wkb_size(geometry), wkb_out.size());
+    BOOST_CHECK_EQUAL(wkb.size(), wkb_out.size());
+    BOOST_CHECK( wkb == std::vector<unsigned char>(wkb_out.begin(), wkb_out.end()) );
+}
+
+template <typename Geometry>
+void test_big_endian(std::string const& wkt, std::string const& wkbhex)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::wkb_writer writer(bg::wkb_writer::big_endian);
+    std::vector<unsigned char> const& wkb = writer.write(geometry);
+
+    std::string hex_out;
+    BOOST_CHECK( bg::wkb2hex(wkb.begin(), wkb.end(), hex_out) );
+    BOOST_CHECK_EQUAL(wkbhex, hex_out);
+
+    Geometry read_back;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), read_back) );
+    bg::wkt_writer wkt_out;
+    std::string const expected = wkt_out.write(geometry);
+    BOOST_CHECK_EQUAL(expected, wkt_out.write(read_back));
+}
+
+template <typename Geometry>
+void test_multi(std::string const& wkt, std::string const& wkbhex)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    test_geometry_equals<Geometry, true>(geometry, wkbhex);
+}
+
+template <typename Polygon>
+void test_batch()
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+
+    std::vector<Polygon> polygons(3);
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", polygons[0]);
+    bg::read_wkt("POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1))", polygons[1]);
+    bg::read_wkt("POLYGON((5 5,5 6,6 5,5 5))", polygons[2]);
+
+    linestring_type linestring;
+    bg::read_wkt("LINESTRING(1 2,3 4)", linestring);
+
+    bg::wkb_batch_writer batch;
+    BOOST_CHECK_EQUAL(batch.count(), 0u);
+
+    // An empty range leaves the buffer empty
+    batch.append_range(std::vector<Polygon>());
+    BOOST_CHECK_EQUAL(batch.count(), 0u);
+    BOOST_CHECK( batch.buffer().empty() );
+
+    BOOST_CHECK_EQUAL(batch.append(linestring), 0u);
+    batch.append_range(polygons);
+    BOOST_CHECK_EQUAL(batch.append(polygons[0]), 4u);
+
+    BOOST_CHECK_EQUAL(batch.count(), 5u);
+    BOOST_CHECK_EQUAL(batch.offsets().size(), 6u);
+    BOOST_CHECK_EQUAL(batch.offsets().front(), 0u);
+    BOOST_CHECK_EQUAL(batch.offsets().back(), batch.buffer().size());
+    BOOST_CHECK_EQUAL(batch.wkb_size(0), bg::wkb_size(linestring));
+
+    bg::wkb_writer writer;
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        Polygon const& polygon = polygons[i % 3];
+        std::size_t const index = i == 3 ? 4 : i + 1;
+        std::vector<unsigned char> const& wkb = writer.write(polygon);
+
+        BOOST_CHECK_EQUAL(batch.wkb_size(index), wkb.size());
+        BOOST_CHECK( std::equal(wkb.begin(), wkb.end(), batch.wkb(index)) );
+
+        Polygon read_back;
+        BOOST_CHECK( bg::read_wkb(batch.wkb(index),
+                        batch.wkb(index) + batch.wkb_size(index), read_back) );
+        BOOST_CHECK( bg::equals(polygon, read_back) );
+    }
+
+    batch.clear();
+    BOOST_CHECK_EQUAL(batch.count(), 0u);
+    BOOST_CHECK( batch.buffer().empty() );
 }
 
 } // namespace anonymous
@@ -191,5 +281,53 @@ int test_main(int, char* [])
             );
     }
 
+    //
+    // MULTI
+    //
+
+    test_multi<bg::model::multi_point<point_type> >
+        (
+        "MULTIPOINT((1 2),(3 4))",
+        "0104000000020000000101000000000000000000F03F0000000000000040010100000000000000000008400000000000001040"
+        );
+
+    test_multi<bg::model::multi_linestring<linestring_type> >
+        (
+        "MULTILINESTRING((1 2,3 4))",
+        "010500000001000000010200000002000000000000000000F03F000000000000004000000000000008400000000000001040"
+        );
+
+    test_multi<bg::model::multi_polygon<polygon_type> >
+        (
+        "MULTIPOLYGON(((0 0,0 1,1 0,0 0)))",
+        "01060000000100000001030000000100000004000000000000000000000000000000000000000000000000000000000000000000F03F000000000000F03F000000000000000000000000000000000000000000000000"
+        );
+
+    // Points which are not stored as plain arrays of doubles
+    test_multi<bg::model::multi_point<bg::model::point<int, 2, bg::cs::cartesian> > >
+        (
+        "MULTIPOINT((1 2),(3 4))",
+        "0104000000020000000101000000000000000000F03F0000000000000040010100000000000000000008400000000000001040"
+        );
+
+    //
+    // BYTE ORDER
+    //
+
+    test_big_endian<point_type>("POINT(1 2)",
+        "00000000013FF00000000000004000000000000000");
+    test_big_endian<linestring_type>("LINESTRING(1 2,3 4)",
+        "0000000002000000023FF0000000000000400000000000000040080000000000004010000000000000");
+    test_big_endian<bg::model::multi_point<point_type> >("MULTIPOINT((1 2))",
+        "00000000040000000100000000013FF00000000000004000000000000000");
+
+    //
+    // BATCH
+    //
+
+    test_batch<polygon_type>();
+    test_batch<bg::model::polygon<bg::model::d2::point_xy<double> > >();
+    test_batch<bg::model::polygon<bg::model::point<float, 2, bg::cs::cartesian> > >();
+
     return 0;
 }
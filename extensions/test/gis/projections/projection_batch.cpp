@@ -0,0 +1,264 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/extensions/gis/latlong/point_ll.hpp>
+#include <boost/geometry/extensions/gis/projections/factory.hpp>
+#include <boost/geometry/extensions/gis/projections/parameters.hpp>
+#include <boost/geometry/extensions/gis/projections/project_transformer.hpp>
+#include <boost/geometry/extensions/gis/projections/projection.hpp>
+#include <boost/geometry/extensions/gis/projections/proj/merc.hpp>
+
+
+typedef bg::model::ll::point<bg::degree, double> lonlat_type;
+typedef bg::model::d2::point_xy<double> xy_type;
+typedef bg::projections::projection<lonlat_type, xy_type> projection_type;
+
+
+// Deterministic pseudo random coordinates, including poles and longitudes
+// outside [-180, 180]
+void make_points(std::size_t count, std::vector<double>& lon,
+                 std::vector<double>& lat)
+{
+    unsigned int state = 1;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        lon.push_back(static_cast<int>((state >> 8) % 4000) / 10.0 - 200.0);
+        state = state * 1103515245u + 12345u;
+        lat.push_back(static_cast<int>((state >> 8) % 1801) / 10.0 - 90.0);
+    }
+    lat[1] = 90.0;
+    lat[2] = -90.0;
+    lon[3] = 0.0;
+    lat[3] = 0.0;
+    lon[4] = 800.0;
+}
+
+void check_equal(std::string const& name, std::string const& axis,
+                 std::size_t i, double expected, double detected)
+{
+    double const tolerance = 1.0e-9
+        * (std::max)(1.0, bg::math::abs(expected));
+    BOOST_CHECK_MESSAGE(expected == detected
+                     || bg::math::abs(expected - detected) <= tolerance,
+        name << " " << axis << " point " << i << " expected: " << expected
+             << " detected: " << detected);
+}
+
+void test_projection(std::string const& name, std::string const& parameters)
+{
+    bg::projections::parameters params
+        = bg::projections::detail::pj_init_plus(parameters);
+    bg::projections::factory<lonlat_type, xy_type, bg::projections::parameters> pf;
+    boost::shared_ptr<projection_type> prj(pf.create_new(params));
+
+    // More than one block, and not a multiple of the block size
+    std::size_t const count = 1003;
+    std::vector<double> lon, lat;
+    make_points(count, lon, lat);
+
+    std::vector<double> x(count), y(count);
+    bool const all = prj->forward_n(&lon[0], &lat[0], &x[0], &y[0], count);
+
+    bool expected_all = true;
+    std::vector<double> valid_x, valid_y;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        lonlat_type ll;
+        ll.lon(lon[i]);
+        ll.lat(lat[i]);
+        xy_type xy;
+        if (! prj->forward(ll, xy))
+        {
+            expected_all = false;
+            BOOST_CHECK_MESSAGE(x[i] == HUGE_VAL && y[i] == HUGE_VAL,
+                name << " point " << i << " should fail");
+            continue;
+        }
+
+        check_equal(name, "x", i, bg::get<0>(xy), x[i]);
+        check_equal(name, "y", i, bg::get<1>(xy), y[i]);
+
+        if (bg::math::abs(bg::get<0>(xy)) < 1.0e8
+            && bg::math::abs(bg::get<1>(xy)) < 1.0e8)
+        {
+            valid_x.push_back(bg::get<0>(xy));
+            valid_y.push_back(bg::get<1>(xy));
+        }
+    }
+    BOOST_CHECK_EQUAL(all, expected_all);
+
+    // Inverse, of the points which were projected
+    std::size_t const valid_count = valid_x.size();
+    BOOST_CHECK(valid_count > count / 4);
+    std::vector<double> ilon(valid_count), ilat(valid_count);
+    prj->inverse_n(&valid_x[0], &valid_y[0], &ilon[0], &ilat[0], valid_count);
+    for (std::size_t i = 0; i < valid_count; i++)
+    {
+        xy_type const xy(valid_x[i], valid_y[i]);
+        lonlat_type ll;
+        if (! prj->inverse(xy, ll))
+        {
+            BOOST_CHECK_MESSAGE(ilon[i] == HUGE_VAL && ilat[i] == HUGE_VAL,
+                name << " inverse point " << i << " should fail");
+            continue;
+        }
+        check_equal(name, "lon", i, ll.lon(), ilon[i]);
+        check_equal(name, "lat", i, ll.lat(), ilat[i]);
+    }
+
+    // Nothing
+    BOOST_CHECK(prj->forward_n(&lon[0], &lat[0], &x[0], &y[0], 0));
+}
+
+void test_transform(std::string const& parameters)
+{
+    typedef bg::model::linestring<lonlat_type> ll_linestring;
+    typedef bg::model::linestring<xy_type> xy_linestring;
+
+    bg::projections::project_transformer<lonlat_type, xy_type>
+        transformer(parameters);
+
+    std::vector<double> lon, lat;
+    make_points(600, lon, lat);
+
+    ll_linestring ls;
+    for (std::size_t i = 0; i < lon.size(); i++)
+    {
+        // Within the range of transverse mercator
+        lonlat_type ll;
+        ll.lon(i == 4 ? 10.0 : lon[i] / 4.0);
+        ll.lat(lat[i] * 0.9);
+        ls.push_back(ll);
+    }
+
+    xy_linestring projected;
+    BOOST_CHECK(bg::transform(ls, projected, transformer));
+    BOOST_CHECK_EQUAL(projected.size(), ls.size());
+    for (std::size_t i = 0; i < ls.size() && i < projected.size(); i++)
+    {
+        xy_type expected;
+        transformer.apply(ls[i], expected);
+        check_equal(parameters, "x", i, bg::get<0>(expected), bg::get<0>(projected[i]));
+        check_equal(parameters, "y", i, bg::get<1>(expected), bg::get<1>(projected[i]));
+    }
+
+    // A point which fails: transform fails, as point by point
+    ls[300].lon(120.0);
+    ls[300].lat(90.0);
+    BOOST_CHECK(! bg::transform(ls, projected, transformer));
+}
+
+void test_static()
+{
+    bg::projections::parameters params
+        = bg::projections::detail::pj_init_plus("+proj=merc +ellps=WGS84 +units=m");
+    bg::projections::merc_ellipsoid<lonlat_type, xy_type> prj(params);
+
+    double const lon[3] = { 4.897, -180.0, 0.0 };
+    double const lat[3] = { 52.371, 10.0, 90.0 };
+    double x[3], y[3];
+
+    BOOST_CHECK(! prj.forward_n(lon, lat, x, y, 3));
+    BOOST_CHECK_CLOSE(x[0], 545131.546415, 0.001);
+    BOOST_CHECK_CLOSE(y[0], 6833623.829215, 0.001);
+    BOOST_CHECK(x[2] == HUGE_VAL && y[2] == HUGE_VAL);
+}
+
+// Projection which only implements the pure virtual functions, so it uses
+// the default forward_n / inverse_n, calling forward / inverse per point
+class point_by_point : public projection_type
+{
+public :
+    point_by_point(boost::shared_ptr<projection_type> const& prj) : m_prj(prj) {}
+
+    virtual bool forward(lonlat_type const& lp, xy_type& xy) const { return m_prj->forward(lp, xy); }
+    virtual bool inverse(xy_type const& xy, lonlat_type& lp) const { return m_prj->inverse(xy, lp); }
+    virtual void fwd(LL_T& lp_lon, LL_T& lp_lat, XY_T& xy_x, XY_T& xy_y) const { m_prj->fwd(lp_lon, lp_lat, xy_x, xy_y); }
+    virtual void inv(XY_T& xy_x, XY_T& xy_y, LL_T& lp_lon, LL_T& lp_lat) const { m_prj->inv(xy_x, xy_y, lp_lon, lp_lat); }
+    virtual std::string name() const { return m_prj->name(); }
+    virtual bg::projections::parameters const& params() const { return m_prj->params(); }
+    virtual bg::projections::parameters& mutable_params() { return m_prj->mutable_params(); }
+
+private :
+    boost::shared_ptr<projection_type> m_prj;
+};
+
+void test_default()
+{
+    bg::projections::parameters params
+        = bg::projections::detail::pj_init_plus("+proj=merc +ellps=WGS84 +units=m");
+    bg::projections::factory<lonlat_type, xy_type, bg::projections::parameters> pf;
+    boost::shared_ptr<projection_type> batched(pf.create_new(params));
+    point_by_point const prj(batched);
+
+    std::size_t const count = 300;
+    std::vector<double> lon, lat;
+    make_points(count, lon, lat);
+
+    std::vector<double> x1(count), y1(count), x2(count), y2(count);
+    BOOST_CHECK_EQUAL(prj.forward_n(&lon[0], &lat[0], &x1[0], &y1[0], count),
+                      batched->forward_n(&lon[0], &lat[0], &x2[0], &y2[0], count));
+    for (std::size_t i = 0; i < count; i++)
+    {
+        check_equal("default", "x", i, x2[i], x1[i]);
+        check_equal("default", "y", i, y2[i], y1[i]);
+    }
+
+    double const x[2] = { 545131.546415, 0.0 };
+    double const y[2] = { 6833623.829215, 0.0 };
+    double ilon[2], ilat[2];
+    BOOST_CHECK(prj.inverse_n(x, y, ilon, ilat, 2));
+    BOOST_CHECK_CLOSE(ilon[0], 4.897, 0.001);
+    BOOST_CHECK_CLOSE(ilat[0], 52.371, 0.001);
+    BOOST_CHECK_SMALL(ilon[1], 1.0e-9);
+    BOOST_CHECK_SMALL(ilat[1], 1.0e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_projection("merc", "+proj=merc +ellps=WGS84 +units=m");
+    test_projection("merc sphere", "+proj=merc +R=6371000 +lat_ts=30n +units=m");
+    test_projection("tmerc", "+proj=tmerc +ellps=WGS84 +units=m +lon_0=5 +x_0=500000");
+    test_projection("tmerc sphere", "+proj=tmerc +R=6371000 +units=m");
+    test_projection("etmerc", "+proj=etmerc +ellps=WGS84 +units=m");
+    test_projection("lcc", "+proj=lcc +ellps=WGS84 +units=m +lat_1=20n +lat_2=60n");
+    test_projection("lcc sphere", "+proj=lcc +R=6371000 +units=m +lat_1=20n +lat_2=60n");
+    test_projection("aea", "+proj=aea +ellps=WGS84 +units=m +lat_1=55 +lat_2=65");
+    test_projection("aea sphere", "+proj=aea +R=6371000 +units=m +lat_1=55 +lat_2=65");
+    test_projection("laea", "+proj=laea +ellps=WGS84 +units=m");
+    test_projection("laea oblique", "+proj=laea +ellps=WGS84 +units=m +lat_0=52 +lon_0=10");
+    test_projection("laea pole", "+proj=laea +ellps=WGS84 +units=m +lat_0=90");
+    test_projection("laea south pole", "+proj=laea +ellps=WGS84 +units=m +lat_0=-90");
+    test_projection("stere", "+proj=stere +ellps=WGS84 +units=m +lat_ts=30n");
+    test_projection("stere oblique", "+proj=stere +ellps=WGS84 +units=m +lat_0=52");
+    test_projection("stere pole", "+proj=stere +ellps=WGS84 +units=m +lat_0=90 +lat_ts=70");
+    test_projection("stere south pole", "+proj=stere +ellps=WGS84 +units=m +lat_0=-90");
+    test_projection("robin", "+proj=robin +ellps=WGS84 +units=m");
+
+    test_transform("+proj=tmerc +ellps=WGS84 +units=m");
+    test_transform("+proj=merc +ellps=WGS84 +units=m");
+
+    test_static();
+    test_default();
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/extensions/gis/latlong/point_ll.hpp>
+#include <boost/geometry/extensions/gis/projections/projection_cache.hpp>
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+
+typedef bg::model::ll::point<bg::degree, double> lonlat_type;
+typedef bg::model::d2::point_xy<double> xy_type;
+typedef bg::projections::projection_cache<lonlat_type, xy_type> cache_type;
+
+
+void test_normalize()
+{
+    BOOST_CHECK_EQUAL(bg::projections::detail::normalize_definition(
+            "  +proj=merc   +ellps=WGS84 +units=m "),
+        "+ellps=WGS84 +proj=merc +units=m");
+    BOOST_CHECK_EQUAL(bg::projections::detail::normalize_definition(
+            "+units=m +ellps=WGS84 +proj=merc"),
+        "+ellps=WGS84 +proj=merc +units=m");
+    // Same names keep their order
+    BOOST_CHECK_EQUAL(bg::projections::detail::normalize_definition(
+            "+proj=tmerc +k=2 +lon_0=3 +k=1"),
+        "+k=2 +k=1 +lon_0=3 +proj=tmerc");
+}
+
+void test_cache()
+{
+    cache_type cache;
+
+    cache_type::pointer_type merc1 = cache.get("+proj=merc +ellps=WGS84 +units=m");
+    cache_type::pointer_type merc2 = cache.get("+units=m  +proj=merc +ellps=WGS84");
+    cache_type::pointer_type tmerc = cache.get("+proj=tmerc +ellps=WGS84 +units=m");
+
+    BOOST_CHECK(merc1);
+    BOOST_CHECK(tmerc);
+    BOOST_CHECK(merc1 == merc2);
+    BOOST_CHECK(merc1 != tmerc);
+    BOOST_CHECK_EQUAL(cache.hits(), 1u);
+    BOOST_CHECK_EQUAL(cache.misses(), 2u);
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+    lonlat_type amsterdam;
+    amsterdam.lon(4.897);
+    amsterdam.lat(52.371);
+    xy_type xy;
+    BOOST_CHECK(merc2->forward(amsterdam, xy));
+    BOOST_CHECK_CLOSE(bg::get<0>(xy), 545131.546415, 0.001);
+    BOOST_CHECK_CLOSE(bg::get<1>(xy), 6833623.829215, 0.001);
+
+    // Unknown projections are not cached
+    BOOST_CHECK(! cache.get("+proj=unknown +ellps=WGS84"));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+    // EPSG codes
+    cache_type::pointer_type rd1 = cache.get(28992);
+    cache_type::pointer_type rd2 = cache.get(28992);
+    BOOST_CHECK(rd1);
+    BOOST_CHECK(rd1 == rd2);
+    BOOST_CHECK(! cache.get(1));
+    BOOST_CHECK_EQUAL(cache.size(), 3u);
+
+    // Projections in use stay valid
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+    BOOST_CHECK_EQUAL(cache.hits(), 0u);
+    BOOST_CHECK(tmerc->forward(amsterdam, xy));
+    BOOST_CHECK(cache.get("+proj=tmerc +ellps=WGS84 +units=m") != tmerc);
+}
+
+struct get_projection
+{
+    cache_type& cache;
+    std::vector<cache_type::pointer_type>& result;
+
+    void operator()(std::size_t i) const
+    {
+        static const char* definitions[3] =
+        {
+            "+proj=merc +ellps=WGS84 +units=m",
+            "+ellps=WGS84 +proj=merc +units=m",
+            "+proj=tmerc +ellps=WGS84 +units=m"
+        };
+        result[i] = cache.get(definitions[i % 3]);
+    }
+};
+
+void test_threads()
+{
+    cache_type cache;
+    std::size_t const count = 300;
+    std::vector<cache_type::pointer_type> result(count);
+    get_projection const function = { cache, result };
+    bg::detail::parallel::for_each_index(count, function, 4, 1);
+
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    BOOST_CHECK_EQUAL(cache.hits() + cache.misses(), count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        BOOST_CHECK(result[i] == result[i % 3 == 2 ? 2 : 0]);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_normalize();
+    test_cache();
+    test_threads();
+
+    return 0;
+}
@@ -56,15 +56,41 @@ private:
         typedef index::rtree<RTreeValueType, index::linear<8> > rtree_type;
 
         BOOST_GEOMETRY_ASSERT( rtree_first != rtree_last );
+
+        // create -- packing algorithm
+        rtree_type rt(rtree_first, rtree_last);
+
+        apply(rt, queries_first, queries_last, strategy,
+              rtree_min, qit_min, dist_min);
+    }
+
+public:
+    // queries an existing r-tree, which is, for example, kept
+    // by a prepared geometry
+    template
+    <
+        typename RTree,
+        typename QueryRangeIterator,
+        typename Strategy,
+        typename Distance
+    >
+    static inline void apply(RTree const& rt,
+                             QueryRangeIterator queries_first,
+                             QueryRangeIterator queries_last,
+                             Strategy const& strategy,
+                             typename RTree::value_type& rtree_min,
+                             QueryRangeIterator& qit_min,
+                             Distance& dist_min)
+    {
+        typedef typename RTree::value_type rtree_value_type;
+
+        BOOST_GEOMETRY_ASSERT( ! rt.empty() );
         BOOST_GEOMETRY_ASSERT( queries_first != queries_last );
 
         Distance const zero = Distance(0);
         dist_min = zero;
 
-        // create -- packing algorithm
-        rtree_type rt(rtree_first, rtree_last);
-
-        RTreeValueType t_v;
+        rtree_value_type t_v;
         bool first = true;
 
         for (QueryRangeIterator qit = queries_first;
@@ -83,7 +109,7 @@ private:
 
             Distance dist = dispatch::distance
                 <
-                    RTreeValueType,
+                    rtree_value_type,
                     typename std::iterator_traits
                         <
                             QueryRangeIterator
@@ -40,6 +40,7 @@
 #include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
 #include <boost/geometry/algorithms/detail/check_iterator_range.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
 
 #include <boost/geometry/algorithms/detail/disjoint/multirange_geometry.hpp>
 #include <boost/geometry/algorithms/detail/disjoint/linear_segment_or_box.hpp>
@@ -75,13 +76,20 @@ struct disjoint_no_intersections_policy<Geometry1, Geometry2, Tag1, multi_tag>
 {
     static inline bool apply(Geometry1 const& g1, Geometry2 const& g2)
     {
-        // TODO: use partition or rtree on g2
+        typedef typename point_type<Geometry1>::type point1_type;
+
+        // There are no intersections, so each linestring is either covered
+        // by g2 or not, and one point is sufficient to find out.
+        // The locator indexes the rings of g2, such that each point is
+        // only tested against the rings of which the envelope contains it.
+        detail::relate::point_in_areal<Geometry2> locator(g2);
+
         typedef typename boost::range_iterator<Geometry1 const>::type iterator;
         for ( iterator it = boost::begin(g1) ; it != boost::end(g1) ; ++it )
         {
-            typedef typename boost::range_value<Geometry1 const>::type value_type;
-            if ( ! disjoint_no_intersections_policy<value_type const, Geometry2>
-                    ::apply(*it, g2) )
+            point1_type p;
+            if ( geometry::point_on_border(p, *it)
+              && locator.apply(p) >= 0 )
             {
                 return false;
             }
@@ -0,0 +1,586 @@
+// Boost.Geometry
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_INVERSE_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_INVERSE_BATCH_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/radius.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/geometry/algorithms/detail/andoyer_inverse.hpp>
+#include <boost/geometry/algorithms/detail/flattening.hpp>
+#include <boost/geometry/algorithms/detail/thomas_inverse.hpp>
+#include <boost/geometry/algorithms/detail/vincenty_inverse.hpp>
+
+
+// Number of coordinate pairs processed together by the lane kernels
+#ifndef BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES
+#define BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES 8
+#endif
+
+
+namespace boost { namespace geometry { namespace detail
+{
+
+/*!
+\brief Solves the inverse problem of geodesics for arrays of coordinates
+\details The coordinates are given in radians, as separate arrays of
+    longitudes and latitudes (structure of arrays). Distances and/or azimuths
+    are written to the output arrays, which may be null if the corresponding
+    result is not enabled in the formula.
+    This scalar version calls the formula for each pair. It is used for
+    formulas without a lane kernel and for non floating point calculation
+    types.
+*/
+template <typename Inverse>
+struct inverse_batch_scalar
+{
+    template <typename Value, typename Spheroid>
+    static inline void apply(Value const* lon1, Value const* lat1,
+                             Value const* lon2, Value const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             Value* distance, Value* azimuth)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            typename Inverse::result_type const result
+                = Inverse::apply(lon1[i], lat1[i], lon2[i], lat2[i], spheroid);
+            if (distance != NULL)
+            {
+                distance[i] = result.distance;
+            }
+            if (azimuth != NULL)
+            {
+                azimuth[i] = result.azimuth;
+            }
+        }
+    }
+};
+
+
+// Lane kernels: pairs are processed in blocks of a fixed number of lanes.
+// The calculation is split into stages, each stage is a loop over the lanes,
+// without branches other than selects, which compilers can vectorize. Sine
+// and cosine of the same value are calculated in separate stages: compilers
+// combine them into sincos, which has no vectorized variant. Vectorized
+// trigonometric functions are used if available (e.g. glibc libmvec, used by
+// gcc with -ffast-math). The remaining pairs (less than a block) are
+// processed by the scalar formula.
+// The kernels evaluate the same expressions, in the same order, as the scalar
+// formulas. Therefore they give the same results, apart from differences
+// caused by compiler contraction of floating point operations (relative
+// differences below 1e-12). With -ffast-math the vectorized trigonometric
+// functions are less precise (up to 4 ulp), relative differences with the
+// scalar formulas are then below 1e-10.
+template <typename Kernel, typename Inverse>
+struct inverse_batch_lanes
+{
+    static const std::size_t lanes = BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES;
+
+    template <typename Value, typename Spheroid>
+    static inline void apply(Value const* lon1, Value const* lat1,
+                             Value const* lon2, Value const* lat2,
+                             std::size_t count,
+                             Spheroid const& spheroid,
+                             Value* distance, Value* azimuth)
+    {
+        std::size_t const blocked = count - count % lanes;
+        for (std::size_t i = 0; i < blocked; i += lanes)
+        {
+            Kernel::apply(lon1 + i, lat1 + i, lon2 + i, lat2 + i, spheroid,
+                          distance == NULL ? NULL : distance + i,
+                          azimuth == NULL ? NULL : azimuth + i);
+        }
+
+        inverse_batch_scalar<Inverse>::apply(lon1 + blocked, lat1 + blocked,
+                lon2 + blocked, lat2 + blocked, count - blocked, spheroid,
+                distance == NULL ? NULL : distance + blocked,
+                azimuth == NULL ? NULL : azimuth + blocked);
+    }
+};
+
+
+// Same as math::equals for finite values, without branches
+template <typename CT>
+inline bool lane_equals(CT const& a, CT const& b)
+{
+    CT const factor = (std::max)((std::max)(math::abs(a), math::abs(b)), CT(1));
+    return math::abs(a - b) <= std::numeric_limits<CT>::epsilon() * factor;
+}
+
+template <typename CT, std::size_t Lanes, typename Value>
+inline void lanes_fill(Value* values, CT const& value)
+{
+    if (values != NULL)
+    {
+        for (std::size_t j = 0; j < Lanes; ++j)
+        {
+            values[j] = value;
+        }
+    }
+}
+
+
+// Vincenty: the iteration continues until all lanes are converged.
+// Converged lanes are masked: they keep their values, exactly as if the
+// iteration stopped for them, as in the scalar formula.
+template <typename CT, bool EnableDistance, bool EnableAzimuth>
+struct vincenty_inverse_kernel
+{
+    static const std::size_t lanes = BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES;
+
+    template <typename Value, typename Spheroid>
+    static inline void apply(Value const* lon1, Value const* lat1,
+                             Value const* lon2, Value const* lat2,
+                             Spheroid const& spheroid,
+                             Value* distance, Value* azimuth)
+    {
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c3 = 3;
+        CT const c4 = 4;
+        CT const c16 = 16;
+        CT const c_e_12 = CT(1e-12);
+
+        CT const pi = geometry::math::pi<CT>();
+        CT const two_pi = c2 * pi;
+
+        CT const radius_a = CT(get_radius<0>(spheroid));
+        CT const radius_b = CT(get_radius<2>(spheroid));
+        CT const flattening = geometry::detail::flattening<CT>(spheroid);
+        CT const one_min_f = c1 - flattening;
+
+        // Masks are stored as values (0 or 1) of the calculation type,
+        // lanes of one type can be vectorized
+        CT equal[lanes];
+        CT active[lanes];
+        CT L[lanes];
+        CT lambda[lanes];
+        CT sin_U1[lanes], cos_U1[lanes], sin_U2[lanes], cos_U2[lanes];
+        CT sin_lambda[lanes], cos_lambda[lanes];
+        CT sin_sigma[lanes];
+        CT cos2_alpha[lanes], cos2_sigma_m[lanes], sigma[lanes];
+        CT sl[lanes], cl[lanes];
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            CT const lo1 = lon1[j];
+            CT const la1 = lat1[j];
+            CT const lo2 = lon2[j];
+            CT const la2 = lat2[j];
+
+            bool const e = lane_equals(la1, la2) && lane_equals(lo1, lo2);
+            equal[j] = e ? c1 : c0;
+            active[j] = e ? c0 : c1;
+
+            // lambda: difference in longitude on an auxiliary sphere
+            CT l = lo2 - lo1;
+            lambda[j] = l;
+            l = l < -pi ? l + two_pi : l;
+            l = l > pi ? l - two_pi : l;
+            L[j] = l;
+
+            // U: reduced latitude, defined by tan U = (1-f) tan phi
+            CT const tan_U1 = one_min_f * tan(la1); // above (1)
+            CT const tan_U2 = one_min_f * tan(la2); // above (1)
+
+            CT const temp_den_U1 = math::sqrt(c1 + math::sqr(tan_U1));
+            CT const temp_den_U2 = math::sqrt(c1 + math::sqr(tan_U2));
+            cos_U1[j] = c1 / temp_den_U1;
+            cos_U2[j] = c1 / temp_den_U2;
+            sin_U1[j] = tan_U1 / temp_den_U1;
+            sin_U2[j] = tan_U2 / temp_den_U2;
+
+            // Values of lanes which are not iterated (equal points)
+            sin_lambda[j] = cos_lambda[j] = c0;
+            sin_sigma[j] = c0;
+            cos2_alpha[j] = cos2_sigma_m[j] = sigma[j] = c0;
+        }
+
+        int counter = 0; // robustness
+        CT active_count = c1;
+
+        while (active_count > c0)
+        {
+            ++counter;
+
+            for (std::size_t j = 0; j < lanes; ++j)
+            {
+                sl[j] = sin(lambda[j]);
+            }
+            for (std::size_t j = 0; j < lanes; ++j)
+            {
+                cl[j] = cos(lambda[j]);
+            }
+
+            active_count = c0;
+            for (std::size_t j = 0; j < lanes; ++j)
+            {
+                CT const previous_lambda = lambda[j]; // (13)
+                CT const ss = math::sqrt(math::sqr(cos_U2[j] * sl[j]) + math::sqr(cos_U1[j] * sin_U2[j] - sin_U1[j] * cos_U2[j] * cl[j])); // (14)
+                CT const cs = sin_U1[j] * sin_U2[j] + cos_U1[j] * cos_U2[j] * cl[j]; // (15)
+                CT const sa = cos_U1[j] * cos_U2[j] * sl[j] / ss; // (17)
+                CT const c2a = c1 - math::sqr(sa);
+                CT const c2sm = lane_equals(c2a, c0) ? c0 : cs - c2 * sin_U1[j] * sin_U2[j] / c2a; // (18)
+
+                CT const C = flattening/c16 * c2a * (c4 + flattening * (c4 - c3 * c2a)); // (10)
+                CT const s = atan2(ss, cs); // (16)
+                CT const l = L[j] + (c1 - C) * flattening * sa *
+                    (s + C * ss * ( c2sm + C * cs * (-c1 + c2 * math::sqr(c2sm)))); // (11)
+
+                bool const a = active[j] > c0;
+                lambda[j] = a ? l : previous_lambda;
+                sin_lambda[j] = a ? sl[j] : sin_lambda[j];
+                cos_lambda[j] = a ? cl[j] : cos_lambda[j];
+                sin_sigma[j] = a ? ss : sin_sigma[j];
+                cos2_alpha[j] = a ? c2a : cos2_alpha[j];
+                cos2_sigma_m[j] = a ? c2sm : cos2_sigma_m[j];
+                sigma[j] = a ? s : sigma[j];
+
+                active[j] = a
+                         && geometry::math::abs(previous_lambda - l) > c_e_12
+                         && geometry::math::abs(l) < pi
+                         && counter < BOOST_GEOMETRY_DETAIL_VINCENTY_MAX_STEPS // robustness
+                          ? c1 : c0;
+                active_count += active[j];
+            }
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(EnableDistance) )
+        {
+            CT const c6 = 6;
+            CT const c47 = 47;
+            CT const c74 = 74;
+            CT const c128 = 128;
+            CT const c256 = 256;
+            CT const c175 = 175;
+            CT const c320 = 320;
+            CT const c768 = 768;
+            CT const c1024 = 1024;
+            CT const c4096 = 4096;
+            CT const c16384 = 16384;
+
+            for (std::size_t j = 0; j < lanes; ++j)
+            {
+                CT const sqr_u = cos2_alpha[j] * ( math::sqr(radius_a / radius_b) - c1 ); // above (1)
+
+                CT const A = c1 + sqr_u/c16384 * (c4096 + sqr_u * (-c768 + sqr_u * (c320 - c175 * sqr_u))); // (3)
+                CT const B = sqr_u/c1024 * (c256 + sqr_u * ( -c128 + sqr_u * (c74 - c47 * sqr_u))); // (4)
+                CT const delta_sigma = B * sin_sigma[j] * ( cos2_sigma_m[j] + (B/c4) * (cos(sigma[j])* (-c1 + c2 * cos2_sigma_m[j])
+                    - (B/c6) * cos2_sigma_m[j] * (-c3 + c4 * math::sqr(sin_sigma[j])) * (-c3 + c4 * cos2_sigma_m[j]))); // (6)
+
+                CT const d = radius_b * A * (sigma[j] - delta_sigma); // (19)
+                distance[j] = equal[j] > c0 ? c0 : d;
+            }
+        }
+        else
+        {
+            lanes_fill<CT, lanes>(distance, c0);
+        }
+
+        if ( BOOST_GEOMETRY_CONDITION(EnableAzimuth) )
+        {
+            for (std::size_t j = 0; j < lanes; ++j)
+            {
+                CT const a = atan2(cos_U2[j] * sin_lambda[j], cos_U1[j] * sin_U2[j] - sin_U1[j] * cos_U2[j] * cos_lambda[j]); // (20)
+                azimuth[j] = equal[j] > c0 ? c0 : a;
+            }
+        }
+        else
+        {
+            lanes_fill<CT, lanes>(azimuth, c0);
+        }
+    }
+};
+
+
+// Andoyer, distance only
+template <typename CT>
+struct andoyer_inverse_kernel
+{
+    static const std::size_t lanes = BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES;
+
+    template <typename Value, typename Spheroid>
+    static inline void apply(Value const* lon1, Value const* lat1,
+                             Value const* lon2, Value const* lat2,
+                             Spheroid const& spheroid,
+                             Value* distance, Value* azimuth)
+    {
+        CT const c0 = CT(0);
+        CT const c1 = CT(1);
+
+        CT const f = detail::flattening<CT>(spheroid);
+        CT const a = get_radius<0>(spheroid);
+
+        CT dlon[lanes];
+        CT sin_lat1[lanes], sin_lat2[lanes];
+        CT cos_lat1[lanes], cos_lat2[lanes], cos_dlon[lanes];
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            dlon[j] = CT(lon2[j]) - CT(lon1[j]);
+            sin_lat1[j] = sin(CT(lat1[j]));
+            sin_lat2[j] = sin(CT(lat2[j]));
+        }
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            cos_dlon[j] = cos(dlon[j]);
+            cos_lat1[j] = cos(CT(lat1[j]));
+            cos_lat2[j] = cos(CT(lat2[j]));
+        }
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            CT const lo1 = lon1[j];
+            CT const la1 = lat1[j];
+            CT const lo2 = lon2[j];
+            CT const la2 = lat2[j];
+
+            CT cos_d = sin_lat1[j]*sin_lat2[j] + cos_lat1[j]*cos_lat2[j]*cos_dlon[j];
+            // on some platforms cos_d may be outside valid range
+            cos_d = cos_d < -c1 ? -c1 : cos_d > c1 ? c1 : cos_d;
+
+            CT const d = acos(cos_d); // [0, pi]
+            CT const sin_d = sin(d);  // [-1, 1]
+
+            CT const K = math::sqr(sin_lat1[j]-sin_lat2[j]);
+            CT const L = math::sqr(sin_lat1[j]+sin_lat2[j]);
+            CT const three_sin_d = CT(3) * sin_d;
+
+            CT const one_minus_cos_d = c1 - cos_d;
+            CT const one_plus_cos_d = c1 + cos_d;
+
+            CT const H = lane_equals(one_minus_cos_d, c0) ?
+                            c0 :
+                            (d + three_sin_d) / one_minus_cos_d;
+            CT const G = lane_equals(one_plus_cos_d, c0) ?
+                            c0 :
+                            (d - three_sin_d) / one_plus_cos_d;
+
+            CT const dd = -(f/CT(4))*(H*K+G*L);
+
+            bool const equal = lane_equals(lo1, lo2) && lane_equals(la1, la2);
+            distance[j] = equal ? c0 : a * (d + dd);
+        }
+
+        lanes_fill<CT, lanes>(azimuth, c0);
+    }
+};
+
+
+// Thomas, distance only
+template <typename CT>
+struct thomas_inverse_kernel
+{
+    static const std::size_t lanes = BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES;
+
+    template <typename Value, typename Spheroid>
+    static inline void apply(Value const* lon1, Value const* lat1,
+                             Value const* lon2, Value const* lat2,
+                             Spheroid const& spheroid,
+                             Value* distance, Value* azimuth)
+    {
+        CT const c0 = CT(0);
+
+        CT const f = detail::flattening<CT>(spheroid);
+        CT const one_minus_f = CT(1) - f;
+        CT const pi_half = math::pi<CT>() / CT(2);
+        CT const a = get_radius<0>(spheroid);
+
+        CT theta_m[lanes], d_theta_m[lanes], d_lambda_m[lanes];
+        CT sin_theta_m[lanes], sin_d_theta_m[lanes], sin_d_lambda_m[lanes];
+        CT cos_theta_m[lanes], cos_d_theta_m[lanes];
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            CT const la1 = lat1[j];
+            CT const la2 = lat2[j];
+
+            // Points on the poles keep their latitude
+            CT const theta1 = lane_equals(math::abs(la1), pi_half) ? la1 :
+                              atan(one_minus_f * tan(la1));
+            CT const theta2 = lane_equals(math::abs(la2), pi_half) ? la2 :
+                              atan(one_minus_f * tan(la2));
+
+            theta_m[j] = (theta1 + theta2) / CT(2);
+            d_theta_m[j] = (theta2 - theta1) / CT(2);
+            d_lambda_m[j] = (CT(lon2[j]) - CT(lon1[j])) / CT(2);
+        }
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            sin_theta_m[j] = sin(theta_m[j]);
+            sin_d_theta_m[j] = sin(d_theta_m[j]);
+            sin_d_lambda_m[j] = sin(d_lambda_m[j]);
+        }
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            cos_theta_m[j] = cos(theta_m[j]);
+            cos_d_theta_m[j] = cos(d_theta_m[j]);
+        }
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            CT const lo1 = lon1[j];
+            CT const la1 = lat1[j];
+            CT const lo2 = lon2[j];
+            CT const la2 = lat2[j];
+
+            CT const sin2_theta_m = math::sqr(sin_theta_m[j]);
+            CT const cos2_theta_m = math::sqr(cos_theta_m[j]);
+            CT const sin2_d_theta_m = math::sqr(sin_d_theta_m[j]);
+            CT const cos2_d_theta_m = math::sqr(cos_d_theta_m[j]);
+            CT const sin2_d_lambda_m = math::sqr(sin_d_lambda_m[j]);
+
+            CT const H = cos2_theta_m - sin2_d_theta_m;
+            CT const L = sin2_d_theta_m + H * sin2_d_lambda_m;
+            CT const cos_d = CT(1) - CT(2) * L;
+            CT const d = acos(cos_d);
+            CT const sin_d = sin(d);
+
+            CT const one_minus_L = CT(1) - L;
+
+            CT const U = CT(2) * sin2_theta_m * cos2_d_theta_m / one_minus_L;
+            CT const V = CT(2) * sin2_d_theta_m * cos2_theta_m / L;
+            CT const X = U + V;
+            CT const Y = U - V;
+            CT const T = d / sin_d;
+
+            CT const delta1d = f * (T*X-Y) / CT(4);
+
+            // Equal points and degenerate cases give 0
+            CT result = a * sin_d * (T - delta1d);
+            result = lane_equals(sin_d, c0) ? c0 : result;
+            result = lane_equals(L, c0) ? c0 : result;
+            result = lane_equals(one_minus_L, c0) ? c0 : result;
+            result = lane_equals(lo1, lo2) && lane_equals(la1, la2) ? c0 : result;
+            distance[j] = result;
+        }
+
+        lanes_fill<CT, lanes>(azimuth, c0);
+    }
+};
+
+
+template <typename Inverse>
+struct inverse_batch
+    : inverse_batch_scalar<Inverse>
+{};
+
+template <typename CT, bool EnableDistance, bool EnableAzimuth>
+struct inverse_batch<vincenty_inverse<CT, EnableDistance, EnableAzimuth> >
+    : boost::mpl::if_c
+        <
+            boost::is_floating_point<CT>::value,
+            inverse_batch_lanes
+                <
+                    vincenty_inverse_kernel<CT, EnableDistance, EnableAzimuth>,
+                    vincenty_inverse<CT, EnableDistance, EnableAzimuth>
+                >,
+            inverse_batch_scalar
+                <
+                    vincenty_inverse<CT, EnableDistance, EnableAzimuth>
+                >
+        >::type
+{};
+
+template <typename CT>
+struct inverse_batch<andoyer_inverse<CT, true, false> >
+    : boost::mpl::if_c
+        <
+            boost::is_floating_point<CT>::value,
+            inverse_batch_lanes
+                <
+                    andoyer_inverse_kernel<CT>,
+                    andoyer_inverse<CT, true, false>
+                >,
+            inverse_batch_scalar<andoyer_inverse<CT, true, false> >
+        >::type
+{};
+
+template <typename CT>
+struct inverse_batch<thomas_inverse<CT, true, false> >
+    : boost::mpl::if_c
+        <
+            boost::is_floating_point<CT>::value,
+            inverse_batch_lanes
+                <
+                    thomas_inverse_kernel<CT>,
+                    thomas_inverse<CT, true, false>
+                >,
+            inverse_batch_scalar<thomas_inverse<CT, true, false> >
+        >::type
+{};
+
+
+/*!
+\brief Calculates the distances between pairs of points, taken from two
+    ranges, by an inverse formula, in batches
+\details The coordinates are gathered into arrays of radians, then the
+    distances are calculated by inverse_batch and written to the output
+*/
+template <typename Inverse, typename CT>
+struct inverse_batch_distances
+{
+    static const std::size_t block_size = 32 * BOOST_GEOMETRY_DETAIL_INVERSE_BATCH_LANES;
+
+    template
+    <
+        typename Iterator1, typename Iterator2,
+        typename OutputIterator, typename Spheroid
+    >
+    static inline OutputIterator apply(Iterator1 first1, Iterator1 last1,
+                                       Iterator2 first2, OutputIterator out,
+                                       Spheroid const& spheroid)
+    {
+        CT lon1[block_size], lat1[block_size];
+        CT lon2[block_size], lat2[block_size];
+        CT distance[block_size];
+
+        while (first1 != last1)
+        {
+            std::size_t count = 0;
+            for ( ; first1 != last1 && count < block_size;
+                  ++first1, ++first2, ++count)
+            {
+                lon1[count] = get_as_radian<0>(*first1);
+                lat1[count] = get_as_radian<1>(*first1);
+                lon2[count] = get_as_radian<0>(*first2);
+                lat2[count] = get_as_radian<1>(*first2);
+            }
+
+            inverse_batch<Inverse>::apply(lon1, lat1, lon2, lat2, count,
+                                          spheroid, distance,
+                                          static_cast<CT*>(NULL));
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                *out++ = distance[i];
+            }
+        }
+        return out;
+    }
+};
+
+
+}}} // namespace boost::geometry::detail
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_INVERSE_BATCH_HPP
@@ -12,7 +12,7 @@
 
 #include <cstddef>
 
-#include <set>
+#include <algorithm>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -30,131 +30,131 @@ namespace detail { namespace is_valid
 {
 
 
+// The complement graph has a vertex per ring (hole or outer space) and per
+// distinct turn point, and an edge between a ring and each turn point on it.
+// Vertices and edges are collected in vectors; equal turn points are merged
+// and duplicate edges are removed when the graph is inspected, using flat
+// (sorted) adjacency lists instead of sets of vertices and neighbors.
 template <typename TurnPoint>
-class complement_graph_vertex
+class complement_graph
 {
 public:
-    complement_graph_vertex(std::size_t id)
-        : m_id(id)
-        , m_turn_point(NULL)
-    {}
-
-    complement_graph_vertex(TurnPoint const* turn_point,
-                            std::size_t expected_id)
-        : m_id(expected_id)
-        , m_turn_point(turn_point)
-    {}
+    // handle of a vertex: a ring id, or a turn point id
+    // (num_rings + index of the added turn point), before merging
+    typedef std::size_t vertex_handle;
 
-    inline std::size_t id() const { return m_id; }
+private:
+    typedef std::pair<std::size_t, std::size_t> edge_type;
 
-    inline bool operator<(complement_graph_vertex const& other) const
+    // Adjacency lists, in compressed form: the neighbors of vertex v are
+    // neighbors[offsets[v]] .. neighbors[offsets[v + 1]]
+    struct adjacency
     {
-        if ( m_turn_point != NULL && other.m_turn_point != NULL )
-        {
-            return geometry::less
-                <
-                    TurnPoint
-                >()(*m_turn_point, *other.m_turn_point);
-        }
-        if ( m_turn_point == NULL && other.m_turn_point == NULL )
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> neighbors;
+
+        inline std::size_t num_vertices() const
         {
-            return m_id < other.m_id;
+            return offsets.size() - 1;
         }
-        return m_turn_point == NULL;
-    }
-
-private:
-    // the value of m_turn_point determines the type of the vertex
-    // non-NULL: vertex corresponds to an IP
-    // NULL    : vertex corresponds to a hole or outer space, and the id
-    //           is the ring id of the corresponding ring of the polygon
-    std::size_t m_id;
-    TurnPoint const* m_turn_point;
-};
-
-
-
-
-template <typename TurnPoint>
-class complement_graph
-{
-private:
-    typedef complement_graph_vertex<TurnPoint> vertex;
-    typedef std::set<vertex> vertex_container;
-
-public:
-    typedef typename vertex_container::const_iterator vertex_handle;
+    };
 
-private:
-    struct vertex_handle_less
+    struct less_by_turn_point
     {
-        inline bool operator()(vertex_handle v1, vertex_handle v2) const
+        less_by_turn_point(std::vector<TurnPoint const*> const& points)
+            : m_points(points)
+        {}
+
+        inline bool operator()(std::size_t left, std::size_t right) const
         {
-            return v1->id() < v2->id();
+            return geometry::less<TurnPoint>()(*m_points[left], *m_points[right]);
         }
-    };
 
-    typedef std::set<vertex_handle, vertex_handle_less> neighbor_container;
+        std::vector<TurnPoint const*> const& m_points;
+    };
 
-    class has_cycles_dfs_data
+    inline void build(adjacency& adj) const
     {
-    public:
-        has_cycles_dfs_data(std::size_t num_nodes)
-            : m_visited(num_nodes, false)
-            , m_parent_id(num_nodes, -1)
-        {}
-
-        inline signed_size_type parent_id(vertex_handle v) const
+        // Assign the same vertex id to equal turn points
+        std::size_t const num_points = m_turn_points.size();
+        std::vector<std::size_t> order(num_points);
+        for (std::size_t i = 0; i < num_points; i++)
         {
-            return m_parent_id[v->id()];
+            order[i] = i;
         }
+        less_by_turn_point const less(m_turn_points);
+        std::sort(order.begin(), order.end(), less);
 
-        inline void set_parent_id(vertex_handle v, signed_size_type id)
+        std::vector<std::size_t> ids(num_points);
+        std::size_t num_vertices = m_num_rings;
+        for (std::size_t i = 0; i < num_points; i++)
         {
-            m_parent_id[v->id()] = id;
+            if (i == 0 || less(order[i - 1], order[i]))
+            {
+                num_vertices++;
+            }
+            ids[order[i]] = num_vertices - 1;
         }
 
-        inline bool visited(vertex_handle v) const
+        // Collect the edges in both directions, without duplicates
+        std::vector<edge_type> edges;
+        edges.reserve(2 * m_edges.size());
+        for (std::size_t i = 0; i < m_edges.size(); i++)
         {
-            return m_visited[v->id()];
+            std::size_t const v1 = vertex_id(m_edges[i].first, ids);
+            std::size_t const v2 = vertex_id(m_edges[i].second, ids);
+            edges.push_back(edge_type(v1, v2));
+            edges.push_back(edge_type(v2, v1));
         }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-        inline void set_visited(vertex_handle v, bool value)
+        adj.offsets.assign(num_vertices + 1, 0);
+        adj.neighbors.resize(edges.size());
+        for (std::size_t i = 0; i < edges.size(); i++)
         {
-            m_visited[v->id()] = value;
+            adj.offsets[edges[i].first + 1]++;
+            adj.neighbors[i] = edges[i].second;
         }
-    private:
-        std::vector<bool> m_visited;
-        std::vector<signed_size_type> m_parent_id;
-    };
+        for (std::size_t v = 0; v < num_vertices; v++)
+        {
+            adj.offsets[v + 1] += adj.offsets[v];
+        }
+    }
 
+    inline std::size_t vertex_id(vertex_handle v,
+                                 std::vector<std::size_t> const& ids) const
+    {
+        return v < m_num_rings ? v : ids[v - m_num_rings];
+    }
 
-    inline bool has_cycles(vertex_handle start_vertex,
-                           has_cycles_dfs_data& data) const
+    static inline bool has_cycles(adjacency const& adj,
+                                  std::size_t start_vertex,
+                                  std::vector<bool>& visited,
+                                  std::vector<signed_size_type>& parent_id)
     {
-        std::stack<vertex_handle> stack;
+        std::stack<std::size_t, std::vector<std::size_t> > stack;
         stack.push(start_vertex);
 
         while ( !stack.empty() )
         {
-            vertex_handle v = stack.top();
+            std::size_t const v = stack.top();
             stack.pop();
 
-            data.set_visited(v, true);
-            for (typename neighbor_container::const_iterator nit
-                     = m_neighbors[v->id()].begin();
-                 nit != m_neighbors[v->id()].end(); ++nit)
+            visited[v] = true;
+            for (std::size_t i = adj.offsets[v]; i < adj.offsets[v + 1]; i++)
             {
-                if ( static_cast<signed_size_type>((*nit)->id()) != data.parent_id(v) )
+                std::size_t const n = adj.neighbors[i];
+                if ( static_cast<signed_size_type>(n) != parent_id[v] )
                 {
-                    if ( data.visited(*nit) )
+                    if ( visited[n] )
                     {
                         return true;
                     }
                     else
                     {
-                        data.set_parent_id(*nit, static_cast<signed_size_type>(v->id()));
-                        stack.push(*nit);
+                        parent_id[n] = static_cast<signed_size_type>(v);
+                        stack.push(n);
                     }
                 }
             }
@@ -166,54 +166,46 @@ public:
     // num_rings: total number of rings, including the exterior ring
     complement_graph(std::size_t num_rings)
         : m_num_rings(num_rings)
-        , m_num_turns(0)
-        , m_vertices()
-        , m_neighbors(num_rings)
     {}
 
-    // inserts a ring vertex in the graph and returns its handle
+    // returns the handle of a ring vertex
     // ring id's are zero-based (so the first interior ring has id 1)
     inline vertex_handle add_vertex(signed_size_type id)
     {
-        return m_vertices.insert(vertex(static_cast<std::size_t>(id))).first;
+        BOOST_GEOMETRY_ASSERT( id >= 0
+                            && static_cast<std::size_t>(id) < m_num_rings );
+        return static_cast<vertex_handle>(id);
     }
 
-    // inserts an IP in the graph and returns its id
+    // inserts an IP in the graph and returns its handle
+    // equal IPs are merged into one vertex
     inline vertex_handle add_vertex(TurnPoint const& turn_point)
     {
-        std::pair<vertex_handle, bool> res
-            = m_vertices.insert(vertex(boost::addressof(turn_point),
-                                       m_num_rings + m_num_turns)
-                                );
-
-        if ( res.second )
-        {
-            // a new element is inserted
-            m_neighbors.push_back(neighbor_container());
-            ++m_num_turns;
-        }
-        return res.first;
+        m_turn_points.push_back(boost::addressof(turn_point));
+        return m_num_rings + m_turn_points.size() - 1;
     }
 
     inline void add_edge(vertex_handle v1, vertex_handle v2)
     {
-        BOOST_GEOMETRY_ASSERT( v1 != m_vertices.end() );
-        BOOST_GEOMETRY_ASSERT( v2 != m_vertices.end() );
-        m_neighbors[v1->id()].insert(v2);
-        m_neighbors[v2->id()].insert(v1);
+        BOOST_GEOMETRY_ASSERT( v1 < m_num_rings + m_turn_points.size() );
+        BOOST_GEOMETRY_ASSERT( v2 < m_num_rings + m_turn_points.size() );
+        m_edges.push_back(edge_type(v1, v2));
     }
 
     inline bool has_cycles() const
     {
+        adjacency adj;
+        build(adj);
+
         // initialize all vertices as non-visited and with no parent set
-        // this is done by the constructor of has_cycles_dfs_data
-        has_cycles_dfs_data data(m_num_rings + m_num_turns);
+        std::size_t const num_vertices = adj.num_vertices();
+        std::vector<bool> visited(num_vertices, false);
+        std::vector<signed_size_type> parent_id(num_vertices, -1);
 
         // for each non-visited vertex, start a DFS from that vertex
-        for (vertex_handle it = m_vertices.begin();
-             it != m_vertices.end(); ++it)
+        for (std::size_t v = 0; v < num_vertices; v++)
         {
-            if ( !data.visited(it) && has_cycles(it, data) )
+            if ( !visited[v] && has_cycles(adj, v, visited, parent_id) )
             {
                 return true;
             }
@@ -226,9 +218,9 @@ public:
     void debug_print_complement_graph(OStream&, complement_graph<TP> const&);
 
 private:
-    std::size_t m_num_rings, m_num_turns;
-    vertex_container m_vertices;
-    std::vector<neighbor_container> m_neighbors;
+    std::size_t m_num_rings;
+    std::vector<TurnPoint const*> m_turn_points;
+    std::vector<edge_type> m_edges;
 };
 
 
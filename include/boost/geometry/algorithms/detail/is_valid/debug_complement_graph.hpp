@@ -27,29 +27,18 @@ inline void
 debug_print_complement_graph(OutputStream& os,
                              complement_graph<TurnPoint> const& graph)
 {
-    typedef typename complement_graph<TurnPoint>::vertex_handle vertex_handle;
+    typename complement_graph<TurnPoint>::adjacency adj;
+    graph.build(adj);
 
     os << "num rings: " << graph.m_num_rings << std::endl;
-    os << "vertex ids: {";
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
-    {
-        os << " " << it->id();
-    }
-    os << " }" << std::endl;        
+    os << "num vertices: " << adj.num_vertices() << std::endl;
 
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
+    for (std::size_t v = 0; v < adj.num_vertices(); ++v)
     {
-        os << "neighbors of " << it->id() << ": {";
-        for (typename complement_graph
-                 <
-                     TurnPoint
-                 >::neighbor_container::const_iterator
-                 nit = graph.m_neighbors[it->id()].begin();
-             nit != graph.m_neighbors[it->id()].end(); ++nit)
+        os << "neighbors of " << v << ": {";
+        for (std::size_t i = adj.offsets[v]; i < adj.offsets[v + 1]; ++i)
         {
-            os << " " << (*nit)->id();
+            os << " " << adj.neighbors[i];
         }
         os << "}" << std::endl;        
     }
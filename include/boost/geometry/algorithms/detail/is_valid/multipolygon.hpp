@@ -11,11 +11,14 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_MULTIPOLYGON_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_MULTIPOLYGON_HPP
 
+#include <cstddef>
 #include <deque>
+#include <iterator>
 #include <vector>
 
+#include <boost/core/addressof.hpp>
 #include <boost/core/ignore_unused.hpp>
-#include <boost/iterator/filter_iterator.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
 #include <boost/range.hpp>
 
 #include <boost/geometry/core/exterior_ring.hpp>
@@ -53,15 +56,81 @@ namespace detail { namespace is_valid
 {
 
 
+// The turns of which both operations are on the same polygon, grouped per
+// polygon (in their original order), such that the turns of one polygon
+// can be visited without visiting all turns
+template <typename Turn>
+class turns_per_polygon
+{
+    typedef std::vector<Turn const*> container_type;
+
+public:
+    typedef boost::indirect_iterator
+        <
+            typename container_type::const_iterator
+        > iterator;
+
+    template <typename TurnIterator>
+    turns_per_polygon(TurnIterator first, TurnIterator beyond,
+                      std::size_t polygon_count)
+        : m_offsets(polygon_count + 1, 0)
+    {
+        // Count the turns per polygon, then place them (counting sort)
+        for (TurnIterator it = first; it != beyond; ++it)
+        {
+            if (is_within_polygon(*it))
+            {
+                m_offsets[it->operations[0].seg_id.multi_index + 1]++;
+            }
+        }
+        for (std::size_t i = 0; i < polygon_count; i++)
+        {
+            m_offsets[i + 1] += m_offsets[i];
+        }
+
+        m_turns.resize(m_offsets.back());
+        std::vector<std::size_t> positions(m_offsets.begin(), m_offsets.end() - 1);
+        for (TurnIterator it = first; it != beyond; ++it)
+        {
+            if (is_within_polygon(*it))
+            {
+                m_turns[positions[it->operations[0].seg_id.multi_index]++]
+                    = boost::addressof(*it);
+            }
+        }
+    }
+
+    inline iterator begin(std::size_t multi_index) const
+    {
+        return iterator(m_turns.begin() + m_offsets[multi_index]);
+    }
+
+    inline iterator end(std::size_t multi_index) const
+    {
+        return iterator(m_turns.begin() + m_offsets[multi_index + 1]);
+    }
+
+private:
+    static inline bool is_within_polygon(Turn const& turn)
+    {
+        return turn.operations[0].seg_id.multi_index
+            == turn.operations[1].seg_id.multi_index;
+    }
+
+    container_type m_turns;
+    std::vector<std::size_t> m_offsets;
+};
+
+
 template <typename MultiPolygon, bool AllowEmptyMultiGeometries>
 class is_valid_multipolygon
-    : is_valid_polygon
+    : protected is_valid_polygon
         <
             typename boost::range_value<MultiPolygon>::type,
             true // check only the validity of rings
         >
 {
-private:
+protected:
     typedef is_valid_polygon
         <
             typename boost::range_value<MultiPolygon>::type,
@@ -85,21 +154,23 @@ private:
     {
         boost::ignore_unused(visitor);
 
-        // collect all polygons that have turns
-        std::set<signed_size_type> multi_indices;
+        // flag all polygons that have turns
+        std::vector<bool> has_turns(
+            static_cast<std::size_t>(std::distance(polygons_first, polygons_beyond)),
+            false);
         for (TurnIterator tit = turns_first; tit != turns_beyond; ++tit)
         {
-            multi_indices.insert(tit->operations[0].seg_id.multi_index);
-            multi_indices.insert(tit->operations[1].seg_id.multi_index);
+            has_turns[tit->operations[0].seg_id.multi_index] = true;
+            has_turns[tit->operations[1].seg_id.multi_index] = true;
         }
 
         // put polygon iterators without turns in a vector
         std::vector<PolygonIterator> polygon_iterators;
-        signed_size_type multi_index = 0;
+        std::size_t multi_index = 0;
         for (PolygonIterator it = polygons_first; it != polygons_beyond;
              ++it, ++multi_index)
         {
-            if (multi_indices.find(multi_index) == multi_indices.end())
+            if (! has_turns[multi_index])
             {
                 polygon_iterators.push_back(it);
             }
@@ -126,63 +197,27 @@ private:
 
 
 
-    class has_multi_index
-    {
-    public:
-        has_multi_index(signed_size_type multi_index)
-            : m_multi_index(multi_index)
-        {}
-
-        template <typename Turn>
-        inline bool operator()(Turn const& turn) const
-        {
-            return turn.operations[0].seg_id.multi_index == m_multi_index
-                && turn.operations[1].seg_id.multi_index == m_multi_index;
-        }
-
-    private:
-        signed_size_type const m_multi_index;
-    };
-
-
-
     template <typename Predicate>
     struct has_property_per_polygon
     {
         template
         <
             typename PolygonIterator,
-            typename TurnIterator,
+            typename TurnsPerPolygon,
             typename VisitPolicy
         >
         static inline bool apply(PolygonIterator polygons_first,
                                  PolygonIterator polygons_beyond,
-                                 TurnIterator turns_first,
-                                 TurnIterator turns_beyond,
+                                 TurnsPerPolygon const& turns_per_polygon,
                                  VisitPolicy& visitor)
         {
-            signed_size_type multi_index = 0;
+            std::size_t multi_index = 0;
             for (PolygonIterator it = polygons_first; it != polygons_beyond;
                  ++it, ++multi_index)
             {
-                has_multi_index index_predicate(multi_index);
-
-                typedef boost::filter_iterator
-                    <
-                        has_multi_index, TurnIterator
-                    > filtered_turn_iterator;
-
-                filtered_turn_iterator filtered_turns_first(index_predicate,
-                                                            turns_first,
-                                                            turns_beyond);
-
-                filtered_turn_iterator filtered_turns_beyond(index_predicate,
-                                                             turns_beyond,
-                                                             turns_beyond);
-
                 if (! Predicate::apply(*it,
-                                       filtered_turns_first,
-                                       filtered_turns_beyond,
+                                       turns_per_polygon.begin(multi_index),
+                                       turns_per_polygon.end(multi_index),
                                        visitor))
                 {
                     return false;
@@ -197,20 +232,19 @@ private:
     template
     <
         typename PolygonIterator,
-        typename TurnIterator,
+        typename TurnsPerPolygon,
         typename VisitPolicy
     >
     static inline bool have_holes_inside(PolygonIterator polygons_first,
                                          PolygonIterator polygons_beyond,
-                                         TurnIterator turns_first,
-                                         TurnIterator turns_beyond,
+                                         TurnsPerPolygon const& turns_per_polygon,
                                          VisitPolicy& visitor)
     {
         return has_property_per_polygon
             <
                 typename base::has_holes_inside
             >::apply(polygons_first, polygons_beyond,
-                     turns_first, turns_beyond, visitor);
+                     turns_per_polygon, visitor);
     }
 
 
@@ -218,20 +252,19 @@ private:
     template
     <
         typename PolygonIterator,
-        typename TurnIterator,
+        typename TurnsPerPolygon,
         typename VisitPolicy
     >
     static inline bool have_connected_interior(PolygonIterator polygons_first,
                                                PolygonIterator polygons_beyond,
-                                               TurnIterator turns_first,
-                                               TurnIterator turns_beyond,
+                                               TurnsPerPolygon const& turns_per_polygon,
                                                VisitPolicy& visitor)
     {
         return has_property_per_polygon
             <
                 typename base::has_connected_interior
             >::apply(polygons_first, polygons_beyond,
-                     turns_first, turns_beyond, visitor);
+                     turns_per_polygon, visitor);
     }
 
 
@@ -292,14 +325,18 @@ public:
         }
 
 
+        // group the turns per polygon, for the next two phases
+        turns_per_polygon<typename has_valid_turns::turn_type> const
+            polygon_turns(turns.begin(), turns.end(),
+                          boost::size(multipolygon));
+
         // check if each polygon's interior rings are inside the
         // exterior and not one inside the other
         debug_phase::apply(3);
 
         if (! have_holes_inside(boost::begin(multipolygon),
                                 boost::end(multipolygon),
-                                turns.begin(),
-                                turns.end(),
+                                polygon_turns,
                                 visitor))
         {
             return false;
@@ -311,8 +348,7 @@ public:
 
         if (! have_connected_interior(boost::begin(multipolygon),
                                       boost::end(multipolygon),
-                                      turns.begin(),
-                                      turns.end(),
+                                      polygon_turns,
                                       visitor))
         {
             return false;
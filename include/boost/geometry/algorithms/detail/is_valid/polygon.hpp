@@ -18,7 +18,6 @@
 #include <algorithm>
 #include <deque>
 #include <iterator>
-#include <set>
 #include <vector>
 
 #include <boost/core/ignore_unused.hpp>
@@ -191,20 +190,22 @@ protected:
     {
         boost::ignore_unused(visitor);
 
-        // collect the interior ring indices that have turns with the
-        // exterior ring
-        std::set<signed_size_type> ring_indices;
+        // flag the interior ring indices that have turns with the
+        // exterior ring (ring index -1 is the exterior ring, at position 0)
+        std::size_t const num_interior_rings
+            = static_cast<std::size_t>(std::distance(rings_first, rings_beyond));
+        std::vector<bool> has_turns(num_interior_rings + 1, false);
         for (TurnIterator tit = turns_first; tit != turns_beyond; ++tit)
         {
             if (tit->operations[0].seg_id.ring_index == -1)
             {
                 BOOST_GEOMETRY_ASSERT(tit->operations[1].seg_id.ring_index != -1);
-                ring_indices.insert(tit->operations[1].seg_id.ring_index);
+                has_turns[tit->operations[1].seg_id.ring_index + 1] = true;
             }
             else if (tit->operations[1].seg_id.ring_index == -1)
             {
                 BOOST_GEOMETRY_ASSERT(tit->operations[0].seg_id.ring_index != -1);
-                ring_indices.insert(tit->operations[0].seg_id.ring_index);
+                has_turns[tit->operations[0].seg_id.ring_index + 1] = true;
             }
         }
 
@@ -214,18 +215,18 @@ protected:
         {
             // do not examine interior rings that have turns with the
             // exterior ring
-            if (ring_indices.find(ring_index) == ring_indices.end()
+            if (! has_turns[ring_index + 1]
                 && ! geometry::covered_by(range::front(*it), exterior_ring))
             {
                 return visitor.template apply<failure_interior_rings_outside>();
             }
         }
 
-        // collect all rings (exterior and/or interior) that have turns
+        // flag all rings (exterior and/or interior) that have turns
         for (TurnIterator tit = turns_first; tit != turns_beyond; ++tit)
         {
-            ring_indices.insert(tit->operations[0].seg_id.ring_index);
-            ring_indices.insert(tit->operations[1].seg_id.ring_index);
+            has_turns[tit->operations[0].seg_id.ring_index + 1] = true;
+            has_turns[tit->operations[1].seg_id.ring_index + 1] = true;
         }
 
         // put iterators for interior rings without turns in a vector
@@ -234,7 +235,7 @@ protected:
         for (RingIterator it = rings_first; it != rings_beyond;
              ++it, ++ring_index)
         {
-            if (ring_indices.find(ring_index) == ring_indices.end())
+            if (! has_turns[ring_index + 1])
             {
                 ring_iterators.push_back(it);
             }
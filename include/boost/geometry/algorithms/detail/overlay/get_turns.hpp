@@ -21,6 +21,7 @@
 
 #include <boost/array.hpp>
 #include <boost/concept_check.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/vector_c.hpp>
 #include <boost/range.hpp>
@@ -46,6 +47,7 @@
 #include <boost/geometry/iterators/ever_circling_iterator.hpp>
 
 #include <boost/geometry/strategies/cartesian/cart_intersect.hpp>
+#include <boost/geometry/strategies/cartesian/cart_intersect_batch.hpp>
 #include <boost/geometry/strategies/intersection.hpp>
 #include <boost/geometry/strategies/intersection_result.hpp>
 
@@ -185,6 +187,11 @@ public :
     {
         boost::ignore_unused_variable_warning(interrupt_policy);
 
+        typedef boost::mpl::bool_
+            <
+                robust_types<RobustPolicy>::use_batch_filter
+            > use_batch_filter;
+
         if ((sec1.duplicate && (sec1.count + 1) < sec1.range_count)
            || (sec2.duplicate && (sec2.count + 1) < sec2.range_count))
         {
@@ -221,6 +228,13 @@ public :
         get_start_point_iterator(sec1, view1, prev1, it1, end1,
                     index1, ndi1, dir1, sec2.bounding_box, robust_policy);
 
+        // Collect the segments of section 2 (as visited below, for each
+        // segment of section 1) to filter disjoint pairs in one pass
+        batch_type batch2;
+        fill_batch(sec2, view2, dir2, sec1.bounding_box, robust_policy,
+                   batch2, use_batch_filter());
+        unsigned char disjoint[batch_capacity];
+
         // We need a circular iterator because it might run through the closing point.
         // One circle is actually enough but this one is just convenient.
         ever_circling_iterator<range1_iterator> next1(begin_range_1, end_range_1, it1, true);
@@ -237,6 +251,10 @@ public :
                     begin_range_1, end_range_1, next1, true);
             advance_to_non_duplicate_next(nd_next1, it1, sec1, robust_policy);
 
+            filter_batch(batch2, *prev1, *it1, robust_policy,
+                         disjoint, use_batch_filter());
+            std::size_t batch_index = 0;
+
             signed_size_type index2 = sec2.begin_index;
             signed_size_type ndi2 = sec2.non_duplicate_index;
 
@@ -249,8 +267,14 @@ public :
 
             for (prev2 = it2++, next2++;
                 it2 != end2 && ! detail::section::exceeding<0>(dir2, *prev2, sec1.bounding_box, robust_policy);
-                ++prev2, ++it2, ++index2, ++next2, ++ndi2)
+                ++prev2, ++it2, ++index2, ++next2, ++ndi2, ++batch_index)
             {
+                if (batch_index < batch2.count && disjoint[batch_index])
+                {
+                    // The segments are disjoint, no turn would be generated
+                    continue;
+                }
+
                 bool skip = same_source;
                 if (skip)
                 {
@@ -319,6 +343,100 @@ private :
     typedef typename model::referring_segment<point1_type const> segment1_type;
     typedef typename model::referring_segment<point2_type const> segment2_type;
 
+    // Sections are small (sectionalize uses at most 10 segments by default).
+    // Segments beyond the capacity are not filtered
+    static const std::size_t batch_capacity = 32;
+    typedef strategy::intersection::detail::segment_batch
+        <
+            batch_capacity
+        > batch_type;
+
+    template <typename RobustPolicy>
+    struct robust_types
+    {
+        typedef typename robust_point_type
+            <
+                point1_type, RobustPolicy
+            >::type robust_point1_type;
+        typedef typename robust_point_type
+            <
+                point2_type, RobustPolicy
+            >::type robust_point2_type;
+
+        // The filter calculates as relate_cartesian_segments, in double
+        static const bool use_batch_filter
+            = strategy::intersection::detail::is_batch_filter_coordinate
+                <
+                    typename geometry::coordinate_type<robust_point1_type>::type
+                >::value
+            && strategy::intersection::detail::is_batch_filter_coordinate
+                <
+                    typename geometry::coordinate_type<robust_point2_type>::type
+                >::value;
+    };
+
+    template <typename Section, typename View, typename Box, typename RobustPolicy>
+    static inline void fill_batch(Section const& section, View const& view,
+            int dir, Box const& other_bounding_box,
+            RobustPolicy const& robust_policy,
+            batch_type& batch, boost::mpl::true_)
+    {
+        typedef typename boost::range_iterator<View const>::type iterator_type;
+        typedef typename robust_types
+            <
+                RobustPolicy
+            >::robust_point2_type robust_point2_type;
+
+        iterator_type prev, it, end;
+        signed_size_type index = section.begin_index;
+        signed_size_type ndi = section.non_duplicate_index;
+        get_start_point_iterator(section, view, prev, it, end,
+                    index, ndi, dir, other_bounding_box, robust_policy);
+
+        // Same iteration as in apply
+        for (prev = it++;
+            it != end && ! batch.full()
+            && ! detail::section::exceeding<0>(dir, *prev, other_bounding_box, robust_policy);
+            ++prev, ++it)
+        {
+            robust_point2_type robust_prev, robust_it;
+            geometry::recalculate(robust_prev, *prev, robust_policy);
+            geometry::recalculate(robust_it, *it, robust_policy);
+            batch.push_back(robust_prev, robust_it);
+        }
+    }
+
+    template <typename Section, typename View, typename Box, typename RobustPolicy>
+    static inline void fill_batch(Section const& , View const& ,
+            int , Box const& , RobustPolicy const& ,
+            batch_type& , boost::mpl::false_)
+    {
+        // The batch stays empty, no segments are filtered
+    }
+
+    template <typename Point, typename RobustPolicy>
+    static inline void filter_batch(batch_type const& batch,
+            Point const& p1, Point const& p2,
+            RobustPolicy const& robust_policy,
+            unsigned char* disjoint, boost::mpl::true_)
+    {
+        typedef typename robust_types
+            <
+                RobustPolicy
+            >::robust_point1_type robust_point1_type;
+
+        robust_point1_type robust_p1, robust_p2;
+        geometry::recalculate(robust_p1, p1, robust_policy);
+        geometry::recalculate(robust_p2, p2, robust_policy);
+        batch.filter(robust_p1, robust_p2, disjoint);
+    }
+
+    template <typename Point, typename RobustPolicy>
+    static inline void filter_batch(batch_type const& ,
+            Point const& , Point const& , RobustPolicy const& ,
+            unsigned char* , boost::mpl::false_)
+    {}
+
     template <typename Iterator, typename RangeIterator, typename Section, typename RobustPolicy>
     static inline void advance_to_non_duplicate_next(Iterator& next,
             RangeIterator const& it, Section const& section, RobustPolicy const& robust_policy)
@@ -35,69 +35,59 @@ namespace boost { namespace geometry
 namespace detail { namespace overlay
 {
 
+// One operation of a turn, with a copy of its segment identifier and
+// fraction, to sort all operations on segment, fraction and type
 template <typename SegmentRatio>
 struct segment_fraction
 {
     segment_identifier seg_id;
     SegmentRatio fraction;
+    signed_size_type turn_index;
+    signed_size_type op_index; // only 0,1
 
-    segment_fraction(segment_identifier const& id, SegmentRatio const& fr)
+    segment_fraction(segment_identifier const& id, SegmentRatio const& fr,
+                     signed_size_type ti, signed_size_type oi)
         : seg_id(id)
         , fraction(fr)
+        , turn_index(ti)
+        , op_index(oi)
     {}
 
     segment_fraction()
+        : turn_index(-1)
+        , op_index(-1)
     {}
-
-    bool operator<(segment_fraction<SegmentRatio> const& other) const
-    {
-        return seg_id == other.seg_id
-                ? fraction < other.fraction
-                : seg_id < other.seg_id;
-    }
-
-};
-
-struct turn_operation_index
-{
-    turn_operation_index(signed_size_type ti = -1,
-                         signed_size_type oi = -1)
-        : turn_index(ti)
-        , op_index(oi)
-    {}
-
-    signed_size_type turn_index;
-    signed_size_type op_index; // only 0,1
 };
 
 
 template <typename Turns>
-struct less_by_fraction_and_type
+struct less_by_segment_fraction_and_type
 {
-    inline less_by_fraction_and_type(Turns const& turns)
+    inline less_by_segment_fraction_and_type(Turns const& turns)
         : m_turns(turns)
     {
     }
 
-    inline bool operator()(turn_operation_index const& left,
-                           turn_operation_index const& right) const
+    template <typename SegmentFraction>
+    inline bool operator()(SegmentFraction const& left,
+                           SegmentFraction const& right) const
     {
         typedef typename boost::range_value<Turns>::type turn_type;
         typedef typename turn_type::turn_operation_type turn_operation_type;
 
-        turn_type const& left_turn = m_turns[left.turn_index];
-        turn_type const& right_turn = m_turns[right.turn_index];
-        turn_operation_type const& left_op
-                = left_turn.operations[left.op_index];
-
-        turn_operation_type const& right_op
-                = right_turn.operations[right.op_index];
+        if (! (left.seg_id == right.seg_id))
+        {
+            return left.seg_id < right.seg_id;
+        }
 
-        if (! (left_op.fraction == right_op.fraction))
+        if (! (left.fraction == right.fraction))
         {
-            return left_op.fraction < right_op.fraction;
+            return left.fraction < right.fraction;
         }
 
+        turn_type const& left_turn = m_turns[left.turn_index];
+        turn_type const& right_turn = m_turns[right.turn_index];
+
         // Order xx first - used to discard any following colocated turn
         bool const left_both_xx = left_turn.both(operation_blocked);
         bool const right_both_xx = right_turn.both(operation_blocked);
@@ -136,55 +126,97 @@ private:
     Turns const& m_turns;
 };
 
-template <typename Operation, typename ClusterPerSegment>
-inline signed_size_type get_cluster_id(Operation const& op, ClusterPerSegment const& cluster_per_segment)
+// All operations of all turns, sorted, in one vector. Per operation
+// (turn_index * 2 + op_index) it keeps the index of the first sorted
+// operation on the same segment and fraction, and per such range of
+// operations the assigned cluster id. This replaces a map of clusters
+// per segment_fraction, lookups are direct
+template <typename SegmentRatio>
+struct segment_fractions
 {
-    typedef typename ClusterPerSegment::key_type segment_fraction_type;
+    typedef segment_fraction<SegmentRatio> item_type;
 
-    segment_fraction_type seg_frac(op.seg_id, op.fraction);
-    typename ClusterPerSegment::const_iterator it
-            = cluster_per_segment.find(seg_frac);
+    explicit segment_fractions(std::size_t turn_count)
+    {
+        sorted.reserve(2 * turn_count);
+        first_and_cluster.resize(4 * turn_count, -1);
+    }
 
-    if (it == cluster_per_segment.end())
+    // Calculates the first operation of each range with the same segment
+    // and fraction, to be called after sorting
+    inline void assign_ranges()
     {
-        return -1;
+        std::size_t first = 0;
+        for (std::size_t i = 0; i < sorted.size(); i++)
+        {
+            item_type const& item = sorted[i];
+            if (! (item.seg_id == sorted[first].seg_id)
+                || ! (item.fraction == sorted[first].fraction))
+            {
+                first = i;
+            }
+            first_and_cluster[2 * position(item.turn_index, item.op_index)]
+                = static_cast<signed_size_type>(first);
+        }
     }
-    return it->second;
-}
 
-template <typename Operation, typename ClusterPerSegment>
-inline void add_cluster_id(Operation const& op,
-    ClusterPerSegment& cluster_per_segment, signed_size_type id)
-{
-    typedef typename ClusterPerSegment::key_type segment_fraction_type;
+    inline signed_size_type get_cluster_id(signed_size_type turn_index,
+            signed_size_type op_index) const
+    {
+        return first_and_cluster[cluster_position(turn_index, op_index)];
+    }
 
-    segment_fraction_type seg_frac(op.seg_id, op.fraction);
+    inline void add_cluster_id(signed_size_type turn_index,
+            signed_size_type op_index, signed_size_type id)
+    {
+        first_and_cluster[cluster_position(turn_index, op_index)] = id;
+    }
 
-    cluster_per_segment[seg_frac] = id;
-}
+    std::vector<item_type> sorted;
+
+private :
 
-template <typename Turn, typename ClusterPerSegment>
-inline signed_size_type add_turn_to_cluster(Turn const& turn,
-        ClusterPerSegment& cluster_per_segment, signed_size_type& cluster_id)
+    static inline std::size_t position(signed_size_type turn_index,
+            signed_size_type op_index)
+    {
+        return static_cast<std::size_t>(turn_index * 2 + op_index);
+    }
+
+    // The cluster id of a range is stored at the slot of its first item
+    inline std::size_t cluster_position(signed_size_type turn_index,
+            signed_size_type op_index) const
+    {
+        item_type const& first = sorted[first_and_cluster[2 * position(turn_index, op_index)]];
+        return 2 * position(first.turn_index, first.op_index) + 1;
+    }
+
+    // Per operation: the index of the first sorted item of its range,
+    // and the cluster id of that range (if it is the first)
+    std::vector<signed_size_type> first_and_cluster;
+};
+
+template <typename SegmentFractions>
+inline signed_size_type add_turn_to_cluster(signed_size_type turn_index,
+        SegmentFractions& fractions, signed_size_type& cluster_id)
 {
-    signed_size_type cid0 = get_cluster_id(turn.operations[0], cluster_per_segment);
-    signed_size_type cid1 = get_cluster_id(turn.operations[1], cluster_per_segment);
+    signed_size_type cid0 = fractions.get_cluster_id(turn_index, 0);
+    signed_size_type cid1 = fractions.get_cluster_id(turn_index, 1);
 
     if (cid0 == -1 && cid1 == -1)
     {
         ++cluster_id;
-        add_cluster_id(turn.operations[0], cluster_per_segment, cluster_id);
-        add_cluster_id(turn.operations[1], cluster_per_segment, cluster_id);
+        fractions.add_cluster_id(turn_index, 0, cluster_id);
+        fractions.add_cluster_id(turn_index, 1, cluster_id);
         return cluster_id;
     }
     else if (cid0 == -1 && cid1 != -1)
     {
-        add_cluster_id(turn.operations[0], cluster_per_segment, cid1);
+        fractions.add_cluster_id(turn_index, 0, cid1);
         return cid1;
     }
     else if (cid0 != -1 && cid1 == -1)
     {
-        add_cluster_id(turn.operations[1], cluster_per_segment, cid0);
+        fractions.add_cluster_id(turn_index, 1, cid0);
         return cid0;
     }
     else if (cid0 == cid1)
@@ -203,58 +235,53 @@ template
 <
     bool Reverse1, bool Reverse2,
     typename Turns,
-    typename ClusterPerSegment,
-    typename Operations,
+    typename SegmentFractions,
     typename Geometry1,
     typename Geometry2
 >
 inline void handle_colocation_cluster(Turns& turns,
         signed_size_type& cluster_id,
-        ClusterPerSegment& cluster_per_segment,
-        Operations const& operations,
+        SegmentFractions& fractions,
+        std::size_t first, std::size_t last,
         Geometry1 const& /*geometry1*/, Geometry2 const& /*geometry2*/)
 {
     typedef typename boost::range_value<Turns>::type turn_type;
-    typedef typename turn_type::turn_operation_type turn_operation_type;
-
-    std::vector<turn_operation_index>::const_iterator vit = operations.begin();
+    typedef typename SegmentFractions::item_type segment_fraction_type;
 
-    turn_operation_index ref_toi = *vit;
+    std::size_t ref_index = first;
     signed_size_type ref_id = -1;
 
-    for (++vit; vit != operations.end(); ++vit)
+    for (std::size_t i = first + 1; i < last; i++)
     {
-        turn_type& ref_turn = turns[ref_toi.turn_index];
-        turn_operation_type const& ref_op
-                = ref_turn.operations[ref_toi.op_index];
+        segment_fraction_type const& ref_sf = fractions.sorted[ref_index];
+        segment_fraction_type const& sf = fractions.sorted[i];
 
-        turn_operation_index const& toi = *vit;
-        turn_type& turn = turns[toi.turn_index];
-        turn_operation_type const& op = turn.operations[toi.op_index];
+        turn_type& ref_turn = turns[ref_sf.turn_index];
+        turn_type& turn = turns[sf.turn_index];
 
-        BOOST_ASSERT(ref_op.seg_id == op.seg_id);
+        BOOST_ASSERT(ref_sf.seg_id == sf.seg_id);
 
-        if (ref_op.fraction == op.fraction)
+        if (ref_sf.fraction == sf.fraction)
         {
-            turn_operation_type const& other_op = turn.operations[1 - toi.op_index];
+            signed_size_type const other_op_index = 1 - sf.op_index;
 
             if (ref_id == -1)
             {
-                ref_id = add_turn_to_cluster(ref_turn, cluster_per_segment, cluster_id);
+                ref_id = add_turn_to_cluster(ref_sf.turn_index, fractions, cluster_id);
             }
             BOOST_ASSERT(ref_id != -1);
 
             // ref_turn (both operations) are already added to cluster,
             // so also "op" is already added to cluster,
             // We only need to add other_op
-            signed_size_type id = get_cluster_id(other_op, cluster_per_segment);
+            signed_size_type id = fractions.get_cluster_id(sf.turn_index, other_op_index);
             if (id != -1 && id != ref_id)
             {
             }
             else if (id == -1)
             {
                 // Add to same cluster
-                add_cluster_id(other_op, cluster_per_segment, ref_id);
+                fractions.add_cluster_id(sf.turn_index, other_op_index, ref_id);
                 id = ref_id;
             }
 
@@ -271,7 +298,7 @@ inline void handle_colocation_cluster(Turns& turns,
         {
             // Not on same fraction on this segment
             // assign for next
-            ref_toi = toi;
+            ref_index = i;
             ref_id = -1;
         }
     }
@@ -281,15 +308,13 @@ template
 <
     typename Turns,
     typename Clusters,
-    typename ClusterPerSegment
+    typename SegmentFractions
 >
 inline void assign_cluster_to_turns(Turns& turns,
         Clusters& clusters,
-        ClusterPerSegment const& cluster_per_segment)
+        SegmentFractions const& fractions)
 {
     typedef typename boost::range_value<Turns>::type turn_type;
-    typedef typename turn_type::turn_operation_type turn_operation_type;
-    typedef typename ClusterPerSegment::key_type segment_fraction_type;
 
     signed_size_type turn_index = 0;
     for (typename boost::range_iterator<Turns>::type it = turns.begin();
@@ -307,17 +332,15 @@ inline void assign_cluster_to_turns(Turns& turns,
 
         for (int i = 0; i < 2; i++)
         {
-            turn_operation_type const& op = turn.operations[i];
-            segment_fraction_type seg_frac(op.seg_id, op.fraction);
-            typename ClusterPerSegment::const_iterator it = cluster_per_segment.find(seg_frac);
-            if (it != cluster_per_segment.end())
+            signed_size_type const id = fractions.get_cluster_id(turn_index, i);
+            if (id != -1)
             {
                 if (turn.cluster_id != -1
-                        && turn.cluster_id != it->second)
+                        && turn.cluster_id != id)
                 {
                     std::cout << " CONFLICT " << std::endl;
                 }
-                turn.cluster_id = it->second;
+                turn.cluster_id = id;
                 clusters[turn.cluster_id].insert(turn_index);
             }
         }
@@ -339,7 +362,7 @@ inline void remove_clusters(Turns& turns, Clusters& clusters)
         typename Clusters::iterator current_it = it;
         ++it;
 
-        std::set<signed_size_type> const& turn_indices = current_it->second;
+        typename Clusters::mapped_type const& turn_indices = current_it->second;
         if (turn_indices.size() == 1)
         {
             signed_size_type turn_index = *turn_indices.begin();
@@ -368,36 +391,41 @@ template
 inline bool handle_colocations(Turns& turns, Clusters& clusters,
         Geometry1 const& geometry1, Geometry2 const& geometry2)
 {
-    typedef std::map
-        <
-            segment_identifier,
-            std::vector<turn_operation_index>
-        > map_type;
+    typedef typename boost::range_value<Turns>::type turn_type;
+    typedef typename turn_type::segment_ratio_type segment_ratio_type;
+    typedef segment_fractions<segment_ratio_type> fractions_type;
+    typedef typename fractions_type::item_type segment_fraction_type;
+    typedef std::vector<segment_fraction_type> sorted_type;
 
-    // Create and fill map on segment-identifier Map is sorted on seg_id,
-    // meaning it is sorted on ring_identifier too. This means that exterior
-    // rings are handled first. If there is a colocation on the exterior ring,
+    // Create and fill a vector with all operations. Sorted on seg_id,
+    // it is sorted on ring_identifier too. This means that exterior rings
+    // are handled first. If there is a colocation on the exterior ring,
     // that information can be used for the interior ring too
-    map_type map;
+    fractions_type fractions(boost::size(turns));
+    sorted_type& sorted = fractions.sorted;
 
-    int index = 0;
+    signed_size_type index = 0;
     for (typename boost::range_iterator<Turns>::type
             it = boost::begin(turns);
          it != boost::end(turns);
          ++it, ++index)
     {
-        map[it->operations[0].seg_id].push_back(turn_operation_index(index, 0));
-        map[it->operations[1].seg_id].push_back(turn_operation_index(index, 1));
+        for (int i = 0; i < 2; i++)
+        {
+            sorted.push_back(segment_fraction_type(it->operations[i].seg_id,
+                it->operations[i].fraction, index, i));
+        }
     }
 
+    std::sort(sorted.begin(), sorted.end(),
+              less_by_segment_fraction_and_type<Turns>(turns));
+
     // Check if there are multiple turns on one or more segments,
     // if not then nothing is to be done
-    bool colocations = 0;
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end();
-         ++it)
+    bool colocations = false;
+    for (std::size_t i = 1; i < sorted.size(); i++)
     {
-        if (it->second.size() > 1u)
+        if (sorted[i - 1].seg_id == sorted[i].seg_id)
         {
             colocations = true;
             break;
@@ -409,62 +437,52 @@ inline bool handle_colocations(Turns& turns, Clusters& clusters,
         return false;
     }
 
-    // Sort all vectors, per same segment
-    less_by_fraction_and_type<Turns> less(turns);
-    for (typename map_type::iterator it = map.begin();
-         it != map.end(); ++it)
-    {
-        std::sort(it->second.begin(), it->second.end(), less);
-    }
-
-    typedef typename boost::range_value<Turns>::type turn_type;
-    typedef typename turn_type::segment_ratio_type segment_ratio_type;
-
-    typedef std::map
-        <
-            segment_fraction<segment_ratio_type>,
-            signed_size_type
-        > cluster_per_segment_type;
+    fractions.assign_ranges();
 
-    cluster_per_segment_type cluster_per_segment;
     signed_size_type cluster_id = 0;
 
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end(); ++it)
+    // Handle each range of operations on the same segment
+    for (std::size_t first = 0; first < sorted.size(); )
     {
-        if (it->second.size() > 1u)
+        std::size_t last = first + 1;
+        while (last < sorted.size()
+               && sorted[last].seg_id == sorted[first].seg_id)
+        {
+            last++;
+        }
+
+        if (last - first > 1u)
         {
             handle_colocation_cluster<Reverse1, Reverse2>(turns, cluster_id,
-                cluster_per_segment, it->second,
-                geometry1, geometry2);
+                fractions, first, last, geometry1, geometry2);
         }
+        first = last;
     }
 
-    assign_cluster_to_turns(turns, clusters, cluster_per_segment);
+    assign_cluster_to_turns(turns, clusters, fractions);
     remove_clusters(turns, clusters);
 
 #if defined(BOOST_GEOMETRY_DEBUG_HANDLE_COLOCATIONS)
-    std::cout << "*** Colocations " << map.size() << std::endl;
-    for (typename map_type::const_iterator it = map.begin();
-         it != map.end(); ++it)
+    std::cout << "*** Colocations " << sorted.size() << std::endl;
+    for (typename sorted_type::const_iterator it = sorted.begin();
+         it != sorted.end(); ++it)
     {
-        std::cout << it->first << std::endl;
-        for (std::vector<turn_operation_index>::const_iterator vit
-             = it->second.begin(); vit != it->second.end(); ++vit)
+        if (it == sorted.begin() || ! (it->seg_id == (it - 1)->seg_id))
         {
-            turn_operation_index const& toi = *vit;
-            std::cout << geometry::wkt(turns[toi.turn_index].point)
-                << std::boolalpha
-                << " discarded=" << turns[toi.turn_index].discarded
-                << " colocated=" << turns[toi.turn_index].colocated
-                << " " << operation_char(turns[toi.turn_index].operations[0].operation)
-                << " "  << turns[toi.turn_index].operations[0].seg_id
-                << " "  << turns[toi.turn_index].operations[0].fraction
-                << " // " << operation_char(turns[toi.turn_index].operations[1].operation)
-                << " "  << turns[toi.turn_index].operations[1].seg_id
-                << " "  << turns[toi.turn_index].operations[1].fraction
-                << std::endl;
+            std::cout << it->seg_id << std::endl;
         }
+        turn_type const& turn = turns[it->turn_index];
+        std::cout << geometry::wkt(turn.point)
+            << std::boolalpha
+            << " discarded=" << turn.discarded
+            << " colocated=" << turn.colocated
+            << " " << operation_char(turn.operations[0].operation)
+            << " "  << turn.operations[0].seg_id
+            << " "  << turn.operations[0].fraction
+            << " // " << operation_char(turn.operations[1].operation)
+            << " "  << turn.operations[1].seg_id
+            << " "  << turn.operations[1].fraction
+            << std::endl;
     }
 #endif // DEBUG
 
@@ -515,7 +533,7 @@ inline void assign_startable_in_clusters(Clusters& clusters, Turns& turns,
     for (typename Clusters::iterator mit = clusters.begin();
          mit != clusters.end(); ++mit)
     {
-        std::set<signed_size_type> const& ids = mit->second;
+        typename Clusters::mapped_type const& ids = mit->second;
         if (ids.empty())
         {
             continue;
@@ -525,7 +543,7 @@ inline void assign_startable_in_clusters(Clusters& clusters, Turns& turns,
         point_type turn_point; // should be all the same for all turns in cluster
 
         bool first = true;
-        for (typename std::set<signed_size_type>::const_iterator sit = ids.begin();
+        for (typename Clusters::mapped_type::const_iterator sit = ids.begin();
              sit != ids.end(); ++sit)
         {
             signed_size_type turn_index = *sit;
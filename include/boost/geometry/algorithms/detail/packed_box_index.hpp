@@ -0,0 +1,265 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PACKED_BOX_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PACKED_BOX_INDEX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/point_box.hpp>
+#include <boost/geometry/algorithms/dispatch/disjoint.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+/*!
+\brief Static, bulk loaded, index of boxes (a packed R-tree)
+\details The boxes are sorted tile-wise (Sort-Tile-Recursive) and grouped
+    into nodes of at most node_size boxes, level by level. Queries report
+    the indices of the boxes not disjoint with a point or box.
+    This index is used inside algorithms (relate, disjoint) which are
+    themselves used by boost::geometry::index::rtree, and can therefore not
+    include the rtree.
+*/
+template <typename Box>
+class packed_box_index
+{
+    typedef typename coordinate_type<Box>::type coordinate_type;
+
+    struct node
+    {
+        Box box;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    template <std::size_t Dimension>
+    struct less_center
+    {
+        explicit less_center(std::vector<Box> const& boxes)
+            : m_boxes(boxes)
+        {}
+
+        inline bool operator()(std::size_t left, std::size_t right) const
+        {
+            return center(m_boxes[left]) < center(m_boxes[right]);
+        }
+
+        static inline coordinate_type center(Box const& box)
+        {
+            // Twice the center, sufficient to compare
+            return geometry::get<min_corner, Dimension>(box)
+                 + geometry::get<max_corner, Dimension>(box);
+        }
+
+        std::vector<Box> const& m_boxes;
+    };
+
+public:
+    static const std::size_t node_size = 16;
+
+    inline bool empty() const
+    {
+        return m_boxes.empty();
+    }
+
+    inline std::size_t size() const
+    {
+        return m_boxes.size();
+    }
+
+    inline void clear()
+    {
+        m_boxes.clear();
+        m_items.clear();
+        m_levels.clear();
+    }
+
+    //! Builds the index. Queries report positions in this vector
+    inline void assign(std::vector<Box> const& boxes)
+    {
+        clear();
+        m_boxes = boxes;
+
+        std::size_t const count = m_boxes.size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        m_items.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_items[i] = i;
+        }
+
+        // Sort on x, then on y within vertical slices of leaf nodes
+        std::size_t const leaf_count = (count + node_size - 1) / node_size;
+        std::size_t const slice_count = static_cast<std::size_t>(
+                std::ceil(std::sqrt(static_cast<double>(leaf_count))));
+        std::size_t const slice_size = slice_count * node_size;
+
+        std::sort(m_items.begin(), m_items.end(), less_center<0>(m_boxes));
+        for (std::size_t i = 0; i < count; i += slice_size)
+        {
+            std::sort(m_items.begin() + i,
+                      m_items.begin() + (std::min)(i + slice_size, count),
+                      less_center<1>(m_boxes));
+        }
+
+        // Leaf nodes refer to items
+        m_levels.push_back(std::vector<node>());
+        for (std::size_t i = 0; i < count; i += node_size)
+        {
+            node n;
+            n.first = i;
+            n.last = (std::min)(i + node_size, count);
+            n.box = m_boxes[m_items[i]];
+            for (std::size_t j = i + 1; j < n.last; ++j)
+            {
+                expand(n.box, m_boxes[m_items[j]]);
+            }
+            m_levels.back().push_back(n);
+        }
+
+        // Upper nodes refer to nodes of the level below
+        while (m_levels.back().size() > node_size)
+        {
+            std::vector<node> const& below = m_levels.back();
+            std::vector<node> level;
+            for (std::size_t i = 0; i < below.size(); i += node_size)
+            {
+                node n;
+                n.first = i;
+                n.last = (std::min)(i + node_size, below.size());
+                n.box = below[i].box;
+                for (std::size_t j = i + 1; j < n.last; ++j)
+                {
+                    expand(n.box, below[j].box);
+                }
+                level.push_back(n);
+            }
+            m_levels.push_back(level);
+        }
+    }
+
+    /*!
+    \brief Visits the indices of all boxes not disjoint with the geometry
+        (a point or a box)
+    \details The visitor is called with the index of the box and returns
+        false to stop the query
+    \return false if the query was stopped by the visitor
+    */
+    template <typename Geometry, typename Visitor>
+    inline bool visit(Geometry const& geometry, Visitor& visitor) const
+    {
+        if (m_levels.empty())
+        {
+            return true;
+        }
+
+        std::size_t const top = m_levels.size() - 1;
+        for (std::size_t i = 0; i < m_levels[top].size(); ++i)
+        {
+            if (! visit_node(geometry, visitor, top, i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Appends the indices of all boxes not disjoint with the geometry
+    template <typename Geometry>
+    inline void query(Geometry const& geometry,
+                      std::vector<std::size_t>& result) const
+    {
+        collector c(result);
+        visit(geometry, c);
+    }
+
+private:
+
+    struct collector
+    {
+        explicit collector(std::vector<std::size_t>& result)
+            : m_result(result)
+        {}
+
+        inline bool operator()(std::size_t index)
+        {
+            m_result.push_back(index);
+            return true;
+        }
+
+        std::vector<std::size_t>& m_result;
+    };
+
+    static inline void expand(Box& box, Box const& other)
+    {
+        geometry::expand(box, other);
+    }
+
+    template <typename Geometry>
+    static inline bool disjoint(Geometry const& geometry, Box const& box)
+    {
+        return dispatch::disjoint<Geometry, Box>::apply(geometry, box);
+    }
+
+    template <typename Geometry, typename Visitor>
+    inline bool visit_node(Geometry const& geometry, Visitor& visitor,
+                           std::size_t level, std::size_t index) const
+    {
+        node const& n = m_levels[level][index];
+        if (disjoint(geometry, n.box))
+        {
+            return true;
+        }
+
+        for (std::size_t i = n.first; i < n.last; ++i)
+        {
+            if (level > 0)
+            {
+                if (! visit_node(geometry, visitor, level - 1, i))
+                {
+                    return false;
+                }
+            }
+            else if (! disjoint(geometry, m_boxes[m_items[i]])
+                  && ! visitor(m_items[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<Box> m_boxes;
+    std::vector<std::size_t> m_items;
+    std::vector<std::vector<node> > m_levels;
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PACKED_BOX_INDEX_HPP
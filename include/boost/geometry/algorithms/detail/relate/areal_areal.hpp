@@ -25,6 +25,7 @@
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
@@ -35,16 +36,16 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
     
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiPolygon/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// NOTE: calling this Pred in a loop for MultiPolygon/MultiPolygon would take O(NM)
+// if all rings were visited, point_in_areal uses an rtree of ring envelopes
+// for geometries with many rings
 
 // may be used to set EI and EB for an Areal geometry for which no turns were generated
 template <typename OtherAreal, typename Result, bool TransposeResult>
 class no_turns_aa_pred
 {
 public:
-    no_turns_aa_pred(OtherAreal const& other_areal, Result & res)
+    no_turns_aa_pred(point_in_areal<OtherAreal> & other_areal, Result & res)
         : m_result(res)
         , m_other_areal(other_areal)
         , m_flags(0)
@@ -85,9 +86,7 @@ public:
         }
 
         // check if the areal is inside the other_areal
-        // TODO: This is O(N)
-        // Run in a loop O(NM) - optimize!
-        int const pig = detail::within::point_in_geometry(pt, m_other_areal);
+        int const pig = m_other_areal.apply(pt);
         //BOOST_GEOMETRY_ASSERT( pig != 0 );
         
         // inside
@@ -117,9 +116,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = detail::within::point_in_geometry(range::front(range_ref), m_other_areal);
+                int const hpig = m_other_areal.apply(range::front(range_ref));
 
                 // hole outside
                 if ( hpig < 0 )
@@ -153,9 +150,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = detail::within::point_in_geometry(range::front(range_ref), m_other_areal);
+                int const hpig = m_other_areal.apply(range::front(range_ref));
 
                 // hole inside
                 if ( hpig > 0 )
@@ -174,7 +169,7 @@ public:
 
 private:
     Result & m_result;
-    OtherAreal const& m_other_areal;
+    point_in_areal<OtherAreal> & m_other_areal;
     int m_flags;
 };
 
@@ -212,12 +207,17 @@ struct areal_areal
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
-        no_turns_aa_pred<Geometry2, Result, false> pred1(geometry2, result);
+        // point in geometry checks for rings without turns,
+        // shared by the predicates and analysers below
+        point_in_areal<Geometry1> point_in_areal1(geometry1);
+        point_in_areal<Geometry2> point_in_areal2(geometry2);
+
+        no_turns_aa_pred<Geometry2, Result, false> pred1(point_in_areal2, result);
         for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
-        no_turns_aa_pred<Geometry1, Result, true> pred2(geometry1, result);
+        no_turns_aa_pred<Geometry1, Result, true> pred2(point_in_areal1, result);
         for_each_disjoint_geometry_if<1, Geometry2>::apply(turns.begin(), turns.end(), geometry2, pred2);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
@@ -256,7 +256,7 @@ struct areal_areal
             {
                 // analyse rings for which turns were not generated
                 // or only i/i or u/u was generated
-                uncertain_rings_analyser<0, Result, Geometry1, Geometry2> rings_analyser(result, geometry1, geometry2);
+                uncertain_rings_analyser<0, Result, Geometry1, Geometry2> rings_analyser(result, geometry1, point_in_areal2);
                 analyse_uncertain_rings<0>::apply(rings_analyser, turns.begin(), turns.end());
 
                 if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
@@ -295,7 +295,7 @@ struct areal_areal
             {
                 // analyse rings for which turns were not generated
                 // or only i/i or u/u was generated
-                uncertain_rings_analyser<1, Result, Geometry2, Geometry1> rings_analyser(result, geometry2, geometry1);
+                uncertain_rings_analyser<1, Result, Geometry2, Geometry1> rings_analyser(result, geometry2, point_in_areal1);
                 analyse_uncertain_rings<1>::apply(rings_analyser, turns.begin(), turns.end());
 
                 //if ( result.interrupt )
@@ -574,7 +574,7 @@ struct areal_areal
     public:
         inline uncertain_rings_analyser(Result & result,
                                         Geometry const& geom,
-                                        OtherGeometry const& other_geom)
+                                        point_in_areal<OtherGeometry> & other_geom)
             : geometry(geom), other_geometry(other_geom)
             , interrupt(result.interrupt) // just in case, could be false as well
             , m_result(result)
@@ -622,9 +622,7 @@ struct areal_areal
             // if the range is an interior ring we may use other IPs generated for this single geometry
             // to know which other single geometries should be checked
 
-            // TODO: optimize! e.g. use spatial index
-            // O(N) - running it in a loop gives O(NM)
-            int const pig = detail::within::point_in_geometry(range::front(range_ref), other_geometry);
+            int const pig = other_geometry.apply(range::front(range_ref));
 
             //BOOST_GEOMETRY_ASSERT(pig != 0);
             if ( pig > 0 )
@@ -708,7 +706,7 @@ struct areal_areal
         }
 
         Geometry const& geometry;
-        OtherGeometry const& other_geometry;
+        point_in_areal<OtherGeometry> & other_geometry;
         bool interrupt;
 
     private:
@@ -29,6 +29,7 @@
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
@@ -41,9 +42,9 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
 
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiLinestring/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// NOTE: calling this Pred in a loop for MultiLinestring/MultiPolygon would take O(NM)
+// if all rings were visited, point_in_areal uses an rtree of ring envelopes
+// for geometries with many rings
 
 // may be used to set IE and BE for a Linear geometry for which no turns were generated
 template <typename Geometry2, typename Result, typename BoundaryChecker, bool TransposeResult>
@@ -53,7 +54,7 @@ public:
     no_turns_la_linestring_pred(Geometry2 const& geometry2,
                                 Result & res,
                                 BoundaryChecker const& boundary_checker)
-        : m_geometry2(geometry2)
+        : m_point_in_areal2(geometry2)
         , m_result(res)
         , m_boundary_checker(boundary_checker)
         , m_interrupt_flags(0)
@@ -98,7 +99,7 @@ public:
             return false;
         }
 
-        int const pig = detail::within::point_in_geometry(range::front(linestring), m_geometry2);
+        int const pig = m_point_in_areal2.apply(range::front(linestring));
         //BOOST_GEOMETRY_ASSERT_MSG(pig != 0, "There should be no IPs");
 
         if ( pig > 0 )
@@ -136,7 +137,7 @@ public:
     }
 
 private:
-    Geometry2 const& m_geometry2;
+    point_in_areal<Geometry2> m_point_in_areal2;
     Result & m_result;
     BoundaryChecker const& m_boundary_checker;
     unsigned m_interrupt_flags;
@@ -0,0 +1,230 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/detail/packed_box_index.hpp>
+#include <boost/geometry/algorithms/detail/ring_identifier.hpp>
+#include <boost/geometry/algorithms/detail/sub_range.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+
+template <typename Areal, typename Tag = typename tag<Areal>::type>
+struct areal_rings
+{
+    // ring
+    static inline void apply(Areal const& , std::vector<ring_identifier>& ids)
+    {
+        ids.push_back(ring_identifier(0, -1, -1));
+    }
+};
+
+template <typename Polygon>
+struct areal_rings<Polygon, polygon_tag>
+{
+    static inline void apply(Polygon const& polygon,
+                             std::vector<ring_identifier>& ids,
+                             signed_size_type multi_index = -1)
+    {
+        ring_identifier id(0, multi_index, -1);
+        ids.push_back(id);
+
+        std::size_t const count = geometry::num_interior_rings(polygon);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            id.ring_index = static_cast<signed_size_type>(i);
+            ids.push_back(id);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct areal_rings<MultiPolygon, multi_polygon_tag>
+{
+    static inline void apply(MultiPolygon const& multi_polygon,
+                             std::vector<ring_identifier>& ids)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        signed_size_type index = 0;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon);
+             ++it, ++index)
+        {
+            areal_rings<polygon_type>::apply(*it, ids, index);
+        }
+    }
+};
+
+
+// Same result as detail::within::point_in_geometry(point, areal):
+//  1 - in the interior
+//  0 - on the boundary
+// -1 - in the exterior
+// For areal geometries with many rings the first call builds a packed index
+// of ring envelopes (the rtree cannot be used, it depends on relate).
+// Afterwards only the rings of which the envelope contains the point are
+// visited, instead of all rings of all polygons. Polygons and holes are
+// visited in their original order, so the result is the same for invalid
+// (e.g. overlapping) input as well.
+template <typename Areal>
+class point_in_areal
+{
+    typedef typename geometry::point_type<Areal>::type point_type;
+    typedef model::box<point_type> box_type;
+
+    static const bool indexable = boost::is_same
+        <
+            typename cs_tag<point_type>::type, cartesian_tag
+        >::value;
+
+public:
+    // Below this number of rings, visiting all rings is as fast
+    static const std::size_t min_indexed_rings = 16;
+
+    explicit point_in_areal(Areal const& areal)
+        : m_areal(areal)
+        , m_initialized(false)
+    {}
+
+    template <typename Point>
+    inline int apply(Point const& point)
+    {
+        if (! indexable)
+        {
+            return detail::within::point_in_geometry(point, m_areal);
+        }
+
+        if (! m_initialized)
+        {
+            initialize();
+        }
+
+        if (m_rings.size() < min_indexed_rings)
+        {
+            return detail::within::point_in_geometry(point, m_areal);
+        }
+
+        m_indices.clear();
+        m_index.query(point, m_indices);
+        std::sort(m_indices.begin(), m_indices.end());
+
+        // Rings are sorted per polygon, the exterior ring first
+        std::size_t i = 0;
+        while (i < m_indices.size())
+        {
+            ring_identifier const& exterior = m_rings[m_indices[i]];
+            std::size_t next = i + 1;
+            while (next < m_indices.size()
+                && m_rings[m_indices[next]].multi_index == exterior.multi_index)
+            {
+                ++next;
+            }
+
+            // A hole of which the exterior ring is not a candidate can be
+            // skipped: the point is outside that polygon
+            if (exterior.ring_index < 0)
+            {
+                int code = point_in_ring(point, exterior);
+                if (code == 1)
+                {
+                    for (std::size_t h = i + 1; h < next; ++h)
+                    {
+                        int const interior_code
+                            = point_in_ring(point, m_rings[m_indices[h]]);
+                        if (interior_code != -1)
+                        {
+                            code = -interior_code;
+                            break;
+                        }
+                    }
+                }
+
+                if (code >= 0)
+                {
+                    return code;
+                }
+            }
+
+            i = next;
+        }
+
+        return -1;
+    }
+
+private:
+
+    inline void initialize()
+    {
+        m_initialized = true;
+
+        areal_rings<Areal>::apply(m_areal, m_rings);
+        if (m_rings.size() < min_indexed_rings)
+        {
+            return;
+        }
+
+        // Empty rings get an inverse box, they are never reported
+        std::vector<box_type> boxes(m_rings.size());
+        for (std::size_t i = 0; i < m_rings.size(); ++i)
+        {
+            geometry::envelope(detail::sub_range(m_areal, m_rings[i]),
+                               boxes[i]);
+        }
+
+        m_index.assign(boxes);
+    }
+
+    template <typename Point>
+    inline int point_in_ring(Point const& point, ring_identifier const& id) const
+    {
+        typedef typename geometry::ring_type<Areal>::type areal_ring_type;
+        return detail::within::point_in_geometry(point,
+                    static_cast<areal_ring_type const&>(
+                        detail::sub_range(m_areal, id)));
+    }
+
+    Areal const& m_areal;
+    bool m_initialized;
+    std::vector<ring_identifier> m_rings;
+    packed_box_index<box_type> m_index;
+    std::vector<std::size_t> m_indices;
+};
+
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_HPP
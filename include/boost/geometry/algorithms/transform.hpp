@@ -125,6 +125,33 @@ struct transform_box_or_segment
 };
 
 
+// Transforms the points of a range, point by point, to an output iterator.
+// Strategies which can transform many points at once faster (e.g. map
+// projections) can specialize this.
+template <typename Strategy>
+struct transform_points
+{
+    template <typename PointOut, typename Range, typename OutputIterator>
+    static inline bool apply(Range const& range,
+        OutputIterator out, Strategy const& strategy)
+    {
+        PointOut point_out;
+        for(typename boost::range_iterator<Range const>::type
+            it = boost::begin(range);
+            it != boost::end(range);
+            ++it)
+        {
+            if (! transform_point::apply(*it, point_out, strategy))
+            {
+                return false;
+            }
+            *out++ = point_out;
+        }
+        return true;
+    }
+};
+
+
 template
 <
     typename PointOut,
@@ -135,19 +162,8 @@ template
 inline bool transform_range_out(Range const& range,
     OutputIterator out, Strategy const& strategy)
 {
-    PointOut point_out;
-    for(typename boost::range_iterator<Range const>::type
-        it = boost::begin(range);
-        it != boost::end(range);
-        ++it)
-    {
-        if (! transform_point::apply(*it, point_out, strategy))
-        {
-            return false;
-        }
-        *out++ = point_out;
-    }
-    return true;
+    return transform_points<Strategy>::template apply<PointOut>(range,
+                out, strategy);
 }
 
 
@@ -0,0 +1,417 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COLUMNAR_RINGS_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COLUMNAR_RINGS_HPP
+
+
+#include <cstddef>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/numeric/conversion/bounds.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/algorithms/centroid.hpp>
+
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Rings stored as columns: one array of x coordinates, one array of
+    y coordinates, and an array of offsets
+\details The points of ring i are at the indexes [offsets[i], offsets[i+1])
+    of the coordinate arrays, so the offsets array has ring_count + 1
+    elements. The arrays are not owned.
+\tparam CoordinateType type of the coordinates
+\tparam Order orientation of the rings, as for model::ring
+\tparam Closure closure of the rings, as for model::ring
+*/
+template
+<
+    typename CoordinateType,
+    order_selector Order = clockwise,
+    closure_selector Closure = closed
+>
+struct columnar_rings
+{
+    typedef CoordinateType coordinate_type;
+
+    // As the area, length and centroid strategies: at least double
+    typedef typename select_most_precise
+        <
+            CoordinateType, double
+        >::type calculation_type;
+
+    static const order_selector order = Order;
+    static const closure_selector closure = Closure;
+
+    inline columnar_rings(CoordinateType const* xs, CoordinateType const* ys,
+                          std::size_t const* ring_offsets, std::size_t count)
+        : x(xs)
+        , y(ys)
+        , offsets(ring_offsets)
+        , ring_count(count)
+    {}
+
+    CoordinateType const* x;
+    CoordinateType const* y;
+    std::size_t const* offsets;
+    std::size_t ring_count;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar_rings
+{
+
+// Number of rings handed out to a thread at once
+static const std::size_t chunk_size = 1024;
+
+
+template <typename Rings>
+struct envelope_kernel
+{
+    typedef typename Rings::coordinate_type coordinate_type;
+
+    Rings const& rings;
+    coordinate_type* min_x;
+    coordinate_type* min_y;
+    coordinate_type* max_x;
+    coordinate_type* max_y;
+
+    inline void operator()(std::size_t r) const
+    {
+        coordinate_type const* x = rings.x;
+        coordinate_type const* y = rings.y;
+        std::size_t const first = rings.offsets[r];
+        std::size_t const last = rings.offsets[r + 1];
+
+        // As assign_inverse: an empty ring gets an inverse envelope
+        coordinate_type x0 = boost::numeric::bounds<coordinate_type>::highest();
+        coordinate_type y0 = x0;
+        coordinate_type x1 = boost::numeric::bounds<coordinate_type>::lowest();
+        coordinate_type y1 = x1;
+        for (std::size_t i = first; i < last; i++)
+        {
+            x0 = x[i] < x0 ? x[i] : x0;
+            y0 = y[i] < y0 ? y[i] : y0;
+            x1 = x[i] > x1 ? x[i] : x1;
+            y1 = y[i] > y1 ? y[i] : y1;
+        }
+        min_x[r] = x0;
+        min_y[r] = y0;
+        max_x[r] = x1;
+        max_y[r] = y1;
+    }
+};
+
+
+// The sums are made in the same order as area(ring) with the surveyor
+// strategy does, such that the results are the same: for counterclockwise
+// rings the points are visited in reverse order
+template <typename Rings>
+struct area_kernel
+{
+    typedef typename Rings::coordinate_type coordinate_type;
+    typedef typename Rings::calculation_type calculation_type;
+
+    Rings const& rings;
+    calculation_type* areas;
+
+    static inline calculation_type term(coordinate_type const* x,
+                                        coordinate_type const* y,
+                                        std::size_t i, std::size_t j)
+    {
+        return (calculation_type(x[i]) + calculation_type(x[j]))
+             * (calculation_type(y[i]) - calculation_type(y[j]));
+    }
+
+    inline void operator()(std::size_t r) const
+    {
+        coordinate_type const* x = rings.x;
+        coordinate_type const* y = rings.y;
+        std::size_t const first = rings.offsets[r];
+        std::size_t const last = rings.offsets[r + 1];
+        std::size_t const min_size
+            = core_detail::closure::minimum_ring_size<Rings::closure>::value;
+
+        calculation_type sum = calculation_type();
+        if (last - first < min_size)
+        {
+            areas[r] = sum;
+            return;
+        }
+
+        if (Rings::order == clockwise)
+        {
+            for (std::size_t i = first + 1; i < last; i++)
+            {
+                sum += term(x, y, i - 1, i);
+            }
+            if (Rings::closure == open)
+            {
+                sum += term(x, y, last - 1, first);
+            }
+        }
+        else
+        {
+            for (std::size_t i = last - 1; i > first; i--)
+            {
+                sum += term(x, y, i, i - 1);
+            }
+            if (Rings::closure == open)
+            {
+                sum += term(x, y, first, last - 1);
+            }
+        }
+        areas[r] = sum / calculation_type(2);
+    }
+};
+
+
+template <typename Rings>
+struct perimeter_kernel
+{
+    typedef typename Rings::coordinate_type coordinate_type;
+    typedef typename Rings::calculation_type calculation_type;
+
+    // As default_length_result, the distances are added in long double
+    typedef typename select_most_precise
+        <
+            coordinate_type, long double
+        >::type sum_type;
+
+    Rings const& rings;
+    calculation_type* perimeters;
+
+    static inline calculation_type distance(coordinate_type const* x,
+                                            coordinate_type const* y,
+                                            std::size_t i, std::size_t j)
+    {
+        calculation_type const dx
+            = calculation_type(x[i]) - calculation_type(x[j]);
+        calculation_type const dy
+            = calculation_type(y[i]) - calculation_type(y[j]);
+        return math::sqrt(dy * dy + dx * dx);
+    }
+
+    inline void operator()(std::size_t r) const
+    {
+        coordinate_type const* x = rings.x;
+        coordinate_type const* y = rings.y;
+        std::size_t const first = rings.offsets[r];
+        std::size_t const last = rings.offsets[r + 1];
+
+        sum_type sum = sum_type();
+        if (last - first > 1)
+        {
+            for (std::size_t i = first + 1; i < last; i++)
+            {
+                sum += distance(x, y, i - 1, i);
+            }
+            if (Rings::closure == open)
+            {
+                sum += distance(x, y, last - 1, first);
+            }
+        }
+        perimeters[r] = static_cast<calculation_type>(sum);
+    }
+};
+
+
+// As centroid(ring) with the bashein_detmer strategy: the points are
+// translated to the first point of the ring, and degenerate rings get
+// their first point
+template <typename Rings>
+struct centroid_kernel
+{
+    typedef typename Rings::coordinate_type coordinate_type;
+    typedef typename Rings::calculation_type calculation_type;
+
+    Rings const& rings;
+    calculation_type* centroid_x;
+    calculation_type* centroid_y;
+
+    inline void operator()(std::size_t r) const
+    {
+        coordinate_type const* x = rings.x;
+        coordinate_type const* y = rings.y;
+        std::size_t const first = rings.offsets[r];
+        std::size_t const last = rings.offsets[r + 1];
+
+        if (first == last)
+        {
+            // Empty rings are checked before, in the calling thread
+            return;
+        }
+
+        coordinate_type const x0 = x[first];
+        coordinate_type const y0 = y[first];
+
+        calculation_type sum_a2 = calculation_type();
+        calculation_type sum_x = calculation_type();
+        calculation_type sum_y = calculation_type();
+
+        // The first translated point is (0, 0)
+        calculation_type px = calculation_type(coordinate_type());
+        calculation_type py = px;
+        std::size_t const end = Rings::closure == open ? last + 1 : last;
+        for (std::size_t k = first + 1; k < end; k++)
+        {
+            std::size_t const i = k < last ? k : first;
+            calculation_type const qx = calculation_type(coordinate_type(x[i] - x0));
+            calculation_type const qy = calculation_type(coordinate_type(y[i] - y0));
+            calculation_type const ai = px * qy - py * qx;
+            sum_a2 += ai;
+            sum_x += ai * (px + qx);
+            sum_y += ai * (py + qy);
+            px = qx;
+            py = qy;
+        }
+
+        calculation_type const a3 = calculation_type(3) * sum_a2;
+        if (last - first > 1
+            && ! math::equals(sum_a2, calculation_type())
+            && boost::math::isfinite(a3))
+        {
+            centroid_x[r] = sum_x / a3 + x0;
+            centroid_y[r] = sum_y / a3 + y0;
+        }
+        else
+        {
+            centroid_x[r] = x0;
+            centroid_y[r] = y0;
+        }
+    }
+};
+
+
+}} // namespace detail::columnar_rings
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the envelope of each ring of columnar rings
+\ingroup envelope
+\details The result is the same as envelope(ring) per ring. Empty rings get
+    an inverse envelope (min at highest, max at lowest value).
+\param rings the rings
+\param min_x output array for minimum x, of ring_count elements
+\param min_y output array for minimum y, of ring_count elements
+\param max_x output array for maximum x, of ring_count elements
+\param max_y output array for maximum y, of ring_count elements
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename T, order_selector Order, closure_selector Closure>
+inline void envelope_n(columnar_rings<T, Order, Closure> const& rings,
+                       T* min_x, T* min_y, T* max_x, T* max_y,
+                       std::size_t thread_count = 1)
+{
+    typedef columnar_rings<T, Order, Closure> rings_type;
+    detail::columnar_rings::envelope_kernel<rings_type> const kernel
+        = { rings, min_x, min_y, max_x, max_y };
+    detail::parallel::for_each_index(rings.ring_count, kernel, thread_count,
+                                     detail::columnar_rings::chunk_size);
+}
+
+/*!
+\brief Calculates the signed area of each ring of columnar rings
+\ingroup area
+\details The result is the same as area(ring) per ring, for rings of the
+    same orientation and closure, using the surveyor strategy: positive
+    for rings of the specified orientation, and zero for rings having
+    too few points.
+\param rings the rings
+\param areas output array, of ring_count elements
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename T, order_selector Order, closure_selector Closure>
+inline void area_n(columnar_rings<T, Order, Closure> const& rings,
+                   typename columnar_rings<T, Order, Closure>::calculation_type* areas,
+                   std::size_t thread_count = 1)
+{
+    typedef columnar_rings<T, Order, Closure> rings_type;
+    detail::columnar_rings::area_kernel<rings_type> const kernel
+        = { rings, areas };
+    detail::parallel::for_each_index(rings.ring_count, kernel, thread_count,
+                                     detail::columnar_rings::chunk_size);
+}
+
+/*!
+\brief Calculates the perimeter of each ring of columnar rings
+\ingroup perimeter
+\details The result is the same as perimeter(ring) per ring, using the
+    pythagoras strategy, converted to the calculation type.
+\param rings the rings
+\param perimeters output array, of ring_count elements
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename T, order_selector Order, closure_selector Closure>
+inline void perimeter_n(columnar_rings<T, Order, Closure> const& rings,
+                        typename columnar_rings<T, Order, Closure>::calculation_type* perimeters,
+                        std::size_t thread_count = 1)
+{
+    typedef columnar_rings<T, Order, Closure> rings_type;
+    detail::columnar_rings::perimeter_kernel<rings_type> const kernel
+        = { rings, perimeters };
+    detail::parallel::for_each_index(rings.ring_count, kernel, thread_count,
+                                     detail::columnar_rings::chunk_size);
+}
+
+/*!
+\brief Calculates the centroid of each ring of columnar rings
+\ingroup centroid
+\details The result is the same as centroid(ring) per ring, using the
+    bashein_detmer strategy, for a centroid having coordinates of the
+    calculation type. Rings without area get their first point.
+\param rings the rings
+\param centroid_x output array for x, of ring_count elements
+\param centroid_y output array for y, of ring_count elements
+\param thread_count number of threads, 0 means the hardware concurrency
+\exception centroid_exception if a ring is empty (unless
+    BOOST_GEOMETRY_CENTROID_NO_THROW is defined, then its centroid is
+    not assigned)
+*/
+template <typename T, order_selector Order, closure_selector Closure>
+inline void centroid_n(columnar_rings<T, Order, Closure> const& rings,
+                       typename columnar_rings<T, Order, Closure>::calculation_type* centroid_x,
+                       typename columnar_rings<T, Order, Closure>::calculation_type* centroid_y,
+                       std::size_t thread_count = 1)
+{
+    typedef columnar_rings<T, Order, Closure> rings_type;
+
+#if ! defined(BOOST_GEOMETRY_CENTROID_NO_THROW)
+    for (std::size_t r = 0; r < rings.ring_count; r++)
+    {
+        if (rings.offsets[r] == rings.offsets[r + 1])
+        {
+            throw centroid_exception();
+        }
+    }
+#endif
+
+    detail::columnar_rings::centroid_kernel<rings_type> const kernel
+        = { rings, centroid_x, centroid_y };
+    detail::parallel::for_each_index(rings.ring_count, kernel, thread_count,
+                                     detail::columnar_rings::chunk_size);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_COLUMNAR_RINGS_HPP
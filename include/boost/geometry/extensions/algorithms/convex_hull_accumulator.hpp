@@ -0,0 +1,128 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CONVEX_HULL_ACCUMULATOR_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CONVEX_HULL_ACCUMULATOR_HPP
+
+
+#include <cstddef>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Calculates the convex hull of a stream of points, holding only a
+    limited number of points in memory
+\details Points are collected in a buffer. If the buffer is full, it is
+    replaced by the vertices of the convex hull of its points. Because the
+    convex hull of the union of point sets equals the convex hull of the
+    union of their convex hulls, the final result is the same as the result
+    of geometry::convex_hull on all points at once. Memory usage is bounded
+    by the buffer size plus the number of vertices of the hull.
+\tparam Point point type
+\ingroup convex_hull
+*/
+template <typename Point>
+class convex_hull_accumulator
+{
+public :
+    typedef model::multi_point<Point> buffer_type;
+
+    explicit convex_hull_accumulator(std::size_t buffer_size = 65536)
+        : m_buffer_size(buffer_size < 16 ? 16 : buffer_size)
+        , m_hull_size(0)
+    {}
+
+    //! Adds one point
+    inline void add(Point const& point)
+    {
+        m_buffer.push_back(point);
+        if (m_buffer.size() >= m_buffer_size + m_hull_size)
+        {
+            reduce();
+        }
+    }
+
+    //! Adds all points of a range of points
+    template <typename Range>
+    inline void add_range(Range const& points)
+    {
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(points); it != boost::end(points); ++it)
+        {
+            add(*it);
+        }
+    }
+
+    //! Adds the points collected by another accumulator
+    inline void merge(convex_hull_accumulator const& other)
+    {
+        add_range(other.m_buffer);
+    }
+
+    //! Returns true if no points were added
+    inline bool empty() const
+    {
+        return m_buffer.empty();
+    }
+
+    /*!
+    \brief Calculates the convex hull of all points added so far
+    \details The output geometry is the same as geometry::convex_hull
+        outputs for all points. Like that algorithm, it leaves the
+        output empty if no points were added.
+    */
+    template <typename OutputGeometry>
+    inline void result(OutputGeometry& hull)
+    {
+        reduce();
+        geometry::convex_hull(m_buffer, hull);
+    }
+
+    //! Replaces the collected points by the vertices of their hull
+    inline void reduce()
+    {
+        if (m_buffer.size() <= m_hull_size || m_buffer.size() < 3)
+        {
+            return;
+        }
+
+        model::ring<Point> ring;
+        geometry::convex_hull(m_buffer, ring);
+
+        // Skip the closing point
+        m_buffer.assign(boost::begin(ring), boost::end(ring) - 1);
+        m_hull_size = m_buffer.size();
+    }
+
+    //! Returns the collected points (the hull vertices after reduce)
+    inline buffer_type const& points() const
+    {
+        return m_buffer;
+    }
+
+private :
+    std::size_t m_buffer_size;
+    std::size_t m_hull_size;
+    buffer_type m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_CONVEX_HULL_ACCUMULATOR_HPP
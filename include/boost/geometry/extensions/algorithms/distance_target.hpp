@@ -0,0 +1,698 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_TARGET_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_TARGET_HPP
+
+
+#include <iterator>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/detail/closest_feature/range_to_range.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/distance/is_comparable.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/iterators/point_iterator.hpp>
+#include <boost/geometry/strategies/comparable_distance_result.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/distance_result.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance
+{
+
+
+// Lets the target model the range concept of its geometry (if any)
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+class target_base
+{
+public :
+    explicit inline target_base(Geometry const& geometry)
+        : m_geometry(geometry)
+    {}
+
+    inline Geometry const& geometry() const { return m_geometry; }
+
+private :
+    Geometry const& m_geometry;
+};
+
+template <typename Geometry>
+class target_range_base
+{
+public :
+    typedef typename boost::range_iterator<Geometry const>::type iterator;
+    typedef iterator const_iterator;
+    typedef typename boost::range_size<Geometry const>::type size_type;
+
+    explicit inline target_range_base(Geometry const& geometry)
+        : m_geometry(geometry)
+    {}
+
+    inline Geometry const& geometry() const { return m_geometry; }
+
+    inline const_iterator begin() const { return boost::begin(m_geometry); }
+    inline const_iterator end() const { return boost::end(m_geometry); }
+    inline size_type size() const { return boost::size(m_geometry); }
+
+private :
+    Geometry const& m_geometry;
+};
+
+template <typename Geometry>
+class target_base<Geometry, linestring_tag> : public target_range_base<Geometry>
+{
+public :
+    explicit inline target_base(Geometry const& g) : target_range_base<Geometry>(g) {}
+};
+
+template <typename Geometry>
+class target_base<Geometry, ring_tag> : public target_range_base<Geometry>
+{
+public :
+    explicit inline target_base(Geometry const& g) : target_range_base<Geometry>(g) {}
+};
+
+template <typename Geometry>
+class target_base<Geometry, multi_point_tag> : public target_range_base<Geometry>
+{
+public :
+    explicit inline target_base(Geometry const& g) : target_range_base<Geometry>(g) {}
+};
+
+template <typename Geometry>
+class target_base<Geometry, multi_linestring_tag> : public target_range_base<Geometry>
+{
+public :
+    explicit inline target_base(Geometry const& g) : target_range_base<Geometry>(g) {}
+};
+
+template <typename Geometry>
+class target_base<Geometry, multi_polygon_tag> : public target_range_base<Geometry>
+{
+public :
+    explicit inline target_base(Geometry const& g) : target_range_base<Geometry>(g) {}
+};
+
+
+// The nearest queries of the rtree compare cartesian distances, which do not
+// order the features by their distance on the sphere or on the spheroid
+template <typename Geometry>
+struct target_uses_rtree
+    : boost::is_same<typename cs_tag<Geometry>::type, cartesian_tag>
+{};
+
+
+}} // namespace detail::distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Geometry prepared for many distance calculations against it
+\ingroup distance
+\details The target builds an rtree over the segments (or, for a multi point,
+    the points) of the geometry once. The distance and comparable_distance
+    overloads taking a distance_target query this rtree, where the
+    unprepared versions build an rtree for every call.
+    The rtree is built for cartesian geometries only. In other coordinate
+    systems its nearest queries would not find the nearest feature, the
+    rtree is left empty and the distance is calculated unprepared.
+    The target refers to the geometry (its rtree refers to the points of
+    the geometry), which must outlive it and must not be modified.
+    The target models the same (read-only) geometry concept as the
+    geometry, such that it can be used in other algorithms as well.
+\tparam Geometry \tparam_geometry (multi point, linear or areal)
+\par Example:
+\code
+distance_target<multi_linestring_type> const coast(coastline);
+for (...)
+{
+    d = boost::geometry::distance(features[i], coast);
+}
+\endcode
+*/
+template <typename Geometry>
+class distance_target
+    : public detail::distance::target_base<Geometry>
+{
+    typedef detail::distance::iterator_selector<Geometry const> selector_type;
+
+public :
+    typedef typename std::iterator_traits
+        <
+            typename selector_type::iterator_type
+        >::value_type feature_type;
+
+    typedef index::rtree<feature_type, index::linear<8> > rtree_type;
+
+    explicit inline distance_target(Geometry const& geometry)
+        : detail::distance::target_base<Geometry>(geometry)
+        , m_rtree(selector_type::begin(geometry),
+                  detail::distance::target_uses_rtree<Geometry>::value
+                    ? selector_type::end(geometry)
+                    : selector_type::begin(geometry))
+    {
+        concept::check<Geometry const>();
+    }
+
+    inline rtree_type const& rtree() const { return m_rtree; }
+
+private :
+    rtree_type m_rtree;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance
+{
+
+
+// Checks if one point of each component (point, linestring, polygon...)
+// of a geometry is covered by an areal geometry. If the boundaries are
+// disjoint, this is equivalent to intersects.
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct any_component_covered_by
+{
+    template <typename Areal>
+    static inline bool apply(Geometry const& geometry, Areal const& areal)
+    {
+        typename point_type<Geometry>::type point;
+        return geometry::point_on_border(point, geometry)
+            && geometry::covered_by(point, areal);
+    }
+};
+
+template <typename Point>
+struct any_component_covered_by<Point, point_tag>
+{
+    template <typename Areal>
+    static inline bool apply(Point const& point, Areal const& areal)
+    {
+        return geometry::covered_by(point, areal);
+    }
+};
+
+template <typename Multi>
+struct any_component_covered_by_multi
+{
+    template <typename Areal>
+    static inline bool apply(Multi const& multi, Areal const& areal)
+    {
+        typedef typename boost::range_value<Multi>::type single_type;
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            if (any_component_covered_by<single_type>::apply(*it, areal))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template <typename MultiPoint>
+struct any_component_covered_by<MultiPoint, multi_point_tag>
+    : any_component_covered_by_multi<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct any_component_covered_by<MultiLinestring, multi_linestring_tag>
+    : any_component_covered_by_multi<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct any_component_covered_by<MultiPolygon, multi_polygon_tag>
+    : any_component_covered_by_multi<MultiPolygon>
+{};
+
+
+template <typename Geometry, typename Areal, bool IsAreal>
+struct covered_if_areal
+{
+    static inline bool apply(Geometry const& geometry, Areal const& areal)
+    {
+        return any_component_covered_by<Geometry>::apply(geometry, areal);
+    }
+};
+
+template <typename Geometry, typename Areal>
+struct covered_if_areal<Geometry, Areal, false>
+{
+    static inline bool apply(Geometry const& , Areal const& )
+    {
+        return false;
+    }
+};
+
+
+template <typename Geometry>
+struct is_areal
+    : boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            areal_tag
+        >
+{};
+
+
+/*!
+\brief Distance from a geometry to a distance_target
+\details Follows the unprepared implementation (range_to_range_rtree):
+    the minimal comparable distance of the features (points or segments)
+    of the geometry to their nearest feature in the rtree, which is
+    converted to the distance of that closest pair. If either geometry
+    is areal, and their boundaries are disjoint, the distance is zero
+    if one of them is inside the other.
+*/
+template
+<
+    typename Geometry,
+    typename Target,
+    typename Strategy,
+    typename Tag = typename tag<Geometry>::type
+>
+struct distance_to_target
+{
+    typedef typename distance_result<Geometry, Target, Strategy>::type return_type;
+
+    typedef typename strategy::distance::services::comparable_type
+        <
+            Strategy
+        >::type comparable_strategy_type;
+
+    typedef typename distance_target<Target>::feature_type target_feature_type;
+
+    static inline bool inside(Geometry const& geometry, Target const& target)
+    {
+        return covered_if_areal
+                <
+                    Geometry, Target, is_areal<Target>::value
+                >::apply(geometry, target)
+            || covered_if_areal
+                <
+                    Target, Geometry, is_areal<Geometry>::value
+                >::apply(target, geometry);
+    }
+
+    static inline return_type apply(Geometry const& geometry,
+                                    distance_target<Target> const& target,
+                                    Strategy const& strategy)
+    {
+        typedef iterator_selector<Geometry const> selector_type;
+        typedef typename selector_type::iterator_type iterator_type;
+        typedef typename std::iterator_traits
+            <
+                iterator_type
+            >::value_type feature_type;
+
+        if (target.rtree().empty())
+        {
+            // A target without segments (e.g. a linestring with one point)
+            return geometry::distance(geometry, target.geometry(), strategy);
+        }
+
+        if (geometry::num_points(geometry) == 1)
+        {
+            return distance_to_target
+                <
+                    typename point_type<Geometry>::type, Target, Strategy
+                >::apply(*points_begin(geometry), target, strategy);
+        }
+
+        typename strategy::distance::services::return_type
+            <
+                comparable_strategy_type,
+                typename point_type<Geometry>::type,
+                typename point_type<Target>::type
+            >::type cd_min;
+
+        target_feature_type target_min;
+        iterator_type qit_min;
+        closest_feature::range_to_range_rtree::apply(target.rtree(),
+            selector_type::begin(geometry), selector_type::end(geometry),
+            strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy),
+            target_min, qit_min, cd_min);
+
+        if (math::equals(cd_min, 0) || inside(geometry, target.geometry()))
+        {
+            return return_type(0);
+        }
+
+        return is_comparable<Strategy>::value
+            ? cd_min
+            : dispatch::distance
+                <
+                    target_feature_type, feature_type, Strategy
+                >::apply(target_min, *qit_min, strategy);
+    }
+};
+
+template <typename Point, typename Target, typename Strategy>
+struct distance_to_target<Point, Target, Strategy, point_tag>
+{
+    typedef typename distance_result<Point, Target, Strategy>::type return_type;
+
+    typedef typename distance_target<Target>::feature_type target_feature_type;
+
+    static inline return_type apply(Point const& point,
+                                    distance_target<Target> const& target,
+                                    Strategy const& strategy)
+    {
+        if (target.rtree().empty())
+        {
+            return geometry::distance(point, target.geometry(), strategy);
+        }
+
+        target_feature_type nearest;
+        target.rtree().query(index::nearest(point, 1), &nearest);
+
+        if (covered_if_areal
+                <
+                    Point, Target, is_areal<Target>::value
+                >::apply(point, target.geometry()))
+        {
+            return return_type(0);
+        }
+
+        return dispatch::distance
+            <
+                target_feature_type, Point, Strategy
+            >::apply(nearest, point, strategy);
+    }
+};
+
+
+template
+<
+    typename Geometry,
+    typename Target,
+    typename Strategy,
+    bool UsesRtree = target_uses_rtree<Target>::value
+>
+struct distance_to_target_geometry
+    : distance_to_target<Geometry, Target, Strategy>
+{};
+
+template <typename Geometry, typename Target, typename Strategy>
+struct distance_to_target_geometry<Geometry, Target, Strategy, false>
+{
+    typedef typename distance_result<Geometry, Target, Strategy>::type return_type;
+
+    static inline return_type apply(Geometry const& geometry,
+                                    distance_target<Target> const& target,
+                                    Strategy const& strategy)
+    {
+        return geometry::distance(geometry, target.geometry(), strategy);
+    }
+};
+
+
+template <typename Geometry, typename Target, typename Strategy>
+struct resolve_target_strategy
+{
+    typedef Strategy type;
+
+    static inline Strategy const& get(Strategy const& strategy)
+    {
+        return strategy;
+    }
+};
+
+template <typename Geometry, typename Target>
+struct resolve_target_strategy<Geometry, Target, geometry::default_strategy>
+{
+    typedef typename detail::distance::default_strategy
+        <
+            Geometry, Target
+        >::type type;
+
+    static inline type get(geometry::default_strategy)
+    {
+        return type();
+    }
+};
+
+
+}} // namespace detail::distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_calc2{distance} \brief_strategy
+\ingroup distance
+\details The distance to a prepared target, using its rtree. The result
+    is the same as the distance to the geometry of the target. Targets
+    which are not cartesian have no rtree, their distance is calculated
+    unprepared.
+\param geometry \param_geometry
+\param target the prepared target geometry
+\param strategy \param_strategy{distance}
+*/
+template <typename Geometry, typename Target, typename Strategy>
+inline typename distance_result<Geometry, Target, Strategy>::type
+distance(Geometry const& geometry,
+         distance_target<Target> const& target,
+         Strategy const& strategy)
+{
+    typedef detail::distance::resolve_target_strategy
+        <
+            Geometry, Target, Strategy
+        > resolve_type;
+
+    concept::check<Geometry const>();
+
+    detail::throw_on_empty_input(geometry);
+    detail::throw_on_empty_input(target.geometry());
+
+    return detail::distance::distance_to_target_geometry
+        <
+            Geometry, Target, typename resolve_type::type
+        >::apply(geometry, target, resolve_type::get(strategy));
+}
+
+template <typename Geometry, typename Target, typename Strategy>
+inline typename distance_result<Target, Geometry, Strategy>::type
+distance(distance_target<Target> const& target,
+         Geometry const& geometry,
+         Strategy const& strategy)
+{
+    return geometry::distance(geometry, target, strategy);
+}
+
+template <typename Target1, typename Target2, typename Strategy>
+inline typename distance_result<Target1, Target2, Strategy>::type
+distance(distance_target<Target1> const& target1,
+         distance_target<Target2> const& target2,
+         Strategy const& strategy)
+{
+    return geometry::distance(target1.geometry(), target2, strategy);
+}
+
+/*!
+\brief \brief_calc2{distance}
+\ingroup distance
+\details The distance to a prepared target, using its rtree and the
+    default strategy
+*/
+template <typename Geometry, typename Target>
+inline typename default_distance_result<Geometry, Target>::type
+distance(Geometry const& geometry, distance_target<Target> const& target)
+{
+    return geometry::distance(geometry, target, default_strategy());
+}
+
+template <typename Geometry, typename Target>
+inline typename default_distance_result<Target, Geometry>::type
+distance(distance_target<Target> const& target, Geometry const& geometry)
+{
+    return geometry::distance(geometry, target, default_strategy());
+}
+
+template <typename Target1, typename Target2>
+inline typename default_distance_result<Target1, Target2>::type
+distance(distance_target<Target1> const& target1,
+         distance_target<Target2> const& target2)
+{
+    return geometry::distance(target1.geometry(), target2, default_strategy());
+}
+
+
+/*!
+\brief \brief_calc2{comparable distance measurement} \brief_strategy
+\ingroup distance
+\details The comparable distance to a prepared target, using its rtree
+*/
+template <typename Geometry, typename Target, typename Strategy>
+inline typename comparable_distance_result<Geometry, Target, Strategy>::type
+comparable_distance(Geometry const& geometry,
+                    distance_target<Target> const& target,
+                    Strategy const& strategy)
+{
+    typedef detail::distance::resolve_target_strategy
+        <
+            Geometry, Target, Strategy
+        > resolve_type;
+
+    return geometry::distance(geometry, target,
+        strategy::distance::services::get_comparable
+            <
+                typename resolve_type::type
+            >::apply(resolve_type::get(strategy)));
+}
+
+template <typename Geometry, typename Target, typename Strategy>
+inline typename comparable_distance_result<Target, Geometry, Strategy>::type
+comparable_distance(distance_target<Target> const& target,
+                    Geometry const& geometry,
+                    Strategy const& strategy)
+{
+    return geometry::comparable_distance(geometry, target, strategy);
+}
+
+template <typename Target1, typename Target2, typename Strategy>
+inline typename comparable_distance_result<Target1, Target2, Strategy>::type
+comparable_distance(distance_target<Target1> const& target1,
+                    distance_target<Target2> const& target2,
+                    Strategy const& strategy)
+{
+    return geometry::comparable_distance(target1.geometry(), target2, strategy);
+}
+
+template <typename Geometry, typename Target>
+inline typename default_comparable_distance_result<Geometry, Target>::type
+comparable_distance(Geometry const& geometry,
+                    distance_target<Target> const& target)
+{
+    return geometry::comparable_distance(geometry, target, default_strategy());
+}
+
+template <typename Geometry, typename Target>
+inline typename default_comparable_distance_result<Target, Geometry>::type
+comparable_distance(distance_target<Target> const& target,
+                    Geometry const& geometry)
+{
+    return geometry::comparable_distance(geometry, target, default_strategy());
+}
+
+template <typename Target1, typename Target2>
+inline typename default_comparable_distance_result<Target1, Target2>::type
+comparable_distance(distance_target<Target1> const& target1,
+                    distance_target<Target2> const& target2)
+{
+    return geometry::comparable_distance(target1.geometry(), target2,
+                                         default_strategy());
+}
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+// The target models the (read-only) concept of its geometry
+
+template <typename Geometry>
+struct tag<distance_target<Geometry> >
+{
+    typedef typename geometry::tag<Geometry>::type type;
+};
+
+template <typename Geometry>
+struct point_order<distance_target<Geometry> >
+{
+    static const order_selector value = geometry::point_order<Geometry>::value;
+};
+
+template <typename Geometry>
+struct closure<distance_target<Geometry> >
+{
+    static const closure_selector value = geometry::closure<Geometry>::value;
+};
+
+template <typename Geometry>
+struct ring_const_type<distance_target<Geometry> >
+{
+    typedef typename geometry::ring_return_type<Geometry const>::type type;
+};
+
+template <typename Geometry>
+struct ring_mutable_type<distance_target<Geometry> >
+{
+    typedef typename geometry::ring_return_type<Geometry const>::type type;
+};
+
+template <typename Geometry>
+struct interior_const_type<distance_target<Geometry> >
+{
+    typedef typename geometry::interior_return_type<Geometry const>::type type;
+};
+
+template <typename Geometry>
+struct interior_mutable_type<distance_target<Geometry> >
+{
+    typedef typename geometry::interior_return_type<Geometry const>::type type;
+};
+
+template <typename Geometry>
+struct exterior_ring<distance_target<Geometry> >
+{
+    static inline typename geometry::ring_return_type<Geometry const>::type
+        get(distance_target<Geometry> const& target)
+    {
+        return geometry::exterior_ring(target.geometry());
+    }
+};
+
+template <typename Geometry>
+struct interior_rings<distance_target<Geometry> >
+{
+    static inline typename geometry::interior_return_type<Geometry const>::type
+        get(distance_target<Geometry> const& target)
+    {
+        return geometry::interior_rings(target.geometry());
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_TARGET_HPP
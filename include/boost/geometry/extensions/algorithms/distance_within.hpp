@@ -0,0 +1,714 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_WITHIN_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_WITHIN_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/distance/is_comparable.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/extensions/algorithms/distance_target.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/index/detail/predicates.hpp>
+#include <boost/geometry/index/detail/tags.hpp>
+#include <boost/geometry/strategies/comparable_distance_result.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/strategies/tags.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_within
+{
+
+
+// Point-point distance, in the units of a point-point strategy or of a
+// point-segment strategy (as the distance to a degenerate segment)
+template
+<
+    typename Strategy,
+    typename Tag = typename strategy::distance::services::tag<Strategy>::type
+>
+struct point_distance
+{
+    template <typename Point1, typename Point2>
+    static inline
+    typename strategy::distance::services::return_type
+        <
+            Strategy, Point1, Point2
+        >::type
+    apply(Strategy const& strategy, Point1 const& p1, Point2 const& p2)
+    {
+        return strategy.apply(p1, p2);
+    }
+};
+
+template <typename Strategy>
+struct point_distance<Strategy, strategy_tag_distance_point_segment>
+{
+    template <typename Point1, typename Point2>
+    static inline
+    typename strategy::distance::services::return_type
+        <
+            Strategy, Point1, Point2
+        >::type
+    apply(Strategy const& strategy, Point1 const& p1, Point2 const& p2)
+    {
+        return strategy.apply(p1, p2, p2);
+    }
+};
+
+
+// The features (points or segments) of a geometry, copied into a vector
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct features
+{
+    typedef detail::distance::iterator_selector<Geometry const> selector_type;
+    typedef typename std::iterator_traits
+        <
+            typename selector_type::iterator_type
+        >::value_type type;
+
+    static inline void apply(Geometry const& geometry, std::vector<type>& out)
+    {
+        out.assign(selector_type::begin(geometry), selector_type::end(geometry));
+    }
+};
+
+template <typename Point>
+struct features<Point, point_tag>
+{
+    typedef Point type;
+
+    static inline void apply(Point const& point, std::vector<type>& out)
+    {
+        out.assign(1, point);
+    }
+};
+
+template <typename Segment>
+struct features<Segment, segment_tag>
+{
+    typedef Segment type;
+
+    static inline void apply(Segment const& segment, std::vector<type>& out)
+    {
+        out.assign(1, segment);
+    }
+};
+
+
+// Distance from a center to the farthest location of a feature. For a
+// segment this is bounded by the distance to its first point plus its
+// length, which holds for any metric (also on the sphere and spheroid)
+template <typename Feature, typename Tag = typename tag<Feature>::type>
+struct feature_reach
+{
+    template <typename Point, typename Strategy>
+    static inline typename strategy::distance::services::return_type
+        <
+            Strategy, Point, typename point_type<Feature>::type
+        >::type
+    apply(Point const& center, Feature const& point, Strategy const& strategy)
+    {
+        return point_distance<Strategy>::apply(strategy, center, point);
+    }
+
+    template <typename Point>
+    static inline void first_point(Feature const& point, Point& p)
+    {
+        geometry::convert(point, p);
+    }
+};
+
+template <typename Segment>
+struct feature_reach<Segment, segment_tag>
+{
+    template <typename Point, typename Strategy>
+    static inline typename strategy::distance::services::return_type
+        <
+            Strategy, Point, typename point_type<Segment>::type
+        >::type
+    apply(Point const& center, Segment const& segment, Strategy const& strategy)
+    {
+        typedef typename point_type<Segment>::type segment_point_type;
+        segment_point_type p0, p1;
+        geometry::detail::assign_point_from_index<0>(segment, p0);
+        geometry::detail::assign_point_from_index<1>(segment, p1);
+        return point_distance<Strategy>::apply(strategy, center, p0)
+            + point_distance<Strategy>::apply(strategy, p0, p1);
+    }
+
+    template <typename Point>
+    static inline void first_point(Segment const& segment, Point& p)
+    {
+        geometry::detail::assign_point_from_index<0>(segment, p);
+    }
+};
+
+
+// A section of consecutive features, bounded by a ball
+template <typename Point, typename Distance>
+struct section
+{
+    std::size_t begin;
+    std::size_t end;
+    Point center;
+    Distance radius;
+};
+
+template <typename Point, typename Feature, typename Strategy, typename Distance>
+inline void sectionalize(std::vector<Feature> const& features,
+                         Strategy const& strategy, bool bounded,
+                         std::vector<section<Point, Distance> >& sections)
+{
+    std::size_t const count = features.size();
+    std::size_t const size = (std::max)(std::size_t(8),
+        static_cast<std::size_t>(std::sqrt(static_cast<double>(count))));
+
+    sections.clear();
+    sections.reserve(count / size + 1);
+    for (std::size_t begin = 0; begin < count; begin += size)
+    {
+        section<Point, Distance> s;
+        s.begin = begin;
+        s.end = (std::min)(begin + size, count);
+        feature_reach<Feature>::first_point(features[(s.begin + s.end) / 2],
+                                            s.center);
+        s.radius = Distance(0);
+        if (bounded)
+        {
+            for (std::size_t i = s.begin; i < s.end; i++)
+            {
+                Distance const r = feature_reach<Feature>::apply(s.center,
+                                        features[i], strategy);
+                if (r > s.radius)
+                {
+                    s.radius = r;
+                }
+            }
+        }
+        sections.push_back(s);
+    }
+}
+
+
+template <typename Distance>
+struct section_pair
+{
+    Distance lower_bound;
+    std::size_t first;
+    std::size_t second;
+
+    inline bool operator<(section_pair const& other) const
+    {
+        return lower_bound < other.lower_bound;
+    }
+};
+
+
+template <typename Geometry>
+struct is_areal
+    : boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            areal_tag
+        >
+{};
+
+
+/*!
+\brief Checks if two geometries are within a distance of each other
+\details The features (points or segments) of both geometries are divided
+    into sections of consecutive features, each bounded by a ball around
+    one of its points. Pairs of sections of which the balls are farther
+    apart than the maximal distance are skipped. The remaining pairs are
+    visited nearest first, comparing their features with the comparable
+    strategy, and the first pair within the distance ends the search.
+    The balls use real distances and the triangle inequality, so for a
+    comparable strategy only the early exit is applied.
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+struct boundaries_within
+{
+    typedef typename point_type<Geometry1>::type point1_type;
+    typedef typename point_type<Geometry2>::type point2_type;
+
+    typedef typename distance_result
+        <
+            Geometry1, Geometry2, Strategy
+        >::type distance_type;
+
+    typedef typename strategy::distance::services::comparable_type
+        <
+            Strategy
+        >::type comparable_strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            comparable_strategy_type, point1_type, point2_type
+        >::type comparable_type;
+
+    typedef features<Geometry1> features1;
+    typedef features<Geometry2> features2;
+    typedef typename features1::type feature1_type;
+    typedef typename features2::type feature2_type;
+
+    typedef section<point1_type, distance_type> section1_type;
+    typedef section<point2_type, distance_type> section2_type;
+
+    // Returns false if either geometry has no features
+    template <typename Distance>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             bool& within)
+    {
+        std::vector<feature1_type> f1;
+        std::vector<feature2_type> f2;
+        features1::apply(geometry1, f1);
+        features2::apply(geometry2, f2);
+        if (f1.empty() || f2.empty())
+        {
+            return false;
+        }
+
+        bool const bounded = ! detail::distance::is_comparable<Strategy>::value;
+        distance_type const max_d = distance_type(max_distance);
+
+        std::vector<section1_type> sections1;
+        std::vector<section2_type> sections2;
+        sectionalize(f1, strategy, bounded, sections1);
+        sectionalize(f2, strategy, bounded, sections2);
+
+        std::vector<section_pair<distance_type> > pairs;
+        for (std::size_t i = 0; i < sections1.size(); i++)
+        {
+            for (std::size_t j = 0; j < sections2.size(); j++)
+            {
+                section_pair<distance_type> pair;
+                pair.first = i;
+                pair.second = j;
+                pair.lower_bound = distance_type(0);
+                if (bounded)
+                {
+                    pair.lower_bound = point_distance<Strategy>::apply(strategy,
+                            sections1[i].center, sections2[j].center)
+                        - sections1[i].radius - sections2[j].radius;
+                    if (pair.lower_bound > max_d)
+                    {
+                        continue;
+                    }
+                }
+                pairs.push_back(pair);
+            }
+        }
+
+        if (bounded)
+        {
+            std::sort(pairs.begin(), pairs.end());
+        }
+
+        comparable_strategy_type const cstrategy
+            = strategy::distance::services::get_comparable
+                <
+                    Strategy
+                >::apply(strategy);
+
+        comparable_type const max_cd = bounded
+            ? comparable_type(strategy::distance::services::result_from_distance
+                <
+                    comparable_strategy_type, point1_type, point2_type
+                >::apply(cstrategy, max_distance))
+            : comparable_type(max_distance);
+
+        within = false;
+        for (std::size_t p = 0; p < pairs.size() && ! within; p++)
+        {
+            section1_type const& s1 = sections1[pairs[p].first];
+            section2_type const& s2 = sections2[pairs[p].second];
+            for (std::size_t i = s1.begin; i < s1.end && ! within; i++)
+            {
+                for (std::size_t j = s2.begin; j < s2.end && ! within; j++)
+                {
+                    within = dispatch::distance
+                        <
+                            feature1_type, feature2_type,
+                            comparable_strategy_type
+                        >::apply(f1[i], f2[j], cstrategy) <= max_cd;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2>
+inline bool one_inside_other(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2)
+{
+    return detail::distance::covered_if_areal
+            <
+                Geometry1, Geometry2, is_areal<Geometry2>::value
+            >::apply(geometry1, geometry2)
+        || detail::distance::covered_if_areal
+            <
+                Geometry2, Geometry1, is_areal<Geometry1>::value
+            >::apply(geometry2, geometry1);
+}
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+struct resolve_strategy
+{
+    typedef Strategy type;
+
+    static inline Strategy const& get(Strategy const& strategy)
+    {
+        return strategy;
+    }
+};
+
+template <typename Geometry1, typename Geometry2>
+struct resolve_strategy<Geometry1, Geometry2, geometry::default_strategy>
+{
+    typedef typename detail::distance::default_strategy
+        <
+            Geometry1, Geometry2
+        >::type type;
+
+    static inline type get(geometry::default_strategy)
+    {
+        return type();
+    }
+};
+
+
+// Linear or areal geometries without segments (e.g. a linestring with one
+// point) are handled by the distance algorithm itself. Pointlike geometries,
+// for which distance is not supported in all coordinate systems, always have
+// features
+template
+<
+    typename Geometry1, typename Geometry2,
+    bool Pointlike = boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry1>::type, pointlike_tag>::type,
+            pointlike_tag
+        >::value
+        && boost::is_same
+        <
+            typename tag_cast<typename tag<Geometry2>::type, pointlike_tag>::type,
+            pointlike_tag
+        >::value
+>
+struct degenerate
+{
+    template <typename Distance, typename Strategy>
+    static inline bool apply(Geometry1 const& geometry1,
+                             Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategy const& strategy)
+    {
+        return geometry::distance(geometry1, geometry2, strategy)
+            <= max_distance;
+    }
+};
+
+template <typename Geometry1, typename Geometry2>
+struct degenerate<Geometry1, Geometry2, true>
+{
+    template <typename Distance, typename Strategy>
+    static inline bool apply(Geometry1 const& , Geometry2 const& ,
+                             Distance const& , Strategy const& )
+    {
+        return false;
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2, typename Strategy, typename Distance>
+inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                  Distance const& max_distance, Strategy const& strategy)
+{
+    bool within = false;
+    if (! boundaries_within
+            <
+                Geometry1, Geometry2, Strategy
+            >::apply(geometry1, geometry2, max_distance, strategy, within))
+    {
+        return degenerate
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategy);
+    }
+    return within || one_inside_other(geometry1, geometry2);
+}
+
+
+}} // namespace detail::distance_within
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks if two geometries are within a specified distance of each other
+\ingroup distance
+\details Returns true if distance(geometry1, geometry2, strategy) is
+    smaller than or equal to the specified maximal distance. The
+    distance itself is not calculated: the check returns as soon as a pair
+    of points or segments is found within the distance, and pairs which
+    are provably farther apart are not visited. It is much faster than
+    calculating the distance for geometries which are either near to or
+    far from each other.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance numerical type of the maximal distance
+\tparam Strategy \tparam_strategy{Distance}
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param max_distance the maximal distance, in the units of the strategy
+    (e.g. in meters for geographic strategies, or in the units of the
+    radius for haversine and cross_track). If the strategy is a comparable
+    strategy, it is compared to the comparable distance.
+\param strategy \param_strategy{distance}
+\return true if the geometries are within the specified distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance, typename Strategy>
+inline bool distance_within(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Distance const& max_distance,
+                            Strategy const& strategy)
+{
+    typedef detail::distance_within::resolve_strategy
+        <
+            Geometry1, Geometry2, Strategy
+        > resolve_type;
+
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::throw_on_empty_input(geometry1);
+    detail::throw_on_empty_input(geometry2);
+
+    return detail::distance_within::apply(geometry1, geometry2,
+                max_distance, resolve_type::get(strategy));
+}
+
+/*!
+\brief Checks if two geometries are within a specified distance of each other
+\ingroup distance
+\details Uses the default distance strategy of the coordinate system
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance numerical type of the maximal distance
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param max_distance the maximal distance
+\return true if the geometries are within the specified distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance>
+inline bool distance_within(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Distance const& max_distance)
+{
+    return geometry::distance_within(geometry1, geometry2, max_distance,
+                                     default_strategy());
+}
+
+
+/*!
+\brief Checks if two geometries are within a specified distance of each other
+    (short name, as in SQL)
+\ingroup distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance, typename Strategy>
+inline bool dwithin(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                    Distance const& max_distance, Strategy const& strategy)
+{
+    return geometry::distance_within(geometry1, geometry2, max_distance,
+                                     strategy);
+}
+
+template <typename Geometry1, typename Geometry2, typename Distance>
+inline bool dwithin(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                    Distance const& max_distance)
+{
+    return geometry::distance_within(geometry1, geometry2, max_distance,
+                                     default_strategy());
+}
+
+
+namespace index
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+namespace predicates
+{
+
+template <typename Geometry, typename Distance>
+struct dwithin
+{
+    dwithin() {}
+    dwithin(Geometry const& g, Distance const& d)
+        : geometry(g)
+        , max_distance(d)
+    {}
+    Geometry geometry;
+    Distance max_distance;
+};
+
+} // namespace predicates
+
+
+template <typename Indexable, typename Tag = typename geometry::tag<Indexable>::type>
+struct dwithin_call
+{
+    template <typename Geometry, typename Distance>
+    static inline bool apply(Indexable const& i, Geometry const& g,
+                             Distance const& max_distance)
+    {
+        return geometry::distance_within(i, g, max_distance);
+    }
+};
+
+template <typename Box>
+struct dwithin_call<Box, box_tag>
+{
+    template <typename Geometry, typename Distance>
+    static inline bool apply(Box const& b, Geometry const& g,
+                             Distance const& max_distance)
+    {
+        return geometry::distance(b, g) <= max_distance;
+    }
+};
+
+
+// Node bounds: the distance to the envelope of the geometry is a lower bound
+// of the distance to any value in the node (cartesian only, other
+// coordinate systems visit all nodes)
+template <typename Box, typename CSTag = typename cs_tag<Box>::type>
+struct dwithin_bounds
+{
+    template <typename Geometry, typename Distance>
+    static inline bool apply(Box const& , Geometry const& , Distance const& )
+    {
+        return true;
+    }
+};
+
+template <typename Box>
+struct dwithin_bounds<Box, cartesian_tag>
+{
+    template <typename Geometry, typename Distance>
+    static inline bool apply(Box const& b, Geometry const& g,
+                             Distance const& max_distance)
+    {
+        Box envelope;
+        geometry::envelope(g, envelope);
+        return geometry::distance(b, envelope) <= max_distance;
+    }
+};
+
+
+template <typename Geometry, typename Distance>
+struct predicate_check<predicates::dwithin<Geometry, Distance>, value_tag>
+{
+    typedef predicates::dwithin<Geometry, Distance> Pred;
+
+    template <typename Value, typename Indexable>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i)
+    {
+        return dwithin_call<Indexable>::apply(i, p.geometry, p.max_distance);
+    }
+};
+
+template <typename Geometry, typename Distance>
+struct predicate_check<predicates::dwithin<Geometry, Distance>, bounds_tag>
+{
+    typedef predicates::dwithin<Geometry, Distance> Pred;
+
+    template <typename Value, typename Indexable>
+    static inline bool apply(Pred const& p, Value const&, Indexable const& i)
+    {
+        return dwithin_bounds<Indexable>::apply(i, p.geometry, p.max_distance);
+    }
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Generate \c dwithin() predicate.
+
+Generate a predicate defining Value and Geometry relationship.
+Value will be returned by the query if
+<tt>bg::distance_within(Indexable, Geometry, max_distance)</tt>
+returns true. Nodes are skipped if their box is farther away from the
+envelope of the Geometry (cartesian coordinate systems).
+
+\par Example
+\verbatim
+bgi::query(spatial_index, bgi::dwithin(linestring, 10.0), std::back_inserter(result));
+\endverbatim
+
+\ingroup predicates
+
+\tparam Geometry    The Geometry type.
+\tparam Distance    The numerical type of the distance.
+
+\param g            The Geometry object.
+\param max_distance The maximal distance.
+*/
+template <typename Geometry, typename Distance>
+inline detail::predicates::dwithin<Geometry, Distance>
+dwithin(Geometry const& g, Distance const& max_distance)
+{
+    return detail::predicates::dwithin<Geometry, Distance>(g, max_distance);
+}
+
+
+} // namespace index
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_DISTANCE_WITHIN_HPP
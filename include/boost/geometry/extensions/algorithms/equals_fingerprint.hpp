@@ -0,0 +1,312 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_EQUALS_FINGERPRINT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_EQUALS_FINGERPRINT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/equals/collect_vectors.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace equals_fingerprint
+{
+
+
+// Finalizer of splitmix64, spreads all input bits over all output bits
+inline boost::uint64_t mix(boost::uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+inline boost::uint64_t bits(double value)
+{
+    // -0 and 0 are equal coordinates
+    if (value == 0.0)
+    {
+        value = 0.0;
+    }
+    boost::uint64_t result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+
+// Collects the vectors as equals does, and combines the hashes of their
+// start points. Collected vectors do not contain duplicate points and
+// collinear points, and each corner of a ring is the start point of one
+// vector, whatever the orientation and the start point of the ring.
+// The hashes are added, such that the order of the vectors, of the rings
+// and of the polygons does not matter
+struct areal
+{
+    template <typename Geometry>
+    static inline std::size_t apply(Geometry const& geometry)
+    {
+        typedef std::vector<collected_vector<double> > collection_type;
+
+        collection_type collection;
+        geometry::collect_vectors(collection, geometry);
+
+        boost::uint64_t sum = 0;
+        for (collection_type::const_iterator it = collection.begin();
+             it != collection.end(); ++it)
+        {
+            sum += mix(mix(bits(it->x)) ^ bits(it->y));
+        }
+        return static_cast<std::size_t>(
+            mix(sum ^ static_cast<boost::uint64_t>(collection.size())));
+    }
+};
+
+
+// Fingerprints and indexes of one of the ranges, sorted by fingerprint
+class fingerprint_index
+{
+public:
+    typedef std::pair<std::size_t, std::size_t> entry_type;
+    typedef std::vector<entry_type>::const_iterator iterator;
+
+    template <typename Range>
+    explicit fingerprint_index(Range const& geometries)
+    {
+        std::size_t const count = boost::size(geometries);
+        m_entries.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_entries.push_back(entry_type(
+                areal::apply(range::at(geometries, i)), i));
+        }
+        std::sort(m_entries.begin(), m_entries.end());
+    }
+
+    inline std::pair<iterator, iterator> find(std::size_t fingerprint) const
+    {
+        return std::equal_range(m_entries.begin(), m_entries.end(),
+                                fingerprint, less_fingerprint());
+    }
+
+    inline iterator begin() const { return m_entries.begin(); }
+    inline iterator end() const { return m_entries.end(); }
+
+private:
+    struct less_fingerprint
+    {
+        inline bool operator()(entry_type const& entry, std::size_t fp) const
+        {
+            return entry.first < fp;
+        }
+        inline bool operator()(std::size_t fp, entry_type const& entry) const
+        {
+            return fp < entry.first;
+        }
+    };
+
+    std::vector<entry_type> m_entries;
+};
+
+
+}} // namespace detail::equals_fingerprint
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct equals_fingerprint : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct equals_fingerprint<Ring, ring_tag>
+    : detail::equals_fingerprint::areal
+{};
+
+template <typename Polygon>
+struct equals_fingerprint<Polygon, polygon_tag>
+    : detail::equals_fingerprint::areal
+{};
+
+template <typename MultiPolygon>
+struct equals_fingerprint<MultiPolygon, multi_polygon_tag>
+    : detail::equals_fingerprint::areal
+{};
+
+template <typename Box>
+struct equals_fingerprint<Box, box_tag>
+    : detail::equals_fingerprint::areal
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates a fingerprint of an areal geometry, which is the same
+    for geometries which are spatially equal
+\ingroup equals
+\details The fingerprint is a hash of the corners of the geometry, as
+    collected by equals. It does not depend on the orientation and the
+    start points of the rings, nor on the order of the interior rings and
+    polygons, and duplicate and collinear points are ignored. Geometries
+    with the same fingerprint are candidates to be equal, this should be
+    confirmed by geometry::equals. Geometries which are equal, but of
+    which corners differ within the tolerance of equals, or which have
+    nearly collinear points, can have different fingerprints.
+\tparam Geometry \tparam_geometry (ring, polygon, multi-polygon or box)
+\param geometry \param_geometry
+\return the fingerprint
+*/
+template <typename Geometry>
+inline std::size_t equals_fingerprint(Geometry const& geometry)
+{
+    concept::check<Geometry const>();
+
+    return dispatch::equals_fingerprint<Geometry>::apply(geometry);
+}
+
+
+/*!
+\brief Finds all pairs of equal geometries of two ranges
+\ingroup equals
+\details The geometries of the second range are indexed by their
+    fingerprint, and each geometry of the first range is only compared,
+    using geometry::equals, with the geometries having the same
+    fingerprint.
+\tparam Range1 random access range of areal geometries
+\tparam Range2 random access range of areal geometries
+\tparam OutputIterator output iterator for std::pair<std::size_t, std::size_t>
+\param geometries1 first range
+\param geometries2 second range
+\param out receives, per equal pair, the index in the first range and the
+    index in the second range, ordered by index in the first range
+\return the output iterator
+*/
+template <typename Range1, typename Range2, typename OutputIterator>
+inline OutputIterator equals_join(Range1 const& geometries1,
+                                  Range2 const& geometries2,
+                                  OutputIterator out)
+{
+    typedef detail::equals_fingerprint::fingerprint_index index_type;
+    typedef typename boost::range_value<Range1>::type geometry1_type;
+
+    index_type const index(geometries2);
+
+    std::size_t const count = boost::size(geometries1);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        geometry1_type const& geometry = range::at(geometries1, i);
+        std::pair<index_type::iterator, index_type::iterator> const candidates
+            = index.find(geometry::equals_fingerprint(geometry));
+
+        for (index_type::iterator it = candidates.first;
+             it != candidates.second; ++it)
+        {
+            if (geometry::equals(geometry, range::at(geometries2, it->second)))
+            {
+                *out++ = std::make_pair(i, it->second);
+            }
+        }
+    }
+    return out;
+}
+
+
+/*!
+\brief Finds the duplicates in a range of geometries
+\ingroup equals
+\details Geometries are only compared, using geometry::equals, with the
+    geometries having the same fingerprint.
+\tparam Range random access range of areal geometries
+\param geometries input geometries
+\param first_equal is resized to the size of the range, each element is the
+    index of the first geometry which is equal to the corresponding geometry
+    (which is its own index if no geometry before it is equal)
+\return the number of unique geometries
+*/
+template <typename Range>
+inline std::size_t equals_duplicates(Range const& geometries,
+                                     std::vector<std::size_t>& first_equal)
+{
+    typedef detail::equals_fingerprint::fingerprint_index index_type;
+
+    index_type const index(geometries);
+
+    std::size_t const count = boost::size(geometries);
+    first_equal.resize(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        first_equal[i] = i;
+    }
+
+    // Per range of candidates, ordered by index, compare each geometry not
+    // yet found to be a duplicate with the following geometries
+    std::size_t result = 0;
+    for (index_type::iterator first = index.begin(); first != index.end(); )
+    {
+        index_type::iterator last = first + 1;
+        while (last != index.end() && last->first == first->first)
+        {
+            ++last;
+        }
+
+        for (index_type::iterator it = first; it != last; ++it)
+        {
+            if (first_equal[it->second] != it->second)
+            {
+                continue;
+            }
+            result++;
+            for (index_type::iterator next = it + 1; next != last; ++next)
+            {
+                if (first_equal[next->second] == next->second
+                    && geometry::equals(range::at(geometries, it->second),
+                                        range::at(geometries, next->second)))
+                {
+                    first_equal[next->second] = it->second;
+                }
+            }
+        }
+        first = last;
+    }
+    return result;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_EQUALS_FINGERPRINT_HPP
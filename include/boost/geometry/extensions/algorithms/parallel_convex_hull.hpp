@@ -0,0 +1,130 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_CONVEX_HULL_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_CONVEX_HULL_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/algorithms/convex_hull_accumulator.hpp>
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel_convex_hull
+{
+
+
+template <typename Range, typename Accumulator>
+struct partial_hull
+{
+    Range const& range;
+    std::size_t chunk_size;
+    std::vector<Accumulator>& partials;
+
+    partial_hull(Range const& r, std::size_t size, std::vector<Accumulator>& p)
+        : range(r)
+        , chunk_size(size)
+        , partials(p)
+    {}
+
+    inline void operator()(std::size_t chunk) const
+    {
+        std::size_t const count = boost::size(range);
+        std::size_t const first = chunk * chunk_size;
+        std::size_t const last = first + chunk_size < count
+                               ? first + chunk_size : count;
+
+        Accumulator& accumulator = partials[chunk];
+        for (std::size_t i = first; i < last; i++)
+        {
+            accumulator.add(range::at(range, i));
+        }
+        accumulator.reduce();
+    }
+};
+
+
+}} // namespace detail::parallel_convex_hull
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the convex hull of a large range of points in parallel
+\details The points are divided in chunks, the hull of each chunk is
+    calculated in a separate thread. The final hull is the convex hull of
+    the vertices of all partial hulls. The result is the same as the result
+    of geometry::convex_hull.
+\tparam Geometry random access range of points (multi-point, linestring
+    or ring)
+\tparam OutputGeometry \tparam_geometry
+\param geometry input points
+\param hull output geometry, receiving the convex hull
+\param thread_count number of threads, 0 means the hardware concurrency
+\param chunk_size maximum number of points per task
+\ingroup convex_hull
+*/
+template <typename Geometry, typename OutputGeometry>
+inline void parallel_convex_hull(Geometry const& geometry,
+                                 OutputGeometry& hull,
+                                 std::size_t thread_count = 0,
+                                 std::size_t chunk_size = 1 << 20)
+{
+    concept::check<Geometry const>();
+    concept::check<OutputGeometry>();
+
+    typedef typename point_type<Geometry>::type point_type;
+    typedef convex_hull_accumulator<point_type> accumulator_type;
+
+    std::size_t const count = boost::size(geometry);
+    if (thread_count == 0)
+    {
+        thread_count = detail::parallel::default_thread_count();
+    }
+
+    // Use at least a few chunks per thread, for load balancing
+    std::size_t const per_thread = (count + 4 * thread_count - 1)
+                                 / (4 * thread_count);
+    if (per_thread < chunk_size)
+    {
+        chunk_size = per_thread < 1024 ? 1024 : per_thread;
+    }
+
+    std::size_t const chunks = (count + chunk_size - 1) / chunk_size;
+    std::vector<accumulator_type> partials(chunks,
+                                           accumulator_type(chunk_size));
+
+    detail::parallel_convex_hull::partial_hull<Geometry, accumulator_type> const
+        function(geometry, chunk_size, partials);
+    detail::parallel::for_each_index(chunks, function, thread_count, 1);
+
+    accumulator_type accumulator;
+    for (std::size_t i = 0; i < partials.size(); i++)
+    {
+        accumulator.merge(partials[i]);
+    }
+    accumulator.result(hull);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_CONVEX_HULL_HPP
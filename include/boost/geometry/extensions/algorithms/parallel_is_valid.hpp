@@ -0,0 +1,475 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
+
+
+#include <cstddef>
+#include <deque>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/multipolygon.hpp>
+
+#include <boost/geometry/policies/is_valid/default_policy.hpp>
+#include <boost/geometry/policies/is_valid/failing_reason_policy.hpp>
+#include <boost/geometry/policies/is_valid/failure_type_policy.hpp>
+
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+#include <atomic>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel_is_valid
+{
+
+
+// The policy used in the threads. It should decide as the visit policy of
+// the caller, without writing shared state. The known policies are mapped
+// to the default policy with the same template parameters, other policies
+// are copied
+template <typename VisitPolicy>
+struct thread_policy
+{
+    typedef VisitPolicy type;
+};
+
+template <bool AllowDuplicates, bool AllowSpikes>
+struct thread_policy<failure_type_policy<AllowDuplicates, AllowSpikes> >
+{
+    typedef is_valid_default_policy<AllowDuplicates, AllowSpikes> type;
+};
+
+template <bool AllowDuplicates, bool AllowSpikes>
+struct thread_policy<failing_reason_policy<AllowDuplicates, AllowSpikes> >
+{
+    typedef is_valid_default_policy<AllowDuplicates, AllowSpikes> type;
+};
+
+template <typename Policy, typename VisitPolicy>
+inline Policy make_thread_policy(VisitPolicy const& , Policy* = 0)
+{
+    return Policy();
+}
+
+template <typename VisitPolicy>
+inline VisitPolicy make_thread_policy(VisitPolicy const& visitor, VisitPolicy* = 0)
+{
+    return visitor;
+}
+
+
+// Keeps the lowest index of the polygons found to be invalid, such that
+// polygons after it do not need to be checked anymore (the serial
+// algorithm would stop there as well)
+class lowest_index
+{
+public:
+    explicit lowest_index(std::size_t none)
+        : m_index(none)
+    {}
+
+    inline std::size_t get() const
+    {
+#ifdef BOOST_GEOMETRY_USE_THREADS
+        return m_index.load(std::memory_order_relaxed);
+#else
+        return m_index;
+#endif
+    }
+
+    inline void update(std::size_t index)
+    {
+#ifdef BOOST_GEOMETRY_USE_THREADS
+        std::size_t current = m_index.load();
+        while (index < current
+               && ! m_index.compare_exchange_weak(current, index))
+        {}
+#else
+        if (index < m_index)
+        {
+            m_index = index;
+        }
+#endif
+    }
+
+private:
+#ifdef BOOST_GEOMETRY_USE_THREADS
+    std::atomic<std::size_t> m_index;
+#else
+    std::size_t m_index;
+#endif
+};
+
+
+template <typename MultiPolygon, bool AllowEmptyMultiGeometries>
+class parallel_is_valid_multipolygon
+    : detail::is_valid::is_valid_multipolygon
+        <
+            MultiPolygon, AllowEmptyMultiGeometries
+        >
+{
+    typedef detail::is_valid::is_valid_multipolygon
+        <
+            MultiPolygon, AllowEmptyMultiGeometries
+        > serial;
+    typedef typename serial::base base;
+
+    // The checks per polygon, in the order of the serial algorithm
+    struct check_rings
+    {
+        template <typename Polygon, typename TurnsPerPolygon, typename VisitPolicy>
+        static inline bool apply(Polygon const& polygon,
+                                 TurnsPerPolygon const* ,
+                                 std::size_t ,
+                                 VisitPolicy& visitor)
+        {
+            return base::apply(polygon, visitor);
+        }
+    };
+
+    template <typename Predicate>
+    struct check_turns
+    {
+        template <typename Polygon, typename TurnsPerPolygon, typename VisitPolicy>
+        static inline bool apply(Polygon const& polygon,
+                                 TurnsPerPolygon const* turns,
+                                 std::size_t multi_index,
+                                 VisitPolicy& visitor)
+        {
+            return Predicate::apply(polygon,
+                                    turns->begin(multi_index),
+                                    turns->end(multi_index),
+                                    visitor);
+        }
+    };
+
+    template
+    <
+        typename Check, typename TurnsPerPolygon, typename Policy
+    >
+    struct check_polygon
+    {
+        MultiPolygon const& multipolygon;
+        TurnsPerPolygon const* turns;
+        Policy const& prototype;
+        lowest_index& invalid;
+
+        check_polygon(MultiPolygon const& mp, TurnsPerPolygon const* t,
+                      Policy const& p, lowest_index& i)
+            : multipolygon(mp)
+            , turns(t)
+            , prototype(p)
+            , invalid(i)
+        {}
+
+        inline void operator()(std::size_t i) const
+        {
+            if (invalid.get() < i)
+            {
+                // A polygon before this one is invalid
+                return;
+            }
+
+            Policy policy = prototype;
+            if (! Check::apply(range::at(multipolygon, i), turns, i, policy))
+            {
+                invalid.update(i);
+            }
+        }
+    };
+
+    // Checks all polygons in parallel. If any is invalid, the first invalid
+    // polygon is checked again with the visitor of the caller, which then
+    // receives the same report as with the serial algorithm. Returns false
+    // if a polygon is invalid
+    template <typename Check, typename TurnsPerPolygon, typename VisitPolicy>
+    static inline bool check_all(MultiPolygon const& multipolygon,
+                                 TurnsPerPolygon const* turns,
+                                 VisitPolicy& visitor,
+                                 std::size_t thread_count)
+    {
+        typedef typename thread_policy<VisitPolicy>::type policy_type;
+
+        std::size_t const count = boost::size(multipolygon);
+        policy_type const prototype
+            = make_thread_policy(visitor, static_cast<policy_type*>(0));
+        lowest_index invalid(count);
+
+        check_polygon<Check, TurnsPerPolygon, policy_type> const
+            function(multipolygon, turns, prototype, invalid);
+
+        detail::parallel::for_each_index(count, function, thread_count, 64);
+
+        std::size_t const index = invalid.get();
+        return index == count
+            || Check::apply(range::at(multipolygon, index), turns,
+                            index, visitor);
+    }
+
+public:
+    template <typename VisitPolicy>
+    static inline bool apply(MultiPolygon const& multipolygon,
+                             VisitPolicy& visitor,
+                             std::size_t thread_count)
+    {
+        if (BOOST_GEOMETRY_CONDITION(
+                AllowEmptyMultiGeometries && boost::empty(multipolygon)))
+        {
+            return visitor.template apply<no_failure>();
+        }
+
+        if (boost::empty(multipolygon))
+        {
+            // The serial algorithm reports the empty range
+            return serial::apply(multipolygon, visitor);
+        }
+
+        typedef detail::is_valid::has_valid_self_turns
+            <
+                MultiPolygon
+            > has_valid_turns;
+        typedef typename has_valid_turns::turn_type turn_type;
+        typedef detail::is_valid::turns_per_polygon<turn_type> turns_per_polygon;
+
+        // check validity of all polygons rings
+        if (! check_all<check_rings>(multipolygon,
+                static_cast<turns_per_polygon const*>(0),
+                visitor, thread_count))
+        {
+            return false;
+        }
+
+        // compute turns and check if all are acceptable
+        std::deque<turn_type> turns;
+        if (! has_valid_turns::apply(multipolygon, turns, visitor))
+        {
+            return false;
+        }
+
+        turns_per_polygon const polygon_turns(turns.begin(), turns.end(),
+                                              boost::size(multipolygon));
+
+        // check if each polygon's interior rings are inside the
+        // exterior and not one inside the other
+        if (! check_all<check_turns<typename base::has_holes_inside> >(
+                multipolygon, &polygon_turns, visitor, thread_count))
+        {
+            return false;
+        }
+
+        // check that each polygon's interior is connected
+        if (! check_all<check_turns<typename base::has_connected_interior> >(
+                multipolygon, &polygon_turns, visitor, thread_count))
+        {
+            return false;
+        }
+
+        // check if polygon interiors are disjoint
+        return serial::are_polygon_interiors_disjoint(boost::begin(multipolygon),
+                                                      boost::end(multipolygon),
+                                                      turns.begin(),
+                                                      turns.end(),
+                                                      visitor);
+    }
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct parallel_is_valid
+{
+    // Other geometries are checked in the calling thread
+    template <typename VisitPolicy>
+    static inline bool apply(Geometry const& geometry, VisitPolicy& visitor,
+                             std::size_t )
+    {
+        return geometry::is_valid(geometry, visitor);
+    }
+};
+
+template <typename MultiPolygon>
+struct parallel_is_valid<MultiPolygon, multi_polygon_tag>
+    : parallel_is_valid_multipolygon<MultiPolygon, true>
+{};
+
+
+template <typename InputRange>
+struct is_valid_element
+{
+    InputRange const& input;
+    std::vector<validity_failure_type>& failures;
+
+    is_valid_element(InputRange const& in,
+                     std::vector<validity_failure_type>& f)
+        : input(in)
+        , failures(f)
+    {}
+
+    inline void operator()(std::size_t i) const
+    {
+        failure_type_policy<> policy;
+        failures[i] = geometry::is_valid(range::at(input, i), policy)
+                    ? no_failure : policy.failure();
+    }
+};
+
+
+}} // namespace detail::parallel_is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks if a geometry is valid (in the OGC sense), checking the
+    polygons of a multi-polygon in parallel
+\ingroup is_valid
+\details The result and the calls to the visitor are the same as for
+    geometry::is_valid. The rings, holes and interiors of the polygons of a
+    multi-polygon are checked per polygon, distributed over a number of
+    threads. If a polygon is invalid, following polygons are skipped and
+    the first invalid polygon is reported to the visitor. The self turns
+    and the disjointness of the polygons are checked in the calling thread.
+    Other geometries are checked serially.
+    In the threads, failure_type_policy and failing_reason_policy are
+    replaced by is_valid_default_policy, other policies are copied.
+\tparam Geometry \tparam_geometry
+\tparam VisitPolicy \tparam_strategy{Visit policy}
+\param geometry \param_geometry
+\param visitor \param_strategy{visit policy}
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename Geometry, typename VisitPolicy>
+inline bool parallel_is_valid(Geometry const& geometry, VisitPolicy& visitor,
+                              std::size_t thread_count = 0)
+{
+    concept::check<Geometry const>();
+
+    return detail::parallel_is_valid::parallel_is_valid
+        <
+            Geometry
+        >::apply(geometry, visitor, thread_count);
+}
+
+/*!
+\brief Checks if a geometry is valid (in the OGC sense), checking the
+    polygons of a multi-polygon in parallel
+\ingroup is_valid
+\param geometry \param_geometry
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename Geometry>
+inline bool parallel_is_valid(Geometry const& geometry,
+                              std::size_t thread_count = 0)
+{
+    is_valid_default_policy<> policy_visitor;
+    return geometry::parallel_is_valid(geometry, policy_visitor, thread_count);
+}
+
+/*!
+\brief Checks if a geometry is valid (in the OGC sense), checking the
+    polygons of a multi-polygon in parallel
+\ingroup is_valid
+\param geometry \param_geometry
+\param failure An enumeration value indicating that the geometry is
+    valid or not, and if not valid indicating the reason why
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename Geometry>
+inline bool parallel_is_valid(Geometry const& geometry,
+                              validity_failure_type& failure,
+                              std::size_t thread_count = 0)
+{
+    failure_type_policy<> policy_visitor;
+    bool result = geometry::parallel_is_valid(geometry, policy_visitor,
+                                              thread_count);
+    failure = policy_visitor.failure();
+    return result;
+}
+
+/*!
+\brief Checks if a geometry is valid (in the OGC sense), checking the
+    polygons of a multi-polygon in parallel
+\ingroup is_valid
+\param geometry \param_geometry
+\param message A string containing a message stating if the geometry
+    is valid or not, and if not valid a reason why
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template <typename Geometry>
+inline bool parallel_is_valid(Geometry const& geometry,
+                              std::string& message,
+                              std::size_t thread_count = 0)
+{
+    std::ostringstream stream;
+    failing_reason_policy<> policy_visitor(stream);
+    bool result = geometry::parallel_is_valid(geometry, policy_visitor,
+                                              thread_count);
+    message = stream.str();
+    return result;
+}
+
+
+/*!
+\brief Checks all geometries of a range for validity, in parallel
+\ingroup is_valid
+\details The failures are resized to the size of the range, each of its
+    elements is the failure type geometry::is_valid reports for the
+    corresponding geometry (no_failure if it is valid).
+\tparam InputRange random access range of geometries
+\param geometries input geometries
+\param failures the failure type per geometry
+\param thread_count number of threads, 0 means the hardware concurrency
+\return true if all geometries are valid
+*/
+template <typename InputRange>
+inline bool parallel_is_valid_each(InputRange const& geometries,
+                                   std::vector<validity_failure_type>& failures,
+                                   std::size_t thread_count = 0)
+{
+    concept::check<typename boost::range_value<InputRange>::type const>();
+
+    std::size_t const count = boost::size(geometries);
+    failures.assign(count, no_failure);
+
+    detail::parallel_is_valid::is_valid_element<InputRange> const
+        function(geometries, failures);
+    detail::parallel::for_each_index(count, function, thread_count, 64);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (failures[i] != no_failure)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_IS_VALID_HPP
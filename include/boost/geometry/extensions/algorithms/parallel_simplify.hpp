@@ -0,0 +1,233 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_SIMPLIFY_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_SIMPLIFY_HPP
+
+
+#include <cstddef>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel_simplify
+{
+
+
+template
+<
+    typename InputRange, typename OutputRange,
+    typename Distance, typename Strategy
+>
+struct simplify_element
+{
+    InputRange const& input;
+    OutputRange& output;
+    Distance const& max_distance;
+    Strategy const& strategy;
+
+    simplify_element(InputRange const& in, OutputRange& out,
+                     Distance const& md, Strategy const& s)
+        : input(in)
+        , output(out)
+        , max_distance(md)
+        , strategy(s)
+    {}
+
+    inline void operator()(std::size_t i) const
+    {
+        geometry::simplify(range::at(input, i), range::at(output, i),
+                           max_distance, strategy);
+    }
+};
+
+
+// Simplifies all geometries of the input range into the
+// corresponding elements of the (resized) output range
+template
+<
+    typename InputRange, typename OutputRange,
+    typename Distance, typename Strategy
+>
+inline void apply_each(InputRange const& input, OutputRange& output,
+                       Distance const& max_distance, Strategy const& strategy,
+                       std::size_t thread_count)
+{
+    std::size_t const count = boost::size(input);
+    traits::resize<OutputRange>::apply(output, count);
+
+    simplify_element<InputRange, OutputRange, Distance, Strategy> const
+        function(input, output, max_distance, strategy);
+
+    // Geometries are usually small, hand them out in chunks
+    detail::parallel::for_each_index(count, function, thread_count, 64);
+}
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct parallel_simplify
+{
+    // Non-multi geometries are simplified in the calling thread
+    template <typename Distance, typename Strategy>
+    static inline void apply(Geometry const& geometry, Geometry& out,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             std::size_t )
+    {
+        geometry::simplify(geometry, out, max_distance, strategy);
+    }
+};
+
+template <typename MultiGeometry>
+struct parallel_simplify<MultiGeometry, multi_linestring_tag>
+{
+    template <typename Distance, typename Strategy>
+    static inline void apply(MultiGeometry const& multi, MultiGeometry& out,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             std::size_t thread_count)
+    {
+        geometry::clear(out);
+        apply_each(multi, out, max_distance, strategy, thread_count);
+    }
+};
+
+template <typename MultiGeometry>
+struct parallel_simplify<MultiGeometry, multi_polygon_tag>
+    : parallel_simplify<MultiGeometry, multi_linestring_tag>
+{};
+
+
+}} // namespace detail::parallel_simplify
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Simplify a geometry using a specified strategy, processing the
+    elements of multi-geometries in parallel
+\ingroup simplify
+\details The output is identical to the output of geometry::simplify,
+    the members of a multi-linestring or multi-polygon are distributed
+    over a number of threads. Other geometries are simplified serially.
+    Without thread support (or if BOOST_GEOMETRY_NO_THREADS is defined)
+    this is equivalent to geometry::simplify.
+\tparam Geometry \tparam_geometry
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template<typename Geometry, typename Distance, typename Strategy>
+inline void parallel_simplify(Geometry const& geometry, Geometry& out,
+                              Distance const& max_distance,
+                              Strategy const& strategy,
+                              std::size_t thread_count = 0)
+{
+    concept::check<Geometry>();
+
+    detail::parallel_simplify::parallel_simplify
+        <
+            Geometry
+        >::apply(geometry, out, max_distance, strategy, thread_count);
+}
+
+/*!
+\brief Simplify a geometry, processing the elements of multi-geometries
+    in parallel
+\ingroup simplify
+\tparam Geometry \tparam_geometry
+\tparam Distance \tparam_numeric
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template<typename Geometry, typename Distance>
+inline void parallel_simplify(Geometry const& geometry, Geometry& out,
+                              Distance const& max_distance)
+{
+    geometry::parallel_simplify(geometry, out, max_distance,
+                                default_strategy());
+}
+
+
+/*!
+\brief Simplify all geometries of a range in parallel
+\ingroup simplify
+\details The output range is resized to the size of the input range,
+    each of its elements is the result of geometry::simplify of the
+    corresponding input geometry.
+\tparam InputRange random access range of geometries
+\tparam OutputRange resizable random access range of the same geometry type
+\param geometries input geometries, to be simplified
+\param out output range, receiving the simplified geometries
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification
+\param thread_count number of threads, 0 means the hardware concurrency
+*/
+template
+<
+    typename InputRange, typename OutputRange,
+    typename Distance, typename Strategy
+>
+inline void parallel_simplify_each(InputRange const& geometries,
+                                   OutputRange& out,
+                                   Distance const& max_distance,
+                                   Strategy const& strategy,
+                                   std::size_t thread_count = 0)
+{
+    concept::check<typename boost::range_value<InputRange>::type const>();
+
+    detail::parallel_simplify::apply_each(geometries, out, max_distance,
+                                          strategy, thread_count);
+}
+
+/*!
+\brief Simplify all geometries of a range in parallel
+\ingroup simplify
+\param geometries input geometries, to be simplified
+\param out output range, receiving the simplified geometries
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template <typename InputRange, typename OutputRange, typename Distance>
+inline void parallel_simplify_each(InputRange const& geometries,
+                                   OutputRange& out,
+                                   Distance const& max_distance)
+{
+    geometry::parallel_simplify_each(geometries, out, max_distance,
+                                     default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_PARALLEL_SIMPLIFY_HPP
@@ -0,0 +1,612 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_PRESERVE_TOPOLOGY_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_PRESERVE_TOPOLOGY_HPP
+
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_preserve_topology
+{
+
+
+// Calls the visitor for all linear ranges of a geometry, in a fixed order.
+// The visitor gets the range and a flag indicating if it is a ring.
+template <typename Tag>
+struct visit_ranges {};
+
+template <>
+struct visit_ranges<linestring_tag>
+{
+    template <typename Geometry, typename Visitor>
+    static inline void apply(Geometry& geometry, Visitor& visitor)
+    {
+        visitor(geometry, false);
+    }
+};
+
+template <>
+struct visit_ranges<ring_tag>
+{
+    template <typename Geometry, typename Visitor>
+    static inline void apply(Geometry& geometry, Visitor& visitor)
+    {
+        visitor(geometry, true);
+    }
+};
+
+template <>
+struct visit_ranges<polygon_tag>
+{
+    template <typename Geometry, typename Visitor>
+    static inline void apply(Geometry& polygon, Visitor& visitor)
+    {
+        visitor(geometry::exterior_ring(polygon), true);
+
+        typename interior_return_type<Geometry>::type
+            rings = geometry::interior_rings(polygon);
+        for (typename detail::interior_iterator<Geometry>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            visitor(*it, true);
+        }
+    }
+};
+
+template <typename SingleTag>
+struct visit_multi_ranges
+{
+    template <typename Geometry, typename Visitor>
+    static inline void apply(Geometry& multi, Visitor& visitor)
+    {
+        for (typename boost::range_iterator<Geometry>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            visit_ranges<SingleTag>::apply(*it, visitor);
+        }
+    }
+};
+
+template <>
+struct visit_ranges<multi_linestring_tag>
+    : visit_multi_ranges<linestring_tag>
+{};
+
+template <>
+struct visit_ranges<multi_polygon_tag>
+    : visit_multi_ranges<polygon_tag>
+{};
+
+
+/*!
+    \brief Visvalingam-Whyatt simplification of all ranges of a geometry,
+        rejecting vertex removals which would introduce intersections
+    \details All vertices are kept in doubly linked lists per range. Vertices
+        are removed in order of increasing effective area (the area of
+        the triangle formed with its neighbours), using a priority queue.
+        An rtree contains all current segments. A removal is rejected if
+        any other segment intersects the triangle which is cut off, so
+        the result does not self-intersect, and rings do not cross or
+        swap sides with other rings, if the input did not.
+*/
+template <typename Point, bool Closed>
+class simplifier
+{
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    typedef model::box<Point> box_type;
+    // A segment is identified by the index of its first vertex
+    typedef std::pair<box_type, std::size_t> segment_value;
+    typedef index::rtree<segment_value, index::rstar<16> > rtree_type;
+    typedef strategy::side::side_by_triangle<> side_strategy;
+
+    static const std::size_t none = std::size_t(-1);
+
+    struct vertex
+    {
+        Point point;
+        std::size_t prev;
+        std::size_t next;
+        std::size_t range_index;
+        std::size_t version;
+        bool removed;
+    };
+
+    struct range_info
+    {
+        std::size_t first;
+        std::size_t count;
+        bool is_ring;
+    };
+
+    // Queue entry: effective area, vertex, version of the vertex
+    struct candidate
+    {
+        calculation_type area;
+        std::size_t index;
+        std::size_t version;
+
+        // Smallest area first, then lowest index, for determinism
+        inline bool operator<(candidate const& other) const
+        {
+            return area != other.area
+                ? other.area < area
+                : other.index < index;
+        }
+    };
+
+public :
+
+    // Visitor collecting the vertices of all ranges
+    struct collector
+    {
+        simplifier& m_simplifier;
+        explicit collector(simplifier& s) : m_simplifier(s) {}
+
+        template <typename Range>
+        inline void operator()(Range const& range, bool is_ring)
+        {
+            m_simplifier.add_range(range, is_ring);
+        }
+    };
+
+    // Visitor replacing all ranges by their simplified versions,
+    // ranges are visited in the same order as by the collector
+    struct writer
+    {
+        simplifier const& m_simplifier;
+        std::size_t m_index;
+        explicit writer(simplifier const& s) : m_simplifier(s), m_index(0) {}
+
+        template <typename Range>
+        inline void operator()(Range& range, bool is_ring)
+        {
+            m_simplifier.write_range(m_index++, range, is_ring);
+        }
+    };
+
+    template <typename Range>
+    inline void add_range(Range const& range, bool is_ring)
+    {
+        range_info info;
+        info.first = m_vertices.size();
+        info.is_ring = is_ring;
+
+        std::size_t count = boost::size(range);
+        if (is_ring && Closed && count > 0)
+        {
+            // Skip the closing point
+            count--;
+        }
+
+        typename boost::range_iterator<Range const>::type
+            it = boost::begin(range);
+        for (std::size_t i = 0; i < count; ++i, ++it)
+        {
+            vertex v;
+            geometry::convert(*it, v.point);
+            v.prev = i > 0 ? info.first + i - 1
+                   : is_ring ? info.first + count - 1 : none;
+            v.next = i + 1 < count ? info.first + i + 1
+                   : is_ring ? info.first : none;
+            v.range_index = m_ranges.size();
+            v.version = 0;
+            v.removed = false;
+            m_vertices.push_back(v);
+        }
+
+        info.count = count;
+        m_ranges.push_back(info);
+    }
+
+    template <typename Range>
+    inline void write_range(std::size_t index, Range& range,
+                            bool is_ring) const
+    {
+        range_info const& info = m_ranges[index];
+        range::clear(range);
+
+        if (info.count == 0)
+        {
+            return;
+        }
+
+        std::size_t const start = info.first;
+        std::size_t i = start;
+        do
+        {
+            range::push_back(range, m_vertices[i].point);
+            i = m_vertices[i].next;
+        } while (i != none && i != start);
+
+        if (is_ring && Closed)
+        {
+            range::push_back(range, m_vertices[start].point);
+        }
+    }
+
+    inline void simplify(calculation_type const& max_area)
+    {
+        build_rtree();
+
+        std::priority_queue<candidate> queue;
+        for (std::size_t i = 0; i < m_vertices.size(); i++)
+        {
+            push(queue, i, max_area);
+        }
+
+        while (! queue.empty())
+        {
+            candidate const c = queue.top();
+            queue.pop();
+
+            vertex const& v = m_vertices[c.index];
+            if (v.removed || v.version != c.version || ! removable(c.index))
+            {
+                continue;
+            }
+
+            if (! intersects_others(c.index))
+            {
+                remove(c.index);
+                m_vertices[v.prev].version++;
+                m_vertices[v.next].version++;
+                push(queue, v.prev, max_area);
+                push(queue, v.next, max_area);
+            }
+        }
+    }
+
+private :
+
+    inline bool removable(std::size_t i) const
+    {
+        vertex const& v = m_vertices[i];
+        if (v.prev == none || v.next == none)
+        {
+            // End points of linestrings are always kept
+            return false;
+        }
+        range_info const& info = m_ranges[v.range_index];
+        return info.is_ring ? info.count > 3 : info.count > 2;
+    }
+
+    inline calculation_type effective_area(std::size_t i) const
+    {
+        vertex const& v = m_vertices[i];
+        Point const& p0 = m_vertices[v.prev].point;
+        Point const& p1 = v.point;
+        Point const& p2 = m_vertices[v.next].point;
+
+        calculation_type const x0 = get<0>(p0), y0 = get<1>(p0);
+        calculation_type const cross
+            = (calculation_type(get<0>(p1)) - x0) * (calculation_type(get<1>(p2)) - y0)
+            - (calculation_type(get<0>(p2)) - x0) * (calculation_type(get<1>(p1)) - y0);
+        return geometry::math::abs(cross) / calculation_type(2);
+    }
+
+    inline void push(std::priority_queue<candidate>& queue,
+                     std::size_t i,
+                     calculation_type const& max_area) const
+    {
+        if (! removable(i))
+        {
+            return;
+        }
+        candidate c;
+        c.area = effective_area(i);
+        c.index = i;
+        c.version = m_vertices[i].version;
+        if (c.area <= max_area)
+        {
+            queue.push(c);
+        }
+    }
+
+    static inline box_type make_box(Point const& p1, Point const& p2)
+    {
+        box_type box;
+        geometry::detail::assign_point_to_index<0>(p1, box);
+        geometry::detail::assign_point_to_index<1>(p1, box);
+        geometry::expand(box, p2);
+        return box;
+    }
+
+    inline segment_value make_segment(std::size_t i) const
+    {
+        return segment_value(make_box(m_vertices[i].point,
+                                      m_vertices[m_vertices[i].next].point),
+                             i);
+    }
+
+    inline void build_rtree()
+    {
+        std::vector<segment_value> segments;
+        for (std::size_t i = 0; i < m_vertices.size(); i++)
+        {
+            if (m_vertices[i].next != none)
+            {
+                segments.push_back(make_segment(i));
+            }
+        }
+        rtree_type rtree(segments);
+        m_rtree.swap(rtree);
+    }
+
+    inline void remove(std::size_t i)
+    {
+        vertex& v = m_vertices[i];
+        m_rtree.remove(make_segment(v.prev));
+        m_rtree.remove(make_segment(i));
+
+        m_vertices[v.prev].next = v.next;
+        m_vertices[v.next].prev = v.prev;
+        v.removed = true;
+
+        range_info& info = m_ranges[v.range_index];
+        info.count--;
+        if (info.first == i)
+        {
+            info.first = v.next;
+        }
+
+        m_rtree.insert(make_segment(v.prev));
+    }
+
+    // Returns true if p is in the closed triangle (p0, p1, p2)
+    static inline bool in_triangle(Point const& p0, Point const& p1,
+                                   Point const& p2, Point const& p)
+    {
+        int const orientation = side_strategy::apply(p0, p1, p2);
+        if (orientation != 0)
+        {
+            return side_strategy::apply(p0, p1, p) * orientation >= 0
+                && side_strategy::apply(p1, p2, p) * orientation >= 0
+                && side_strategy::apply(p2, p0, p) * orientation >= 0;
+        }
+
+        // Degenerate (collinear) triangle: check if p is on it
+        box_type box = make_box(p0, p1);
+        geometry::expand(box, p2);
+        return side_strategy::apply(p0, p2, p) == 0
+            && side_strategy::apply(p0, p1, p) == 0
+            && geometry::covered_by(p, box);
+    }
+
+    // Returns true if segment (a, b) and (p, q) intersect in another point
+    // than a shared vertex
+    inline bool crosses(std::size_t ia, std::size_t ib,
+                        std::size_t ip, std::size_t iq) const
+    {
+        Point const& a = m_vertices[ia].point;
+        Point const& b = m_vertices[ib].point;
+        Point const& p = m_vertices[ip].point;
+        Point const& q = m_vertices[iq].point;
+
+        int const s1 = side_strategy::apply(p, q, a);
+        int const s2 = side_strategy::apply(p, q, b);
+        if (s1 * s2 > 0)
+        {
+            return false;
+        }
+        int const s3 = side_strategy::apply(a, b, p);
+        int const s4 = side_strategy::apply(a, b, q);
+        if (s3 * s4 > 0)
+        {
+            return false;
+        }
+
+        bool const shared = ia == ip || ia == iq || ib == ip || ib == iq;
+        if (s1 == 0 && s2 == 0)
+        {
+            // Collinear: only touching in a shared vertex is allowed
+            box_type const box = make_box(p, q);
+            std::size_t const other_a = ia == ip || ia == iq ? none : ia;
+            std::size_t const other_b = ib == ip || ib == iq ? none : ib;
+            return ! shared
+                || (other_a != none && geometry::covered_by(a, box))
+                || (other_b != none && geometry::covered_by(b, box));
+        }
+
+        // Non collinear segments intersect in (at most) one point,
+        // if they share a vertex that is that point
+        return ! shared;
+    }
+
+    // Returns true if removing vertex i would change the topology
+    inline bool intersects_others(std::size_t i) const
+    {
+        vertex const& v = m_vertices[i];
+        Point const& p0 = m_vertices[v.prev].point;
+        Point const& p2 = m_vertices[v.next].point;
+
+        box_type box = make_box(p0, v.point);
+        geometry::expand(box, p2);
+
+        std::vector<segment_value> found;
+        m_rtree.query(index::intersects(box), std::back_inserter(found));
+
+        for (typename std::vector<segment_value>::const_iterator
+                it = found.begin(); it != found.end(); ++it)
+        {
+            std::size_t const a = it->second;
+            if (a == v.prev || a == i)
+            {
+                // The two segments which are replaced
+                continue;
+            }
+            std::size_t const b = m_vertices[a].next;
+
+            if ((a != v.prev && a != v.next
+                    && in_triangle(p0, v.point, p2, m_vertices[a].point))
+                || (b != v.prev && b != v.next
+                    && in_triangle(p0, v.point, p2, m_vertices[b].point))
+                || crosses(a, b, v.prev, v.next))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<vertex> m_vertices;
+    std::vector<range_info> m_ranges;
+    rtree_type m_rtree;
+};
+
+template <typename Point, bool Closed>
+const std::size_t simplifier<Point, Closed>::none;
+
+
+}} // namespace detail::simplify_preserve_topology
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct simplify_preserve_topology : not_implemented<Tag>
+{};
+
+template <typename Geometry, typename Tag>
+struct simplify_preserve_topology_ranges
+{
+    template <typename Area>
+    static inline void apply(Geometry const& geometry, Geometry& out,
+                             Area const& max_area)
+    {
+        typedef detail::simplify_preserve_topology::visit_ranges<Tag> visit;
+
+        typedef detail::simplify_preserve_topology::simplifier
+            <
+                typename point_type<Geometry>::type,
+                geometry::closure<Geometry>::value != open
+            > simplifier_type;
+
+        simplifier_type simplifier;
+        typename simplifier_type::collector collector(simplifier);
+        visit::apply(geometry, collector);
+
+        simplifier.simplify(max_area);
+
+        // Copy the structure, then replace all ranges
+        out = geometry;
+        typename simplifier_type::writer writer(simplifier);
+        visit::apply(out, writer);
+    }
+};
+
+template <typename Geometry>
+struct simplify_preserve_topology<Geometry, linestring_tag>
+    : simplify_preserve_topology_ranges<Geometry, linestring_tag>
+{};
+
+template <typename Geometry>
+struct simplify_preserve_topology<Geometry, ring_tag>
+    : simplify_preserve_topology_ranges<Geometry, ring_tag>
+{};
+
+template <typename Geometry>
+struct simplify_preserve_topology<Geometry, polygon_tag>
+    : simplify_preserve_topology_ranges<Geometry, polygon_tag>
+{};
+
+template <typename Geometry>
+struct simplify_preserve_topology<Geometry, multi_linestring_tag>
+    : simplify_preserve_topology_ranges<Geometry, multi_linestring_tag>
+{};
+
+template <typename Geometry>
+struct simplify_preserve_topology<Geometry, multi_polygon_tag>
+    : simplify_preserve_topology_ranges<Geometry, multi_polygon_tag>
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Simplify a geometry while preserving its topology
+\ingroup simplify
+\details Vertices are removed using the Visvalingam-Whyatt algorithm, in
+    order of increasing effective area, as long as that area does not
+    exceed the specified maximum. Removals which would let the geometry
+    intersect itself, or let rings cross or swap sides with other rings
+    of the same (multi) geometry, are rejected. A valid (multi) polygon
+    therefore stays valid. Rings keep at least three distinct points,
+    end points of linestrings are kept.
+\note This algorithm works on cartesian coordinates
+\tparam Geometry \tparam_geometry
+\tparam Area \tparam_numeric
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_area maximum effective area (in squared units of input
+    coordinates) of the triangle formed by a vertex and its neighbours,
+    for that vertex to be removed
+*/
+template <typename Geometry, typename Area>
+inline void simplify_preserve_topology(Geometry const& geometry,
+                                       Geometry& out,
+                                       Area const& max_area)
+{
+    concept::check<Geometry>();
+
+    dispatch::simplify_preserve_topology
+        <
+            Geometry
+        >::apply(geometry, out, max_area);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_ALGORITHMS_SIMPLIFY_PRESERVE_TOPOLOGY_HPP
@@ -0,0 +1,609 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_GEOMETRY_TABLE_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_GEOMETRY_TABLE_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geometry_table
+{
+
+
+/*!
+\brief Range of consecutive points in the point buffer of a table
+\details The iterators are pointers, so they stay valid when the view,
+    or the polygon view it was taken from, does not exist anymore.
+*/
+template <typename Point>
+class point_range
+{
+public :
+    typedef Point value_type;
+    typedef Point const* iterator;
+    typedef Point const* const_iterator;
+    typedef Point const& reference;
+    typedef Point const& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    inline point_range()
+        : m_begin(NULL)
+        , m_end(NULL)
+    {}
+
+    inline point_range(Point const* begin, Point const* end)
+        : m_begin(begin)
+        , m_end(end)
+    {}
+
+    inline const_iterator begin() const { return m_begin; }
+    inline const_iterator end() const { return m_end; }
+    inline size_type size() const { return m_end - m_begin; }
+    inline bool empty() const { return m_begin == m_end; }
+
+    inline Point const& operator[](size_type index) const
+    {
+        return m_begin[index];
+    }
+
+    inline Point const& front() const { return *m_begin; }
+    inline Point const& back() const { return *(m_end - 1); }
+
+private :
+    Point const* m_begin;
+    Point const* m_end;
+};
+
+
+// Creates ring views from the point buffer and the ring offsets
+template <typename RingView>
+struct ring_source
+{
+    typedef RingView view_type;
+    typedef typename boost::range_value<RingView>::type point_type;
+
+    inline ring_source()
+        : points(NULL)
+        , ring_offsets(NULL)
+    {}
+
+    inline ring_source(point_type const* p, std::size_t const* r)
+        : points(p)
+        , ring_offsets(r)
+    {}
+
+    inline RingView view(std::size_t index) const
+    {
+        return RingView(points + ring_offsets[index],
+                        points + ring_offsets[index + 1]);
+    }
+
+    point_type const* points;
+    std::size_t const* ring_offsets;
+};
+
+
+// Creates polygon views from the point buffer, the ring offsets and the
+// part offsets
+template <typename PolygonView>
+struct polygon_source
+{
+    typedef PolygonView view_type;
+    typedef typename PolygonView::ring_source_type ring_source_type;
+
+    inline polygon_source()
+        : part_offsets(NULL)
+    {}
+
+    inline polygon_source(ring_source_type const& r, std::size_t const* p)
+        : rings(r)
+        , part_offsets(p)
+    {}
+
+    inline PolygonView view(std::size_t index) const
+    {
+        return PolygonView(rings, part_offsets[index],
+                           part_offsets[index + 1]);
+    }
+
+    ring_source_type rings;
+    std::size_t const* part_offsets;
+};
+
+
+}} // namespace detail::geometry_table
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only linestring, referring to the points of a geometry table
+\ingroup geometries
+*/
+template <typename Point>
+class table_linestring_view
+    : public detail::geometry_table::point_range<Point>
+{
+    typedef detail::geometry_table::point_range<Point> base_type;
+
+public :
+    inline table_linestring_view()
+    {}
+
+    inline table_linestring_view(Point const* begin, Point const* end)
+        : base_type(begin, end)
+    {}
+};
+
+
+/*!
+\brief Read-only ring, referring to the points of a geometry table
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class table_ring_view
+    : public detail::geometry_table::point_range<Point>
+{
+    typedef detail::geometry_table::point_range<Point> base_type;
+
+public :
+    inline table_ring_view()
+    {}
+
+    inline table_ring_view(Point const* begin, Point const* end)
+        : base_type(begin, end)
+    {}
+};
+
+
+/*!
+\brief Read-only polygon, referring to the rings of a geometry table
+\details The ring views are created with the polygon view, such that
+    algorithms can take references to them while the polygon view exists.
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class table_polygon_view
+{
+public :
+    typedef table_ring_view<Point, ClockWise, Closed> ring_view_type;
+    typedef detail::geometry_table::ring_source<ring_view_type> ring_source_type;
+    typedef std::vector<ring_view_type> interior_view_type;
+
+    inline table_polygon_view()
+    {}
+
+    //! Constructs a view on the rings [first, last) of the source
+    inline table_polygon_view(ring_source_type const& rings,
+                              std::size_t first, std::size_t last)
+    {
+        if (first < last)
+        {
+            m_exterior = rings.view(first);
+            m_interiors.reserve(last - first - 1);
+            for (std::size_t r = first + 1; r < last; r++)
+            {
+                m_interiors.push_back(rings.view(r));
+            }
+        }
+    }
+
+    inline ring_view_type const& exterior() const
+    {
+        return m_exterior;
+    }
+
+    inline interior_view_type const& interiors() const
+    {
+        return m_interiors;
+    }
+
+private :
+    ring_view_type m_exterior;
+    interior_view_type m_interiors;
+};
+
+
+/*!
+\brief Read-only multi-polygon, referring to the polygons of a geometry table
+\details The polygon views are created with the multi-polygon view, such
+    that algorithms can take references to them while the multi-polygon view
+    exists.
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class table_multi_polygon_view
+    : public std::vector<table_polygon_view<Point, ClockWise, Closed> >
+{
+public :
+    typedef table_polygon_view<Point, ClockWise, Closed> polygon_view_type;
+    typedef detail::geometry_table::polygon_source
+        <
+            polygon_view_type
+        > polygon_source_type;
+
+    inline table_multi_polygon_view()
+    {}
+
+    //! Constructs a view on the polygons [first, last) of the source
+    inline table_multi_polygon_view(polygon_source_type const& polygons,
+                                    std::size_t first, std::size_t last)
+    {
+        this->reserve(last - first);
+        for (std::size_t p = first; p < last; p++)
+        {
+            this->push_back(polygons.view(p));
+        }
+    }
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geometry_table
+{
+
+template <typename Table, typename Tag>
+struct append : not_implemented<Tag>
+{};
+
+template <typename Table>
+struct append<Table, linestring_tag>
+{
+    template <typename Range>
+    static inline void apply(Table& table, Range const& range)
+    {
+        table.append_points(range);
+        table.end_ring();
+        table.end_part();
+    }
+};
+
+template <typename Table>
+struct append<Table, ring_tag>
+    : append<Table, linestring_tag>
+{};
+
+template <typename Table>
+struct append<Table, polygon_tag>
+{
+    template <typename Polygon>
+    static inline void apply(Table& table, Polygon const& polygon)
+    {
+        table.append_points(exterior_ring(polygon));
+        table.end_ring();
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            table.append_points(*it);
+            table.end_ring();
+        }
+        table.end_part();
+    }
+};
+
+template <typename Table>
+struct append<Table, multi_polygon_tag>
+{
+    template <typename MultiPolygon>
+    static inline void apply(Table& table, MultiPolygon const& multi)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            append<Table, polygon_tag>::apply(table, *it);
+        }
+    }
+};
+
+}} // namespace detail::geometry_table
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Table of geometries, stored in columns: one buffer of points, and
+    offsets of the rings, of the parts and of the geometries
+\details The layout is as multi-polygons in Apache Arrow (GeoArrow, with
+    interleaved coordinates). Ring r consists of the points
+    [ring_offsets[r], ring_offsets[r+1]), part p (a polygon) of the rings
+    [part_offsets[p], part_offsets[p+1]), and geometry (row) g of the parts
+    [geometry_offsets[g], geometry_offsets[g+1]). A linestring is stored
+    as one part with one ring. All geometries share the same buffers, so
+    adding a geometry does not allocate memory per ring.
+
+    The rows are accessed by views satisfying the geometry concepts, such
+    that algorithms and I/O work on them without copying the points. A view
+    holds one (begin, end) pair per ring, referring to the point buffer: as
+    iterators of std::vector, views are invalidated if geometries are added
+    to the table.
+\tparam Point point type of the stored points
+\tparam ClockWise true for clockwise exterior rings, as model::polygon
+\tparam Closed true if the rings are closed, as model::polygon
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class geometry_table
+{
+public :
+    typedef Point point_type;
+    typedef table_linestring_view<Point> linestring_view_type;
+    typedef table_ring_view<Point, ClockWise, Closed> ring_view_type;
+    typedef table_polygon_view<Point, ClockWise, Closed> polygon_view_type;
+    typedef table_multi_polygon_view
+        <
+            Point, ClockWise, Closed
+        > multi_polygon_view_type;
+
+    inline geometry_table()
+        : m_ring_offsets(1, 0)
+        , m_part_offsets(1, 0)
+        , m_geometry_offsets(1, 0)
+    {}
+
+    //! Reserves memory for the specified number of items
+    inline void reserve(std::size_t geometry_count, std::size_t part_count,
+                        std::size_t ring_count, std::size_t point_count)
+    {
+        m_geometry_offsets.reserve(geometry_count + 1);
+        m_part_offsets.reserve(part_count + 1);
+        m_ring_offsets.reserve(ring_count + 1);
+        m_points.reserve(point_count);
+    }
+
+    /*!
+    \brief Adds a geometry (linestring, ring, polygon or multi-polygon)
+        as a new row
+    \details The points are converted to the point type of the table. The
+        rings are stored as they are, they should have the orientation and
+        closure of the table.
+    */
+    template <typename Geometry>
+    inline void push_back(Geometry const& geometry)
+    {
+        detail::geometry_table::append
+            <
+                geometry_table, typename tag<Geometry>::type
+            >::apply(*this, geometry);
+        m_geometry_offsets.push_back(m_part_offsets.size() - 1);
+    }
+
+    //! Returns the number of geometries (rows)
+    inline std::size_t size() const { return m_geometry_offsets.size() - 1; }
+    inline bool empty() const { return size() == 0; }
+
+    //! Returns row g as a multi-polygon
+    inline multi_polygon_view_type multi_polygon(std::size_t g) const
+    {
+        return multi_polygon_view_type(polygon_source(),
+                                       m_geometry_offsets[g],
+                                       m_geometry_offsets[g + 1]);
+    }
+
+    //! Returns the first part of row g as a polygon, or an empty polygon
+    //! if row g is empty
+    inline polygon_view_type polygon(std::size_t g) const
+    {
+        if (m_geometry_offsets[g] == m_geometry_offsets[g + 1])
+        {
+            return polygon_view_type();
+        }
+        return polygon_source().view(m_geometry_offsets[g]);
+    }
+
+    //! Returns the first ring of row g as a linestring, or an empty
+    //! linestring if row g is empty
+    inline linestring_view_type linestring(std::size_t g) const
+    {
+        if (m_geometry_offsets[g] == m_geometry_offsets[g + 1])
+        {
+            return linestring_view_type();
+        }
+        std::size_t const r = m_part_offsets[m_geometry_offsets[g]];
+        return linestring_view_type(point_at(m_ring_offsets[r]),
+                                    point_at(m_ring_offsets[r + 1]));
+    }
+
+    inline std::vector<Point> const& points() const { return m_points; }
+
+    inline std::vector<std::size_t> const& ring_offsets() const
+    {
+        return m_ring_offsets;
+    }
+
+    inline std::vector<std::size_t> const& part_offsets() const
+    {
+        return m_part_offsets;
+    }
+
+    inline std::vector<std::size_t> const& geometry_offsets() const
+    {
+        return m_geometry_offsets;
+    }
+
+private :
+    template <typename Table, typename Tag>
+    friend struct detail::geometry_table::append;
+
+    typedef typename multi_polygon_view_type::polygon_source_type polygon_source_type;
+    typedef typename polygon_view_type::ring_source_type ring_source_type;
+
+    inline Point const* point_at(std::size_t index) const
+    {
+        return m_points.empty() ? NULL : &m_points[0] + index;
+    }
+
+    inline polygon_source_type polygon_source() const
+    {
+        return polygon_source_type(
+            ring_source_type(point_at(0), &m_ring_offsets[0]),
+            &m_part_offsets[0]);
+    }
+
+    template <typename Range>
+    inline void append_points(Range const& range)
+    {
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            Point point;
+            geometry::convert(*it, point);
+            m_points.push_back(point);
+        }
+    }
+
+    inline void end_ring()
+    {
+        m_ring_offsets.push_back(m_points.size());
+    }
+
+    inline void end_part()
+    {
+        m_part_offsets.push_back(m_ring_offsets.size() - 1);
+    }
+
+    std::vector<Point> m_points;
+    std::vector<std::size_t> m_ring_offsets;
+    std::vector<std::size_t> m_part_offsets;
+    std::vector<std::size_t> m_geometry_offsets;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<table_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<table_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<table_ring_view<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<table_ring_view<Point, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef typename table_polygon_view
+        <
+            Point, ClockWise, Closed
+        >::ring_view_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef typename table_polygon_view
+        <
+            Point, ClockWise, Closed
+        >::ring_view_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef typename table_polygon_view
+        <
+            Point, ClockWise, Closed
+        >::interior_view_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef typename table_polygon_view
+        <
+            Point, ClockWise, Closed
+        >::interior_view_type const& type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef table_polygon_view<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_view_type const&
+        get(polygon_type const& p)
+    {
+        return p.exterior();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<table_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef table_polygon_view<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::interior_view_type const&
+        get(polygon_type const& p)
+    {
+        return p.interiors();
+    }
+};
+
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<table_multi_polygon_view<Point, ClockWise, Closed> >
+{
+    typedef multi_polygon_tag type;
+};
+
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GEOMETRIES_GEOMETRY_TABLE_HPP
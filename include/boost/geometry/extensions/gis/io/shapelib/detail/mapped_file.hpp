@@ -0,0 +1,183 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_DETAIL_MAPPED_FILE_HPP
+#define BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_DETAIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <boost/noncopyable.hpp>
+
+#if defined(_WIN32)
+// Avoid the min/max macros of windows.h, without leaking NOMINMAX to includers
+#ifndef NOMINMAX
+#define NOMINMAX
+#define BOOST_GEOMETRY_SHP_UNDEF_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef BOOST_GEOMETRY_SHP_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef BOOST_GEOMETRY_SHP_UNDEF_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shp
+{
+
+/*!
+\brief Maps a file, read-only, into memory
+\details Header-only replacement of boost::iostreams::mapped_file_source,
+    which needs a compiled library. The pages are loaded by the operating
+    system on first access, so opening a large file is cheap, and the
+    mapped bytes can be read by many threads at the same time.
+*/
+class mapped_file : boost::noncopyable
+{
+public :
+    inline mapped_file()
+        : m_data(NULL)
+        , m_size(0)
+#if defined(_WIN32)
+        , m_file(INVALID_HANDLE_VALUE)
+        , m_mapping(NULL)
+#endif
+    {}
+
+    inline ~mapped_file()
+    {
+        close();
+    }
+
+    //! Maps the file, returns false if it cannot be opened or mapped
+    inline bool open(std::string const& filename)
+    {
+        close();
+
+#if defined(_WIN32)
+        m_file = ::CreateFileA(filename.c_str(), GENERIC_READ,
+                    FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        LARGE_INTEGER size;
+        if (! ::GetFileSizeEx(m_file, &size))
+        {
+            close();
+            return false;
+        }
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        if (m_size == 0)
+        {
+            return true;
+        }
+        m_mapping = ::CreateFileMappingA(m_file, NULL, PAGE_READONLY,
+                                         0, 0, NULL);
+        if (m_mapping == NULL)
+        {
+            close();
+            return false;
+        }
+        m_data = static_cast<unsigned char const*>(
+                    ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == NULL)
+        {
+            close();
+            return false;
+        }
+#else
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        m_size = static_cast<std::size_t>(status.st_size);
+        if (m_size > 0)
+        {
+            void* const data = ::mmap(NULL, m_size, PROT_READ, MAP_SHARED,
+                                      fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                m_size = 0;
+                return false;
+            }
+            m_data = static_cast<unsigned char const*>(data);
+        }
+        // The mapping remains valid after closing the descriptor
+        ::close(fd);
+#endif
+        return true;
+    }
+
+    inline void close()
+    {
+#if defined(_WIN32)
+        if (m_data != NULL)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != NULL)
+        {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file);
+        }
+        m_file = INVALID_HANDLE_VALUE;
+        m_mapping = NULL;
+#else
+        if (m_data != NULL)
+        {
+            ::munmap(const_cast<unsigned char*>(m_data), m_size);
+        }
+#endif
+        m_data = NULL;
+        m_size = 0;
+    }
+
+    inline unsigned char const* data() const { return m_data; }
+    inline std::size_t size() const { return m_size; }
+
+private :
+    unsigned char const* m_data;
+    std::size_t m_size;
+#if defined(_WIN32)
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+};
+
+
+}} // namespace detail::shp
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_DETAIL_MAPPED_FILE_HPP
@@ -0,0 +1,493 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_READER_HPP
+#define BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_READER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/extensions/gis/io/shapelib/detail/mapped_file.hpp>
+#include <boost/geometry/extensions/gis/io/shapelib/shp_view.hpp>
+#include <boost/geometry/extensions/util/parallel_for.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+//! Shape types of the ESRI shapefile specification
+struct shp_shape_type
+{
+    enum enum_t
+    {
+        null_shape = 0,
+        point = 1,
+        polyline = 3,
+        polygon = 5,
+        multipoint = 8,
+        pointz = 11,
+        polylinez = 13,
+        polygonz = 15,
+        multipointz = 18,
+        pointm = 21,
+        polylinem = 23,
+        polygonm = 25,
+        multipointm = 28,
+        multipatch = 31
+    };
+};
+
+
+/*!
+\brief Exception thrown if a shapefile cannot be opened or is invalid
+\ingroup shapelib
+*/
+class shp_read_exception : public geometry::exception
+{
+public :
+    inline shp_read_exception(std::string const& message)
+        : m_message(message)
+    {}
+
+    virtual ~shp_read_exception() throw() {}
+
+    virtual char const* what() const throw()
+    {
+        return m_message.c_str();
+    }
+
+private :
+    std::string m_message;
+};
+
+
+/*!
+\brief Read-only view on the contents of a record of a shapefile
+\details The points and parts are not copied: the views returned by the
+    accessors refer to the bytes of the record (usually a memory mapped
+    file), which must outlive them. Z values can be read separately,
+    M values are ignored.
+    Which views apply depends on the shape type:
+    - point types: point(), points()
+    - multipoint types: points()
+    - polyline types: linestring(i), linestrings(), points()
+    - polygon types: ring(i), polygon(), polygons(), points()
+\tparam CoordinateSystem coordinate system, for example cs::cartesian
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_record
+{
+public :
+    inline shp_record()
+        : m_content(NULL)
+        , m_length(0)
+        , m_shape_type(shp_shape_type::null_shape)
+        , m_table()
+        , m_z(NULL)
+    {}
+
+    /*!
+    \brief Assigns the record to the specified contents, which start with
+        the shape type (following the record header)
+    \return false if the contents are invalid or too short
+    */
+    inline bool assign(unsigned char const* content, std::size_t length)
+    {
+        *this = shp_record();
+        if (content == NULL || length < 4)
+        {
+            return false;
+        }
+
+        m_content = content;
+        m_length = length;
+        m_shape_type = detail::shp::load_little_uint32(content);
+
+        switch (m_shape_type)
+        {
+            case shp_shape_type::null_shape :
+                return true;
+            case shp_shape_type::point :
+            case shp_shape_type::pointm :
+                return assign_point(false);
+            case shp_shape_type::pointz :
+                return assign_point(true);
+            case shp_shape_type::multipoint :
+            case shp_shape_type::multipointm :
+                return assign_multi_point(false);
+            case shp_shape_type::multipointz :
+                return assign_multi_point(true);
+            case shp_shape_type::polyline :
+            case shp_shape_type::polygon :
+            case shp_shape_type::polylinem :
+            case shp_shape_type::polygonm :
+                return assign_parts(false, 1);
+            case shp_shape_type::polylinez :
+            case shp_shape_type::polygonz :
+                return assign_parts(true, 1);
+            case shp_shape_type::multipatch :
+                // The part types follow the part starts
+                return assign_parts(true, 2);
+        }
+        return false;
+    }
+
+    inline int shape_type() const { return static_cast<int>(m_shape_type); }
+    inline bool is_null() const { return m_shape_type == shp_shape_type::null_shape; }
+
+    inline std::size_t point_count() const { return m_table.point_count; }
+    inline std::size_t part_count() const { return m_table.part_count; }
+
+    inline shp_point_view<CoordinateSystem> point(std::size_t index = 0) const
+    {
+        return shp_point_view<CoordinateSystem>(
+                    m_table.points + index * detail::shp::point_size);
+    }
+
+    //! Returns all points of the record
+    inline shp_multi_point_view<CoordinateSystem> points() const
+    {
+        return shp_multi_point_view<CoordinateSystem>(m_table.points,
+                                                      m_table.point_count);
+    }
+
+    inline shp_linestring_view<CoordinateSystem> linestring(std::size_t part) const
+    {
+        return m_table.template get<shp_linestring_view<CoordinateSystem> >(part);
+    }
+
+    inline shp_ring_view<CoordinateSystem> ring(std::size_t part) const
+    {
+        return m_table.template get<shp_ring_view<CoordinateSystem> >(part);
+    }
+
+    inline shp_multi_linestring_view<CoordinateSystem> linestrings() const
+    {
+        return shp_multi_linestring_view<CoordinateSystem>(m_table);
+    }
+
+    /*!
+    \brief Returns all rings as one polygon: the first ring is the exterior
+        ring, all others are holes. This is correct for records with one
+        exterior ring, which is by far the most common case.
+    */
+    inline shp_polygon_view<CoordinateSystem> polygon() const
+    {
+        return shp_polygon_view<CoordinateSystem>(m_table, 0, m_table.part_count);
+    }
+
+    //! Returns all rings as multi polygon, grouped on orientation
+    inline shp_multi_polygon_view<CoordinateSystem> polygons() const
+    {
+        return shp_multi_polygon_view<CoordinateSystem>(m_table);
+    }
+
+    inline bool has_z() const { return m_z != NULL; }
+
+    //! Returns the Z value of a point, if the record has Z values
+    inline double z(std::size_t index) const
+    {
+        return detail::shp::load_little_double(m_z + index * sizeof(double));
+    }
+
+    //! Returns the contents of the record, starting with the shape type
+    inline unsigned char const* data() const { return m_content; }
+    inline std::size_t size() const { return m_length; }
+
+private :
+
+    inline bool assign_point(bool with_z)
+    {
+        if (m_length < 4 + detail::shp::point_size + (with_z ? 8 : 0))
+        {
+            return false;
+        }
+        m_table.points = m_content + 4;
+        m_table.point_count = 1;
+        if (with_z)
+        {
+            m_z = m_content + 4 + detail::shp::point_size;
+        }
+        return true;
+    }
+
+    inline bool assign_multi_point(bool with_z)
+    {
+        // Shape type, box, number of points, points
+        if (m_length < 40)
+        {
+            return false;
+        }
+        std::size_t const count = detail::shp::load_little_uint32(m_content + 36);
+        if (count > (m_length - 40) / detail::shp::point_size)
+        {
+            return false;
+        }
+        m_table.points = m_content + 40;
+        m_table.point_count = count;
+        assign_z(with_z);
+        return true;
+    }
+
+    inline bool assign_parts(bool with_z, std::size_t part_entry_count)
+    {
+        // Shape type, box, number of parts, number of points,
+        // part starts (and part types for multipatch), points
+        if (m_length < 44)
+        {
+            return false;
+        }
+        std::size_t const part_count = detail::shp::load_little_uint32(m_content + 36);
+        std::size_t const point_count = detail::shp::load_little_uint32(m_content + 40);
+        if (part_count > (m_length - 44) / (4 * part_entry_count))
+        {
+            return false;
+        }
+        std::size_t const header = 44 + 4 * part_entry_count * part_count;
+        if (point_count > (m_length - header) / detail::shp::point_size)
+        {
+            return false;
+        }
+
+        m_table.parts = m_content + 44;
+        m_table.points = m_content + header;
+        m_table.part_count = part_count;
+        m_table.point_count = point_count;
+
+        // Parts should start at the first point and be ordered
+        std::size_t previous = 0;
+        for (std::size_t i = 0; i < part_count; i++)
+        {
+            std::size_t const start = m_table.start(i);
+            if ((i == 0 && start != 0) || start < previous || start > point_count)
+            {
+                m_table = detail::shp::part_table();
+                return false;
+            }
+            previous = start;
+        }
+
+        assign_z(with_z);
+        return true;
+    }
+
+    inline void assign_z(bool with_z)
+    {
+        // Z range, followed by the Z values, follows the points.
+        // It is optional in files written by some software.
+        std::size_t const offset = (m_table.points - m_content)
+            + m_table.point_count * detail::shp::point_size + 16;
+        if (with_z
+            && offset <= m_length
+            && m_table.point_count <= (m_length - offset) / sizeof(double))
+        {
+            m_z = m_content + offset;
+        }
+    }
+
+    unsigned char const* m_content;
+    std::size_t m_length;
+    boost::uint32_t m_shape_type;
+    detail::shp::part_table m_table;
+    unsigned char const* m_z;
+};
+
+
+/*!
+\brief Reads ESRI shapefiles (.shp with .shx index), without shapelib
+\details Both files are memory mapped, nothing is read up front.
+    Records are accessed randomly via the index, and their points and
+    parts are exposed as views, adapted to the geometry concepts, without
+    copying. Records can be read by many threads simultaneously, see
+    for_each_shp_record.
+\tparam CoordinateSystem coordinate system, for example cs::cartesian
+\par Example:
+\code
+shp_reader<> reader("roads");
+for (std::size_t i = 0; i < reader.count(); i++)
+{
+    total += boost::geometry::length(reader.record(i).linestrings());
+}
+\endcode
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_reader : boost::noncopyable
+{
+public :
+    typedef shp_record<CoordinateSystem> record_type;
+
+    /*!
+    \brief Opens a shapefile
+    \param filename name of the .shp file, with or without extension.
+        The .shx file should be next to it.
+    \exception shp_read_exception if the files cannot be opened or
+        have no valid headers
+    */
+    explicit inline shp_reader(std::string const& filename)
+    {
+        std::string name = filename;
+        std::string shx_extension = ".shx";
+        if (name.size() > 4)
+        {
+            std::string const extension = name.substr(name.size() - 4);
+            if (extension == ".shp" || extension == ".SHP")
+            {
+                shx_extension = extension == ".SHP" ? ".SHX" : ".shx";
+                name.erase(name.size() - 4);
+            }
+        }
+        std::string const shp_name = name + (shx_extension == ".SHX" ? ".SHP" : ".shp");
+        std::string const shx_name = name + shx_extension;
+
+        if (! m_shp.open(shp_name) || ! valid_header(m_shp))
+        {
+            throw shp_read_exception("Cannot open shapefile " + shp_name);
+        }
+        if (! m_shx.open(shx_name) || ! valid_header(m_shx))
+        {
+            throw shp_read_exception("Cannot open shapefile index " + shx_name);
+        }
+    }
+
+    //! Returns the number of records
+    inline std::size_t count() const
+    {
+        return (m_shx.size() - 100) / 8;
+    }
+
+    //! Returns the shape type of the file (all records are of this type, or null)
+    inline int shape_type() const
+    {
+        return static_cast<int>(detail::shp::load_little_uint32(m_shp.data() + 32));
+    }
+
+    //! Assigns the bounding box of all records, from the file header
+    template <typename Box>
+    inline void bounds(Box& box) const
+    {
+        unsigned char const* const data = m_shp.data();
+        geometry::set<min_corner, 0>(box, detail::shp::load_little_double(data + 36));
+        geometry::set<min_corner, 1>(box, detail::shp::load_little_double(data + 44));
+        geometry::set<max_corner, 0>(box, detail::shp::load_little_double(data + 52));
+        geometry::set<max_corner, 1>(box, detail::shp::load_little_double(data + 60));
+    }
+
+    /*!
+    \brief Returns a record, located via the index
+    \exception shp_read_exception if the index refers outside the file,
+        or if the record is invalid
+    */
+    inline record_type record(std::size_t index) const
+    {
+        record_type result;
+        if (! get_record(index, result))
+        {
+            throw shp_read_exception("Invalid shapefile record");
+        }
+        return result;
+    }
+
+    /*!
+    \brief Assigns a record, located via the index
+    \return false if the index refers outside the file,
+        or if the record is invalid
+    */
+    inline bool get_record(std::size_t index, record_type& record) const
+    {
+        if (index >= count())
+        {
+            return false;
+        }
+
+        // Offset and content length are in 16-bit words, big endian
+        unsigned char const* const entry = m_shx.data() + 100 + index * 8;
+        std::size_t const offset
+            = std::size_t(detail::shp::load_big_uint32(entry)) * 2;
+        std::size_t const length
+            = std::size_t(detail::shp::load_big_uint32(entry + 4)) * 2;
+
+        if (offset < 100
+            || offset > m_shp.size()
+            || length + 8 > m_shp.size() - offset)
+        {
+            return false;
+        }
+        return record.assign(m_shp.data() + offset + 8, length);
+    }
+
+private :
+    static inline bool valid_header(detail::shp::mapped_file const& file)
+    {
+        return file.size() >= 100
+            && detail::shp::load_big_uint32(file.data()) == 9994
+            && detail::shp::load_little_uint32(file.data() + 28) == 1000;
+    }
+
+    detail::shp::mapped_file m_shp;
+    detail::shp::mapped_file m_shx;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shp
+{
+
+template <typename Reader, typename Function>
+struct record_visitor
+{
+    Reader const& reader;
+    Function const& function;
+
+    inline void operator()(std::size_t index) const
+    {
+        function(index, reader.record(index));
+    }
+};
+
+}} // namespace detail::shp
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calls function(index, record) for all records of a shapefile,
+    distributing chunks of consecutive records over a number of threads
+\details The function should be thread-safe (it is called as a const
+    function object, from several threads). If a record is invalid,
+    shp_read_exception is rethrown in the calling thread.
+\param reader shapefile reader
+\param function function object called with each index and record
+\param thread_count number of threads, 0 means the hardware concurrency
+\param chunk_size number of consecutive records handed out at once
+\ingroup shapelib
+*/
+template <typename CoordinateSystem, typename Function>
+inline void for_each_shp_record(shp_reader<CoordinateSystem> const& reader,
+                                Function const& function,
+                                std::size_t thread_count = 0,
+                                std::size_t chunk_size = 256)
+{
+    detail::shp::record_visitor<shp_reader<CoordinateSystem>, Function> const
+        visitor = { reader, function };
+    detail::parallel::for_each_index(reader.count(), visitor,
+                                     thread_count, chunk_size);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_READER_HPP
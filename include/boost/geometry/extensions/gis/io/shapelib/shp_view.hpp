@@ -0,0 +1,717 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_VIEW_HPP
+#define BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_VIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/mpl/int.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shp
+{
+
+// Shapefile contents are little endian, the file and record headers are
+// big endian. The bytes are assembled independent of the endianness of
+// the machine, and compilers reduce this to a single (unaligned) load.
+
+inline boost::uint32_t load_little_uint32(unsigned char const* bytes)
+{
+    return boost::uint32_t(bytes[0])
+        | (boost::uint32_t(bytes[1]) << 8)
+        | (boost::uint32_t(bytes[2]) << 16)
+        | (boost::uint32_t(bytes[3]) << 24);
+}
+
+inline boost::uint32_t load_big_uint32(unsigned char const* bytes)
+{
+    return (boost::uint32_t(bytes[0]) << 24)
+        | (boost::uint32_t(bytes[1]) << 16)
+        | (boost::uint32_t(bytes[2]) << 8)
+        | boost::uint32_t(bytes[3]);
+}
+
+inline double load_little_double(unsigned char const* bytes)
+{
+    boost::uint64_t const bits
+        = boost::uint64_t(load_little_uint32(bytes))
+        | (boost::uint64_t(load_little_uint32(bytes + 4)) << 32);
+    double value;
+    std::memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+// Points in shapefile records are stored as x, y (Z and M values,
+// if any, follow in separate arrays)
+static const std::size_t point_size = 2 * sizeof(double);
+
+
+/*!
+\brief Iterator over consecutive shapefile points, dereferencing to a
+    point view
+*/
+template <typename PointView>
+class point_iterator
+    : public boost::iterator_facade
+        <
+            point_iterator<PointView>,
+            PointView const,
+            boost::random_access_traversal_tag,
+            PointView
+        >
+{
+public :
+    inline point_iterator()
+        : m_data(NULL)
+    {}
+
+    explicit inline point_iterator(unsigned char const* data)
+        : m_data(data)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline PointView dereference() const { return PointView(m_data); }
+
+    inline bool equal(point_iterator const& other) const
+    {
+        return m_data == other.m_data;
+    }
+
+    inline void increment() { m_data += point_size; }
+    inline void decrement() { m_data -= point_size; }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        m_data += n * static_cast<std::ptrdiff_t>(point_size);
+    }
+
+    inline std::ptrdiff_t distance_to(point_iterator const& other) const
+    {
+        return (other.m_data - m_data) / static_cast<std::ptrdiff_t>(point_size);
+    }
+
+    unsigned char const* m_data;
+};
+
+
+/*!
+\brief Range of consecutive shapefile points
+*/
+template <typename PointView>
+class point_range
+{
+public :
+    typedef PointView value_type;
+    typedef point_iterator<PointView> iterator;
+    typedef point_iterator<PointView> const_iterator;
+    typedef std::size_t size_type;
+
+    inline point_range()
+        : m_points(NULL)
+        , m_count(0)
+    {}
+
+    inline point_range(unsigned char const* points, std::size_t count)
+        : m_points(points)
+        , m_count(count)
+    {}
+
+    inline const_iterator begin() const { return const_iterator(m_points); }
+
+    inline const_iterator end() const
+    {
+        return const_iterator(m_points + m_count * point_size);
+    }
+
+    inline size_type size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    inline PointView operator[](size_type index) const
+    {
+        return PointView(m_points + index * point_size);
+    }
+
+    inline PointView front() const { return operator[](0); }
+    inline PointView back() const { return operator[](m_count - 1); }
+
+private :
+    unsigned char const* m_points;
+    std::size_t m_count;
+};
+
+
+/*!
+\brief The parts (rings or linestrings) of a shapefile record: an array
+    of indices of the first point of each part, and the points
+*/
+struct part_table
+{
+    unsigned char const* parts;
+    unsigned char const* points;
+    std::size_t part_count;
+    std::size_t point_count;
+
+    //! Returns the index of the first point of a part, or the point count
+    inline std::size_t start(std::size_t part) const
+    {
+        return part < part_count
+            ? load_little_uint32(parts + part * 4)
+            : point_count;
+    }
+
+    template <typename PartView>
+    inline PartView get(std::size_t part) const
+    {
+        std::size_t const first = start(part);
+        return PartView(points + first * point_size, start(part + 1) - first);
+    }
+};
+
+
+/*!
+\brief Iterator over consecutive parts of a shapefile record
+\details The iterator contains the (small) part table, such that it stays
+    valid if the range it was taken from is a temporary
+*/
+template <typename PartView>
+class part_iterator
+    : public boost::iterator_facade
+        <
+            part_iterator<PartView>,
+            PartView const,
+            boost::random_access_traversal_tag,
+            PartView
+        >
+{
+public :
+    inline part_iterator()
+        : m_table()
+        , m_index(0)
+    {}
+
+    inline part_iterator(part_table const& table, std::size_t index)
+        : m_table(table)
+        , m_index(index)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline PartView dereference() const
+    {
+        return m_table.template get<PartView>(m_index);
+    }
+
+    inline bool equal(part_iterator const& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    inline void increment() { m_index++; }
+    inline void decrement() { m_index--; }
+    inline void advance(std::ptrdiff_t n) { m_index += n; }
+
+    inline std::ptrdiff_t distance_to(part_iterator const& other) const
+    {
+        return static_cast<std::ptrdiff_t>(other.m_index)
+             - static_cast<std::ptrdiff_t>(m_index);
+    }
+
+    part_table m_table;
+    std::size_t m_index;
+};
+
+
+/*!
+\brief Range of parts [first, last) of a shapefile record
+*/
+template <typename PartView>
+class part_range
+{
+public :
+    typedef PartView value_type;
+    typedef part_iterator<PartView> iterator;
+    typedef part_iterator<PartView> const_iterator;
+    typedef std::size_t size_type;
+
+    inline part_range()
+        : m_table()
+        , m_first(0)
+        , m_last(0)
+    {}
+
+    inline part_range(part_table const& table,
+                      std::size_t first, std::size_t last)
+        : m_table(table)
+        , m_first(first)
+        , m_last(last)
+    {}
+
+    inline const_iterator begin() const { return const_iterator(m_table, m_first); }
+    inline const_iterator end() const { return const_iterator(m_table, m_last); }
+
+    inline size_type size() const { return m_last - m_first; }
+    inline bool empty() const { return m_last == m_first; }
+
+    inline PartView operator[](size_type index) const
+    {
+        return m_table.template get<PartView>(m_first + index);
+    }
+
+private :
+    part_table m_table;
+    std::size_t m_first;
+    std::size_t m_last;
+};
+
+
+}} // namespace detail::shp
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only point, referring to the x and y of a point
+    in a shapefile record
+\details The view refers to the bytes (usually a memory mapped file),
+    which must outlive it. Coordinates are read on access.
+\tparam CoordinateSystem coordinate system, for example cs::cartesian
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_point_view
+{
+public :
+    inline shp_point_view()
+        : m_data(NULL)
+    {}
+
+    explicit inline shp_point_view(unsigned char const* data)
+        : m_data(data)
+    {}
+
+    template <std::size_t Dimension>
+    inline double get() const
+    {
+        return detail::shp::load_little_double(m_data + Dimension * sizeof(double));
+    }
+
+private :
+    unsigned char const* m_data;
+};
+
+
+/*!
+\brief Read-only multi point, referring to the points of a shapefile record
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_multi_point_view
+    : public detail::shp::point_range<shp_point_view<CoordinateSystem> >
+{
+    typedef detail::shp::point_range<shp_point_view<CoordinateSystem> > base_type;
+
+public :
+    inline shp_multi_point_view()
+    {}
+
+    inline shp_multi_point_view(unsigned char const* points, std::size_t count)
+        : base_type(points, count)
+    {}
+};
+
+
+/*!
+\brief Read-only linestring, referring to a part of a shapefile polyline
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_linestring_view
+    : public detail::shp::point_range<shp_point_view<CoordinateSystem> >
+{
+    typedef detail::shp::point_range<shp_point_view<CoordinateSystem> > base_type;
+
+public :
+    inline shp_linestring_view()
+    {}
+
+    inline shp_linestring_view(unsigned char const* points, std::size_t count)
+        : base_type(points, count)
+    {}
+};
+
+
+/*!
+\brief Read-only ring, referring to a part of a shapefile polygon
+\details Shapefile rings are closed. Outer rings are clockwise, holes are
+    counter clockwise, as the default of model::ring.
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_ring_view
+    : public detail::shp::point_range<shp_point_view<CoordinateSystem> >
+{
+    typedef detail::shp::point_range<shp_point_view<CoordinateSystem> > base_type;
+
+public :
+    inline shp_ring_view()
+    {}
+
+    inline shp_ring_view(unsigned char const* points, std::size_t count)
+        : base_type(points, count)
+    {}
+};
+
+
+/*!
+\brief Read-only multi linestring, referring to the parts
+    of a shapefile polyline
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_multi_linestring_view
+    : public detail::shp::part_range<shp_linestring_view<CoordinateSystem> >
+{
+    typedef detail::shp::part_range<shp_linestring_view<CoordinateSystem> > base_type;
+
+public :
+    inline shp_multi_linestring_view()
+    {}
+
+    explicit inline shp_multi_linestring_view(detail::shp::part_table const& table)
+        : base_type(table, 0, table.part_count)
+    {}
+};
+
+
+/*!
+\brief Read-only polygon, referring to consecutive rings of a shapefile
+    polygon: the first is the exterior ring, the others are the holes
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_polygon_view
+{
+public :
+    typedef shp_ring_view<CoordinateSystem> ring_view_type;
+    typedef detail::shp::part_range<ring_view_type> interior_view_type;
+
+    inline shp_polygon_view()
+        : m_table()
+        , m_first(0)
+        , m_last(0)
+    {}
+
+    inline shp_polygon_view(detail::shp::part_table const& table,
+                            std::size_t first, std::size_t last)
+        : m_table(table)
+        , m_first(first)
+        , m_last(last)
+    {}
+
+    inline ring_view_type exterior() const
+    {
+        return m_first < m_last
+            ? m_table.template get<ring_view_type>(m_first)
+            : ring_view_type();
+    }
+
+    inline interior_view_type interiors() const
+    {
+        return m_first < m_last
+            ? interior_view_type(m_table, m_first + 1, m_last)
+            : interior_view_type();
+    }
+
+private :
+    detail::shp::part_table m_table;
+    std::size_t m_first;
+    std::size_t m_last;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shp
+{
+
+template <typename PolygonView>
+class polygon_iterator
+    : public boost::iterator_facade
+        <
+            polygon_iterator<PolygonView>,
+            PolygonView const,
+            boost::random_access_traversal_tag,
+            PolygonView
+        >
+{
+public :
+    inline polygon_iterator()
+        : m_table()
+        , m_starts(NULL)
+    {}
+
+    inline polygon_iterator(part_table const& table, std::size_t const* starts)
+        : m_table(table)
+        , m_starts(starts)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline PolygonView dereference() const
+    {
+        return PolygonView(m_table, m_starts[0], m_starts[1]);
+    }
+
+    inline bool equal(polygon_iterator const& other) const
+    {
+        return m_starts == other.m_starts;
+    }
+
+    inline void increment() { m_starts++; }
+    inline void decrement() { m_starts--; }
+    inline void advance(std::ptrdiff_t n) { m_starts += n; }
+
+    inline std::ptrdiff_t distance_to(polygon_iterator const& other) const
+    {
+        return other.m_starts - m_starts;
+    }
+
+    part_table m_table;
+    std::size_t const* m_starts;
+};
+
+}} // namespace detail::shp
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only multi polygon, referring to the rings of a shapefile polygon
+\details A shapefile polygon can have more than one exterior ring.
+    Each clockwise ring starts a polygon, the counter clockwise rings
+    following it are its holes. The rings are not copied, only the index
+    of the first ring of each polygon is stored.
+\ingroup shapelib
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class shp_multi_polygon_view
+{
+public :
+    typedef shp_polygon_view<CoordinateSystem> value_type;
+    typedef detail::shp::polygon_iterator<value_type> iterator;
+    typedef detail::shp::polygon_iterator<value_type> const_iterator;
+    typedef std::size_t size_type;
+
+    inline shp_multi_polygon_view()
+        : m_table()
+        , m_starts(1, 0)
+    {}
+
+    explicit inline shp_multi_polygon_view(detail::shp::part_table const& table)
+        : m_table(table)
+    {
+        typedef shp_ring_view<CoordinateSystem> ring_view_type;
+        for (std::size_t i = 0; i < table.part_count; i++)
+        {
+            if (i == 0 || is_clockwise(table.get<ring_view_type>(i)))
+            {
+                m_starts.push_back(i);
+            }
+        }
+        m_starts.push_back(table.part_count);
+    }
+
+    // The iterators refer to the polygon starts of this view
+    inline const_iterator begin() const
+    {
+        return const_iterator(m_table, &m_starts[0]);
+    }
+
+    inline const_iterator end() const
+    {
+        return const_iterator(m_table, &m_starts[0] + size());
+    }
+
+    inline size_type size() const { return m_starts.size() - 1; }
+    inline bool empty() const { return size() == 0; }
+
+    inline value_type operator[](size_type index) const
+    {
+        return value_type(m_table, m_starts[index], m_starts[index + 1]);
+    }
+
+private :
+    template <typename Ring>
+    static inline bool is_clockwise(Ring const& ring)
+    {
+        // Twice the signed area (shoelace), negative for clockwise rings
+        double sum = 0;
+        for (std::size_t i = 1; i < ring.size(); i++)
+        {
+            shp_point_view<CoordinateSystem> const p = ring[i - 1];
+            shp_point_view<CoordinateSystem> const q = ring[i];
+            sum += p.template get<0>() * q.template get<1>()
+                 - q.template get<0>() * p.template get<1>();
+        }
+        return sum <= 0;
+    }
+
+    detail::shp::part_table m_table;
+    std::vector<std::size_t> m_starts;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename CoordinateSystem>
+struct tag<shp_point_view<CoordinateSystem> >
+{
+    typedef point_tag type;
+};
+
+template <typename CoordinateSystem>
+struct coordinate_type<shp_point_view<CoordinateSystem> >
+{
+    typedef double type;
+};
+
+template <typename CoordinateSystem>
+struct coordinate_system<shp_point_view<CoordinateSystem> >
+{
+    typedef CoordinateSystem type;
+};
+
+template <typename CoordinateSystem>
+struct dimension<shp_point_view<CoordinateSystem> >
+    : boost::mpl::int_<2>
+{};
+
+template <typename CoordinateSystem, std::size_t Dimension>
+struct access<shp_point_view<CoordinateSystem>, Dimension>
+{
+    static inline double get(shp_point_view<CoordinateSystem> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+};
+
+
+template <typename CoordinateSystem>
+struct tag<shp_multi_point_view<CoordinateSystem> >
+{
+    typedef multi_point_tag type;
+};
+
+template <typename CoordinateSystem>
+struct tag<shp_linestring_view<CoordinateSystem> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename CoordinateSystem>
+struct tag<shp_ring_view<CoordinateSystem> >
+{
+    typedef ring_tag type;
+};
+
+template <typename CoordinateSystem>
+struct tag<shp_multi_linestring_view<CoordinateSystem> >
+{
+    typedef multi_linestring_tag type;
+};
+
+
+template <typename CoordinateSystem>
+struct tag<shp_polygon_view<CoordinateSystem> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename CoordinateSystem>
+struct ring_const_type<shp_polygon_view<CoordinateSystem> >
+{
+    typedef typename shp_polygon_view<CoordinateSystem>::ring_view_type type;
+};
+
+template <typename CoordinateSystem>
+struct ring_mutable_type<shp_polygon_view<CoordinateSystem> >
+{
+    typedef typename shp_polygon_view<CoordinateSystem>::ring_view_type type;
+};
+
+template <typename CoordinateSystem>
+struct interior_const_type<shp_polygon_view<CoordinateSystem> >
+{
+    typedef typename shp_polygon_view<CoordinateSystem>::interior_view_type type;
+};
+
+template <typename CoordinateSystem>
+struct interior_mutable_type<shp_polygon_view<CoordinateSystem> >
+{
+    typedef typename shp_polygon_view<CoordinateSystem>::interior_view_type type;
+};
+
+template <typename CoordinateSystem>
+struct exterior_ring<shp_polygon_view<CoordinateSystem> >
+{
+    static inline typename shp_polygon_view<CoordinateSystem>::ring_view_type
+        get(shp_polygon_view<CoordinateSystem> const& p)
+    {
+        return p.exterior();
+    }
+};
+
+template <typename CoordinateSystem>
+struct interior_rings<shp_polygon_view<CoordinateSystem> >
+{
+    static inline typename shp_polygon_view<CoordinateSystem>::interior_view_type
+        get(shp_polygon_view<CoordinateSystem> const& p)
+    {
+        return p.interiors();
+    }
+};
+
+
+template <typename CoordinateSystem>
+struct tag<shp_multi_polygon_view<CoordinateSystem> >
+{
+    typedef multi_polygon_tag type;
+};
+
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXT_GIS_IO_SHAPELIB_SHP_VIEW_HPP
@@ -0,0 +1,372 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_BUFFER_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_BUFFER_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+/*!
+\brief Indicates if a point is stored as a plain array of doubles,
+    such that a range of points has the memory layout of WKB coordinates
+*/
+template <typename Point>
+struct is_packed_double_point : boost::mpl::false_
+{};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct is_packed_double_point
+    <
+        model::point<double, DimensionCount, CoordinateSystem>
+    >
+    : boost::mpl::bool_
+        <
+            sizeof(model::point<double, DimensionCount, CoordinateSystem>)
+                == DimensionCount * sizeof(double)
+        >
+{};
+
+template <typename CoordinateSystem>
+struct is_packed_double_point
+    <
+        model::d2::point_xy<double, CoordinateSystem>
+    >
+    : boost::mpl::bool_
+        <
+            sizeof(model::d2::point_xy<double, CoordinateSystem>)
+                == 2 * sizeof(double)
+        >
+{};
+
+
+/*!
+\brief Indicates if the points of a range are stored contiguously,
+    which is the case for std::vector (the default container of the models)
+    and for arrays
+*/
+template <typename Range>
+struct is_contiguous_range
+{
+    typedef typename boost::range_iterator<Range const>::type iterator;
+    typedef typename boost::range_value<Range>::type value_type;
+
+    static const bool value = boost::is_pointer<iterator>::value
+        || boost::is_same
+            <
+                iterator,
+                typename std::vector<value_type>::const_iterator
+            >::value;
+};
+
+
+inline unsigned char* store_byte_order(unsigned char* bytes,
+                                       byte_order_type::enum_t byte_order)
+{
+    *bytes = static_cast<unsigned char>(byte_order);
+    return bytes + 1;
+}
+
+template <typename T>
+inline unsigned char* store_value(unsigned char* bytes, T const& value,
+                                  bool swap)
+{
+    std::memcpy(bytes, &value, sizeof(T));
+    if (swap)
+    {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    return bytes + sizeof(T);
+}
+
+template <typename Geometry>
+inline unsigned char* store_header(unsigned char* bytes,
+                                   byte_order_type::enum_t byte_order)
+{
+    bytes = store_byte_order(bytes, byte_order);
+    return store_value<boost::uint32_t>(bytes,
+                geometry_type<Geometry>::get(),
+                byte_order != native_byte_order);
+}
+
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = dimension<Point>::value
+>
+struct coordinates_storer
+{
+    static inline unsigned char* apply(unsigned char* bytes,
+                                       Point const& point, bool swap)
+    {
+        // Coordinates of any type are converted to double
+        bytes = store_value<double>(bytes,
+                    static_cast<double>(geometry::get<I>(point)), swap);
+        return coordinates_storer<Point, I + 1, N>::apply(bytes, point, swap);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct coordinates_storer<Point, N, N>
+{
+    static inline unsigned char* apply(unsigned char* bytes,
+                                       Point const& , bool )
+    {
+        return bytes;
+    }
+};
+
+
+template
+<
+    typename Range,
+    bool Packed = is_packed_double_point
+        <
+            typename boost::range_value<Range>::type
+        >::value
+        && is_contiguous_range<Range>::value
+>
+struct points_storer
+{
+    static inline unsigned char* apply(unsigned char* bytes,
+                                       Range const& range, bool swap)
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range);
+             it != boost::end(range);
+             ++it)
+        {
+            bytes = coordinates_storer<point_type>::apply(bytes, *it, swap);
+        }
+        return bytes;
+    }
+};
+
+template <typename Range>
+struct points_storer<Range, true>
+{
+    static inline unsigned char* apply(unsigned char* bytes,
+                                       Range const& range, bool swap)
+    {
+        // The points already have the layout of WKB coordinates:
+        // copy them as one block
+        std::size_t const count = boost::size(range);
+        if (count == 0)
+        {
+            return bytes;
+        }
+
+        std::size_t const length = count * sizeof(*boost::begin(range));
+        std::memcpy(bytes, &*boost::begin(range), length);
+        if (swap)
+        {
+            for (std::size_t i = 0; i < length; i += sizeof(double))
+            {
+                std::reverse(bytes + i, bytes + i + sizeof(double));
+            }
+        }
+        return bytes + length;
+    }
+};
+
+
+template <typename Range>
+inline std::size_t points_size(Range const& range)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    return boost::size(range) * dimension<point_type>::value * sizeof(double);
+}
+
+template <typename Range>
+inline unsigned char* store_points(unsigned char* bytes, Range const& range,
+                                   bool swap)
+{
+    bytes = store_value<boost::uint32_t>(bytes,
+                static_cast<boost::uint32_t>(boost::size(range)), swap);
+    return points_storer<Range>::apply(bytes, range, swap);
+}
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct buffer_writer
+{};
+
+template <typename Point>
+struct buffer_writer<Point, point_tag>
+{
+    static inline std::size_t size(Point const& )
+    {
+        return 5 + dimension<Point>::value * sizeof(double);
+    }
+
+    static inline unsigned char* write(Point const& point,
+                                       unsigned char* bytes,
+                                       byte_order_type::enum_t byte_order)
+    {
+        bytes = store_header<Point>(bytes, byte_order);
+        return coordinates_storer<Point>::apply(bytes, point,
+                    byte_order != native_byte_order);
+    }
+};
+
+template <typename Linestring>
+struct buffer_writer<Linestring, linestring_tag>
+{
+    static inline std::size_t size(Linestring const& linestring)
+    {
+        return 9 + points_size(linestring);
+    }
+
+    static inline unsigned char* write(Linestring const& linestring,
+                                       unsigned char* bytes,
+                                       byte_order_type::enum_t byte_order)
+    {
+        bytes = store_header<Linestring>(bytes, byte_order);
+        return store_points(bytes, linestring,
+                    byte_order != native_byte_order);
+    }
+};
+
+template <typename Polygon>
+struct buffer_writer<Polygon, polygon_tag>
+{
+    typedef typename interior_type<Polygon const>::type interior_type;
+
+    static inline std::size_t size(Polygon const& polygon)
+    {
+        interior_type const& interiors = geometry::interior_rings(polygon);
+
+        std::size_t result = 13 + points_size(geometry::exterior_ring(polygon));
+        for (typename boost::range_iterator<interior_type const>::type
+                it = boost::begin(interiors);
+             it != boost::end(interiors);
+             ++it)
+        {
+            result += 4 + points_size(*it);
+        }
+        return result;
+    }
+
+    static inline unsigned char* write(Polygon const& polygon,
+                                       unsigned char* bytes,
+                                       byte_order_type::enum_t byte_order)
+    {
+        bool const swap = byte_order != native_byte_order;
+        interior_type const& interiors = geometry::interior_rings(polygon);
+
+        bytes = store_header<Polygon>(bytes, byte_order);
+        bytes = store_value<boost::uint32_t>(bytes,
+                    static_cast<boost::uint32_t>(1 + boost::size(interiors)),
+                    swap);
+        bytes = store_points(bytes, geometry::exterior_ring(polygon), swap);
+        for (typename boost::range_iterator<interior_type const>::type
+                it = boost::begin(interiors);
+             it != boost::end(interiors);
+             ++it)
+        {
+            bytes = store_points(bytes, *it, swap);
+        }
+        return bytes;
+    }
+};
+
+template <typename MultiGeometry>
+struct multi_buffer_writer
+{
+    typedef buffer_writer
+        <
+            typename boost::range_value<MultiGeometry>::type
+        > single_writer;
+
+    static inline std::size_t size(MultiGeometry const& multi)
+    {
+        std::size_t result = 9;
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi);
+             it != boost::end(multi);
+             ++it)
+        {
+            result += single_writer::size(*it);
+        }
+        return result;
+    }
+
+    static inline unsigned char* write(MultiGeometry const& multi,
+                                       unsigned char* bytes,
+                                       byte_order_type::enum_t byte_order)
+    {
+        bytes = store_header<MultiGeometry>(bytes, byte_order);
+        bytes = store_value<boost::uint32_t>(bytes,
+                    static_cast<boost::uint32_t>(boost::size(multi)),
+                    byte_order != native_byte_order);
+
+        // Each member has its own byte order and geometry type
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi);
+             it != boost::end(multi);
+             ++it)
+        {
+            bytes = single_writer::write(*it, bytes, byte_order);
+        }
+        return bytes;
+    }
+};
+
+template <typename MultiPoint>
+struct buffer_writer<MultiPoint, multi_point_tag>
+    : multi_buffer_writer<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct buffer_writer<MultiLinestring, multi_linestring_tag>
+    : multi_buffer_writer<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct buffer_writer<MultiPolygon, multi_polygon_tag>
+    : multi_buffer_writer<MultiPolygon>
+{};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_BUFFER_WRITER_HPP
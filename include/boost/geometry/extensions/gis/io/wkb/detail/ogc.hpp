@@ -10,6 +10,7 @@
 #define BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
 
 #include <boost/cstdint.hpp>
+#include <boost/detail/endian.hpp>
 
 namespace boost { namespace geometry
 {
@@ -62,19 +63,23 @@ struct byte_order_type
     };
 };
 
+#ifdef BOOST_BIG_ENDIAN
+static const byte_order_type::enum_t native_byte_order = byte_order_type::xdr;
+#else
+static const byte_order_type::enum_t native_byte_order = byte_order_type::ndr;
+#endif
+
 struct geometry_type_ogc
 {
     enum enum_t
     {
         point      = 1,
         linestring = 2,
-        polygon    = 3
-
-        // TODO: Not implemented
-        //multipoint = 4,
-        //multilinestring = 5,
-        //multipolygon = 6,
-        //collection = 7
+        polygon    = 3,
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        collection = 7
     };
 };
 
@@ -85,17 +90,18 @@ struct geometry_type_ewkt
         point      = 1,
         linestring = 2,
         polygon    = 3,
-
-        // TODO: Not implemented
-        //multipoint = 4,
-        //multilinestring = 5,
-        //multipolygon = 6,
-        //collection = 7
-
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        collection = 7,
 
         pointz      = 1001,
         linestringz = 1002,
-        polygonz    = 1003
+        polygonz    = 1003,
+        multipointz = 1004,
+        multilinestringz = 1005,
+        multipolygonz = 1006,
+        collectionz = 1007
     };
 };
 
@@ -169,6 +175,21 @@ struct geometry_type<Geometry, CheckPolicy, polygon_tag>
     : geometry_type_impl<Geometry, geometry_type_ogc::polygon>
 {};
 
+template <typename Geometry, typename CheckPolicy>
+struct geometry_type<Geometry, CheckPolicy, multi_point_tag>
+    : geometry_type_impl<Geometry, geometry_type_ogc::multipoint>
+{};
+
+template <typename Geometry, typename CheckPolicy>
+struct geometry_type<Geometry, CheckPolicy, multi_linestring_tag>
+    : geometry_type_impl<Geometry, geometry_type_ogc::multilinestring>
+{};
+
+template <typename Geometry, typename CheckPolicy>
+struct geometry_type<Geometry, CheckPolicy, multi_polygon_tag>
+    : geometry_type_impl<Geometry, geometry_type_ogc::multipolygon>
+{};
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
@@ -27,6 +27,7 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
 
@@ -294,6 +295,53 @@ struct polygon_parser
     }
 };
 
+template <typename MultiGeometry, typename Parser>
+struct multi_parser
+{
+    template <typename Iterator>
+    static bool parse(Iterator& it, Iterator end, MultiGeometry& multi,
+                byte_order_type::enum_t order)
+    {
+        if (!geometry_type_parser<MultiGeometry>::parse(it, end, order))
+        {
+            return false;
+        }
+
+        boost::uint32_t num_geometries(0);
+        if (!value_parser<boost::uint32_t>::parse(it, end, num_geometries, order))
+        {
+            return false;
+        }
+
+        // Each geometry has at least a byte order and a geometry type,
+        // check this before allocating
+        typedef typename std::iterator_traits<Iterator>::difference_type size_type;
+        if (std::distance(it, end) / 5 < static_cast<size_type>(num_geometries))
+        {
+            return false;
+        }
+
+        for (boost::uint32_t i = 0; i < num_geometries; ++i)
+        {
+            // Each geometry has its own byte order
+            byte_order_type::enum_t geometry_order = byte_order_type::unknown;
+            if (!byte_order_parser::parse(it, end, geometry_order)
+                || geometry_order == byte_order_type::unknown)
+            {
+                return false;
+            }
+
+            range::resize(multi, i + 1);
+            if (!Parser::parse(it, end, range::back(multi), geometry_order))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
@@ -22,6 +22,8 @@
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/type_traits/is_same.hpp>
 
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
@@ -227,6 +229,41 @@ namespace detail { namespace wkb
         }
     };
 
+    template <typename MultiGeometry, typename Writer>
+    struct multi_writer
+    {
+        template <typename OutputIterator>
+        static bool write(MultiGeometry const& multi,
+                          OutputIterator& iter,
+                          byte_order_type::enum_t byte_order)
+        {
+            // write endian type
+            value_writer<uint8_t>::write(byte_order, iter, byte_order);
+
+            // write geometry type
+            uint32_t type = geometry_type<MultiGeometry>::get();
+            value_writer<uint32_t>::write(type, iter, byte_order);
+
+            // write num geometries
+            uint32_t num_geometries = boost::size(multi);
+            value_writer<uint32_t>::write(num_geometries, iter, byte_order);
+
+            // write geometries, each with their own endian and geometry type
+            for(typename boost::range_iterator<MultiGeometry const>::type
+                    it = boost::begin(multi);
+                it != boost::end(multi);
+                ++it)
+            {
+                if (! Writer::write(*it, iter, byte_order))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
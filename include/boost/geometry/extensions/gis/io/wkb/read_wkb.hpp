@@ -11,10 +11,18 @@
 
 #include <iterator>
 
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/range.hpp>
+#include <boost/ref.hpp>
+#include <boost/type_traits/add_pointer.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/variant/variant_fwd.hpp>
 
+#include <boost/geometry/algorithms/clear.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
 
 namespace boost { namespace geometry
@@ -62,10 +70,200 @@ struct read_wkb<polygon_tag, G>
     }
 };
 
+template <typename G>
+struct read_wkb<multi_point_tag, G>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, G& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multi_parser
+            <
+                G,
+                detail::wkb::point_parser<typename boost::range_value<G>::type>
+            >::parse(it, end, geometry, order);
+    }
+};
+
+template <typename G>
+struct read_wkb<multi_linestring_tag, G>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, G& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multi_parser
+            <
+                G,
+                detail::wkb::linestring_parser<typename boost::range_value<G>::type>
+            >::parse(it, end, geometry, order);
+    }
+};
+
+template <typename G>
+struct read_wkb<multi_polygon_tag, G>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, G& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        geometry::clear(geometry);
+        return detail::wkb::multi_parser
+            <
+                G,
+                detail::wkb::polygon_parser<typename boost::range_value<G>::type>
+            >::parse(it, end, geometry, order);
+    }
+};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template <typename G>
+struct read_geometry
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, G& geometry,
+        byte_order_type::enum_t order)
+    {
+        return dispatch::read_wkb
+            <
+                typename tag<G>::type,
+                G
+            >::parse(it, end, geometry, order);
+    }
+};
+
+// Reads a geometry of the type, which is specified in the WKB,
+// into the variant, if it is one of the variant's types
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct read_geometry<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+{
+    typedef boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> variant_type;
+
+    template <typename Iterator>
+    struct visitor
+    {
+        visitor(Iterator& it, Iterator end, variant_type& geometry,
+                boost::uint32_t type, byte_order_type::enum_t order)
+            : m_it(it)
+            , m_end(end)
+            , m_geometry(geometry)
+            , m_type(type)
+            , m_order(order)
+            , m_found(false)
+            , m_result(false)
+        {}
+
+        template <typename Geometry>
+        inline void operator()(Geometry*)
+        {
+            if (m_found || ! geometry_type<Geometry>::check(m_type))
+            {
+                return;
+            }
+
+            m_found = true;
+            Geometry geometry;
+            Iterator it = m_it;
+            m_result = read_geometry<Geometry>::parse(it, m_end, geometry, m_order);
+            if (m_result)
+            {
+                m_geometry = geometry;
+                m_it = it;
+            }
+        }
+
+        Iterator& m_it;
+        Iterator m_end;
+        variant_type& m_geometry;
+        boost::uint32_t m_type;
+        byte_order_type::enum_t m_order;
+        bool m_found;
+        bool m_result;
+    };
+
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, variant_type& geometry,
+        byte_order_type::enum_t order)
+    {
+        // Peek the geometry type
+        Iterator type_it = it;
+        boost::uint32_t type(0);
+        if (! value_parser<boost::uint32_t>::parse(type_it, end, type, order))
+        {
+            return false;
+        }
+
+        visitor<Iterator> v(it, end, geometry, type, order);
+        boost::mpl::for_each
+            <
+                typename variant_type::types,
+                boost::add_pointer<boost::mpl::_1>
+            >(boost::ref(v));
+        return v.m_result;
+    }
+};
+
+template <typename Collection>
+struct collection_parser
+{
+    template <typename Iterator>
+    static bool parse(Iterator& it, Iterator end, Collection& collection,
+                byte_order_type::enum_t order)
+    {
+        boost::uint32_t type(0);
+        if (! value_parser<boost::uint32_t>::parse(it, end, type, order)
+            || (type != geometry_type_ogc::collection
+                && type != geometry_type_ewkt::collectionz))
+        {
+            return false;
+        }
+
+        boost::uint32_t num_geometries(0);
+        if (! value_parser<boost::uint32_t>::parse(it, end, num_geometries, order))
+        {
+            return false;
+        }
+
+        typedef typename std::iterator_traits<Iterator>::difference_type size_type;
+        if (std::distance(it, end) / 5 < static_cast<size_type>(num_geometries))
+        {
+            return false;
+        }
+
+        typedef typename boost::range_value<Collection>::type value_type;
+        for (boost::uint32_t i = 0; i < num_geometries; ++i)
+        {
+            byte_order_type::enum_t geometry_order = byte_order_type::unknown;
+            if (! byte_order_parser::parse(it, end, geometry_order)
+                || geometry_order == byte_order_type::unknown)
+            {
+                return false;
+            }
+
+            range::resize(collection, i + 1);
+            if (! read_geometry<value_type>::parse(it, end,
+                        range::back(collection), geometry_order))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
 template <typename Iterator, typename G>
 inline bool read_wkb(Iterator begin, Iterator end, G& geometry)
 {
@@ -80,11 +278,7 @@ inline bool read_wkb(Iterator begin, Iterator end, G& geometry)
     detail::wkb::byte_order_type::enum_t byte_order;
     if (detail::wkb::byte_order_parser::parse(begin, end, byte_order))
     {
-        return dispatch::read_wkb
-            <
-            typename tag<G>::type,
-            G
-            >::parse(begin, end, geometry, byte_order);
+        return detail::wkb::read_geometry<G>::parse(begin, end, geometry, byte_order);
     }
 
     return false;
@@ -102,6 +296,38 @@ inline bool read_wkb(ByteType const* bytes, std::size_t length, G& geometry)
     return read_wkb(begin, end, geometry);
 }
 
+/*!
+\brief Reads a WKB geometry collection
+\details The collection is cleared, and the geometries are then added
+    to it in the order of the WKB. The collection is a range of
+    boost::variant, for example std::vector<boost::variant<point, linestring,
+    polygon> >. Each geometry is read into the type of the variant
+    corresponding to its WKB geometry type. Reading fails if there is no
+    such type, or for nested geometry collections.
+*/
+template <typename Iterator, typename Collection>
+inline bool read_wkb_collection(Iterator begin, Iterator end,
+                                Collection& collection)
+{
+    BOOST_STATIC_ASSERT((
+        boost::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+
+    range::clear(collection);
+
+    detail::wkb::byte_order_type::enum_t byte_order;
+    if (detail::wkb::byte_order_parser::parse(begin, end, byte_order))
+    {
+        return detail::wkb::collection_parser<Collection>::parse(begin, end,
+                    collection, byte_order);
+    }
+
+    return false;
+}
+
 
 }} // namespace boost::geometry
 
@@ -0,0 +1,762 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/mpl/int.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+//! Loads a value from WKB bytes, swapping the bytes if the byte order
+//! of the WKB is not the native byte order
+template <typename T>
+inline T load_value(unsigned char const* bytes, bool swap)
+{
+    T value;
+    if (! swap)
+    {
+        // The usual case: little endian WKB on a little endian machine
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+    else
+    {
+        unsigned char swapped[sizeof(T)];
+        std::reverse_copy(bytes, bytes + sizeof(T), swapped);
+        std::memcpy(&value, swapped, sizeof(T));
+    }
+    return value;
+}
+
+/*!
+\brief Parses the byte order and geometry type of a WKB geometry
+\details Returns false if the buffer is too small, if the byte order is
+    invalid or if the geometry type is not the type of the view
+*/
+template <typename View>
+inline bool parse_view_header(unsigned char const* data, std::size_t length,
+                              bool& swap)
+{
+    if (data == NULL || length < 5 || data[0] >= byte_order_type::unknown)
+    {
+        return false;
+    }
+    swap = data[0] != native_byte_order;
+    return geometry_type<View>::check(load_value<boost::uint32_t>(data + 1, swap));
+}
+
+
+/*!
+\brief Iterator over consecutive WKB points, dereferencing to a point view
+*/
+template <typename PointView>
+class point_view_iterator
+    : public boost::iterator_facade
+        <
+            point_view_iterator<PointView>,
+            PointView const,
+            boost::random_access_traversal_tag,
+            PointView
+        >
+{
+public :
+    static const std::size_t point_size = PointView::wkb_point_size;
+
+    inline point_view_iterator()
+        : m_data(NULL)
+        , m_swap(false)
+    {}
+
+    inline point_view_iterator(unsigned char const* data, bool swap)
+        : m_data(data)
+        , m_swap(swap)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline PointView dereference() const
+    {
+        return PointView(m_data, m_swap);
+    }
+
+    inline bool equal(point_view_iterator const& other) const
+    {
+        return m_data == other.m_data;
+    }
+
+    inline void increment() { m_data += point_size; }
+    inline void decrement() { m_data -= point_size; }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        m_data += n * static_cast<std::ptrdiff_t>(point_size);
+    }
+
+    inline std::ptrdiff_t distance_to(point_view_iterator const& other) const
+    {
+        return (other.m_data - m_data) / static_cast<std::ptrdiff_t>(point_size);
+    }
+
+    unsigned char const* m_data;
+    bool m_swap;
+};
+
+
+/*!
+\brief Range of consecutive WKB points, preceded by their number,
+    as in WKB linestrings and polygon rings
+*/
+template <typename PointView>
+class point_range_view
+{
+public :
+    typedef PointView value_type;
+    typedef point_view_iterator<PointView> iterator;
+    typedef point_view_iterator<PointView> const_iterator;
+    typedef std::size_t size_type;
+
+    inline point_range_view()
+        : m_points(NULL)
+        , m_count(0)
+        , m_swap(false)
+    {}
+
+    //! Constructs from the number of points in the WKB, followed by points
+    inline point_range_view(unsigned char const* data, bool swap)
+        : m_points(data + 4)
+        , m_count(load_value<boost::uint32_t>(data, swap))
+        , m_swap(swap)
+    {}
+
+    inline const_iterator begin() const
+    {
+        return const_iterator(m_points, m_swap);
+    }
+
+    inline const_iterator end() const
+    {
+        return const_iterator(m_points + m_count * PointView::wkb_point_size,
+                              m_swap);
+    }
+
+    inline size_type size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    inline PointView operator[](size_type index) const
+    {
+        return PointView(m_points + index * PointView::wkb_point_size, m_swap);
+    }
+
+    inline PointView front() const { return operator[](0); }
+    inline PointView back() const { return operator[](m_count - 1); }
+
+    //! Returns the number of bytes in the WKB, including the point count
+    inline std::size_t wkb_size() const
+    {
+        return 4 + m_count * PointView::wkb_point_size;
+    }
+
+    //! Checks if the points fit in the number of bytes (including the count)
+    static inline bool fits(unsigned char const* data, std::size_t length,
+                            bool swap)
+    {
+        return length >= 4
+            && load_value<boost::uint32_t>(data, swap)
+                <= (length - 4) / PointView::wkb_point_size;
+    }
+
+private :
+    unsigned char const* m_points;
+    std::size_t m_count;
+    bool m_swap;
+};
+
+
+/*!
+\brief Iterator over the consecutive rings of a WKB polygon
+*/
+template <typename RingView>
+class ring_view_iterator
+    : public boost::iterator_facade
+        <
+            ring_view_iterator<RingView>,
+            RingView const,
+            boost::forward_traversal_tag,
+            RingView
+        >
+{
+public :
+    inline ring_view_iterator()
+        : m_data(NULL)
+        , m_swap(false)
+    {}
+
+    inline ring_view_iterator(unsigned char const* data, bool swap)
+        : m_data(data)
+        , m_swap(swap)
+    {}
+
+private :
+    friend class boost::iterator_core_access;
+
+    inline RingView dereference() const
+    {
+        return RingView(m_data, m_swap);
+    }
+
+    inline bool equal(ring_view_iterator const& other) const
+    {
+        return m_data == other.m_data;
+    }
+
+    inline void increment()
+    {
+        m_data += RingView(m_data, m_swap).wkb_size();
+    }
+
+    unsigned char const* m_data;
+    bool m_swap;
+};
+
+
+/*!
+\brief Range of the interior rings of a WKB polygon
+*/
+template <typename RingView>
+class ring_range_view
+{
+public :
+    typedef RingView value_type;
+    typedef ring_view_iterator<RingView> iterator;
+    typedef ring_view_iterator<RingView> const_iterator;
+    typedef std::size_t size_type;
+
+    inline ring_range_view()
+        : m_begin(NULL)
+        , m_end(NULL)
+        , m_count(0)
+        , m_swap(false)
+    {}
+
+    inline ring_range_view(unsigned char const* begin, unsigned char const* end,
+                           std::size_t count, bool swap)
+        : m_begin(begin)
+        , m_end(end)
+        , m_count(count)
+        , m_swap(swap)
+    {}
+
+    inline const_iterator begin() const { return const_iterator(m_begin, m_swap); }
+    inline const_iterator end() const { return const_iterator(m_end, m_swap); }
+    inline size_type size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+private :
+    unsigned char const* m_begin;
+    unsigned char const* m_end;
+    std::size_t m_count;
+    bool m_swap;
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only point, referring to the coordinates of a WKB point
+\details WKB coordinates are doubles. The view refers to the bytes,
+    which must outlive it. Coordinates in the native byte order (usually
+    little endian) are read by a plain memory copy, others are swapped.
+\tparam DimensionCount number of dimensions
+\tparam CoordinateSystem coordinate system, for example cs::cartesian
+\ingroup wkb
+*/
+template
+<
+    std::size_t DimensionCount = 2,
+    typename CoordinateSystem = cs::cartesian
+>
+class wkb_point_view
+{
+public :
+    static const std::size_t wkb_point_size = DimensionCount * sizeof(double);
+
+    inline wkb_point_view()
+        : m_coordinates(NULL)
+        , m_swap(false)
+    {}
+
+    //! Constructs a view on the coordinates only (not on a WKB point)
+    inline wkb_point_view(unsigned char const* coordinates, bool swap)
+        : m_coordinates(coordinates)
+        , m_swap(swap)
+    {}
+
+    /*!
+    \brief Assigns the view to the WKB point in the specified bytes
+    \return false if the bytes do not contain a WKB point of this dimension
+    */
+    inline bool assign(unsigned char const* data, std::size_t length)
+    {
+        bool swap = false;
+        if (! detail::wkb::parse_view_header<wkb_point_view>(data, length, swap)
+            || length < wkb_size())
+        {
+            return false;
+        }
+        m_coordinates = data + 5;
+        m_swap = swap;
+        return true;
+    }
+
+    template <std::size_t Dimension>
+    inline double get() const
+    {
+        return detail::wkb::load_value<double>(
+                    m_coordinates + Dimension * sizeof(double), m_swap);
+    }
+
+    //! Returns the number of bytes of the WKB point
+    inline std::size_t wkb_size() const
+    {
+        return 5 + wkb_point_size;
+    }
+
+private :
+    unsigned char const* m_coordinates;
+    bool m_swap;
+};
+
+
+/*!
+\brief Read-only linestring, referring to the points of a WKB linestring
+\details The points are wkb_point_view's, created while iterating.
+    The view refers to the bytes, which must outlive it.
+\ingroup wkb
+*/
+template
+<
+    std::size_t DimensionCount = 2,
+    typename CoordinateSystem = cs::cartesian
+>
+class wkb_linestring_view
+    : public detail::wkb::point_range_view
+        <
+            wkb_point_view<DimensionCount, CoordinateSystem>
+        >
+{
+    typedef wkb_point_view<DimensionCount, CoordinateSystem> point_view_type;
+    typedef detail::wkb::point_range_view<point_view_type> base_type;
+
+public :
+    inline wkb_linestring_view()
+    {}
+
+    /*!
+    \brief Assigns the view to the WKB linestring in the specified bytes
+    \return false if the bytes do not contain a WKB linestring of this
+        dimension, or are too few for its points
+    */
+    inline bool assign(unsigned char const* data, std::size_t length)
+    {
+        bool swap = false;
+        if (! detail::wkb::parse_view_header<wkb_linestring_view>(data, length, swap)
+            || ! base_type::fits(data + 5, length - 5, swap))
+        {
+            return false;
+        }
+        base_type::operator=(base_type(data + 5, swap));
+        return true;
+    }
+
+    //! Returns the number of bytes of the WKB linestring
+    inline std::size_t wkb_size() const
+    {
+        return 5 + base_type::wkb_size();
+    }
+};
+
+
+/*!
+\brief Read-only ring, referring to the points of a ring in a WKB polygon
+\details Rings do not exist as WKB geometries, they are part of polygons.
+\ingroup wkb
+*/
+template
+<
+    std::size_t DimensionCount = 2,
+    typename CoordinateSystem = cs::cartesian,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class wkb_ring_view
+    : public detail::wkb::point_range_view
+        <
+            wkb_point_view<DimensionCount, CoordinateSystem>
+        >
+{
+    typedef wkb_point_view<DimensionCount, CoordinateSystem> point_view_type;
+    typedef detail::wkb::point_range_view<point_view_type> base_type;
+
+public :
+    inline wkb_ring_view()
+    {}
+
+    //! Constructs from the number of points in the WKB, followed by points
+    inline wkb_ring_view(unsigned char const* data, bool swap)
+        : base_type(data, swap)
+    {}
+};
+
+
+/*!
+\brief Read-only polygon, referring to the rings of a WKB polygon
+\details The rings are wkb_ring_view's, created while iterating.
+    The view refers to the bytes, which must outlive it.
+\tparam DimensionCount number of dimensions
+\tparam CoordinateSystem coordinate system, for example cs::cartesian
+\tparam ClockWise true for clockwise exterior rings, as model::polygon
+\tparam Closed true if the rings are closed, as required by WKB
+\ingroup wkb
+*/
+template
+<
+    std::size_t DimensionCount = 2,
+    typename CoordinateSystem = cs::cartesian,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class wkb_polygon_view
+{
+public :
+    typedef wkb_ring_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        > ring_view_type;
+    typedef detail::wkb::ring_range_view<ring_view_type> interior_view_type;
+
+    inline wkb_polygon_view()
+        : m_rings(NULL)
+        , m_end(NULL)
+        , m_ring_count(0)
+        , m_swap(false)
+    {}
+
+    /*!
+    \brief Assigns the view to the WKB polygon in the specified bytes
+    \return false if the bytes do not contain a WKB polygon of this
+        dimension, or are too few for its rings
+    */
+    inline bool assign(unsigned char const* data, std::size_t length)
+    {
+        bool swap = false;
+        if (! detail::wkb::parse_view_header<wkb_polygon_view>(data, length, swap)
+            || length < 9)
+        {
+            return false;
+        }
+
+        // Verify that all rings fit, and find the end
+        boost::uint32_t const ring_count
+            = detail::wkb::load_value<boost::uint32_t>(data + 5, swap);
+        unsigned char const* it = data + 9;
+        std::size_t remaining = length - 9;
+        for (boost::uint32_t i = 0; i < ring_count; i++)
+        {
+            if (! ring_view_type::fits(it, remaining, swap))
+            {
+                return false;
+            }
+            std::size_t const size = ring_view_type(it, swap).wkb_size();
+            it += size;
+            remaining -= size;
+        }
+
+        m_rings = data + 9;
+        m_end = it;
+        m_ring_count = ring_count;
+        m_swap = swap;
+        return true;
+    }
+
+    inline ring_view_type exterior() const
+    {
+        return m_ring_count > 0 ? ring_view_type(m_rings, m_swap) : ring_view_type();
+    }
+
+    inline interior_view_type interiors() const
+    {
+        if (m_ring_count <= 1)
+        {
+            return interior_view_type();
+        }
+        return interior_view_type(m_rings + exterior().wkb_size(), m_end,
+                                  m_ring_count - 1, m_swap);
+    }
+
+    //! Returns the number of bytes of the WKB polygon
+    inline std::size_t wkb_size() const
+    {
+        return m_rings == NULL ? 0 : 9 + (m_end - m_rings);
+    }
+
+private :
+    unsigned char const* m_rings;
+    unsigned char const* m_end;
+    std::size_t m_ring_count;
+    bool m_swap;
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct tag<wkb_point_view<DimensionCount, CoordinateSystem> >
+{
+    typedef point_tag type;
+};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct coordinate_type<wkb_point_view<DimensionCount, CoordinateSystem> >
+{
+    typedef double type;
+};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct coordinate_system<wkb_point_view<DimensionCount, CoordinateSystem> >
+{
+    typedef CoordinateSystem type;
+};
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct dimension<wkb_point_view<DimensionCount, CoordinateSystem> >
+    : boost::mpl::int_<DimensionCount>
+{};
+
+template
+<
+    std::size_t DimensionCount,
+    typename CoordinateSystem,
+    std::size_t Dimension
+>
+struct access<wkb_point_view<DimensionCount, CoordinateSystem>, Dimension>
+{
+    static inline double get(
+        wkb_point_view<DimensionCount, CoordinateSystem> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+};
+
+
+template <std::size_t DimensionCount, typename CoordinateSystem>
+struct tag<wkb_linestring_view<DimensionCount, CoordinateSystem> >
+{
+    typedef linestring_tag type;
+};
+
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct tag
+    <
+        wkb_ring_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef ring_tag type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool Closed
+>
+struct point_order
+    <
+        wkb_ring_view<DimensionCount, CoordinateSystem, false, Closed>
+    >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise
+>
+struct closure
+    <
+        wkb_ring_view<DimensionCount, CoordinateSystem, ClockWise, false>
+    >
+{
+    static const closure_selector value = open;
+};
+
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct tag
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef polygon_tag type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct ring_const_type
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef typename wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        >::ring_view_type type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct ring_mutable_type
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef typename wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        >::ring_view_type type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct interior_const_type
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef typename wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        >::interior_view_type type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct interior_mutable_type
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef typename wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        >::interior_view_type type;
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct exterior_ring
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        > polygon_type;
+
+    static inline typename polygon_type::ring_view_type
+        get(polygon_type const& p)
+    {
+        return p.exterior();
+    }
+};
+
+template
+<
+    std::size_t DimensionCount, typename CoordinateSystem,
+    bool ClockWise, bool Closed
+>
+struct interior_rings
+    <
+        wkb_polygon_view<DimensionCount, CoordinateSystem, ClockWise, Closed>
+    >
+{
+    typedef wkb_polygon_view
+        <
+            DimensionCount, CoordinateSystem, ClockWise, Closed
+        > polygon_type;
+
+    static inline typename polygon_type::interior_view_type
+        get(polygon_type const& p)
+    {
+        return p.interiors();
+    }
+};
+
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
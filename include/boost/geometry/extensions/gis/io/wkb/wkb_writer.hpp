@@ -0,0 +1,250 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_WRITER_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/detail/endian.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/buffer_writer.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Returns the number of bytes of the WKB of a geometry
+\param geometry \param_geometry
+*/
+template <typename Geometry>
+inline std::size_t wkb_size(Geometry const& geometry)
+{
+    concept::check<Geometry const>();
+    return detail::wkb::buffer_writer<Geometry>::size(geometry);
+}
+
+
+/*!
+\brief Writes geometries as WKB into a byte buffer
+\details The size of the WKB is computed first, such that the buffer is
+    resized only once per geometry, and the bytes are written directly
+    into it. Points stored as plain arrays of doubles (model::point and
+    model::d2::point_xy with double coordinates) in a std::vector are
+    copied as one block per linestring or ring.
+    Besides point, linestring and polygon, multi geometries are written.
+    The byte order is the native byte order by default; if another byte
+    order is specified, the bytes of all values are swapped.
+\par Example:
+\code
+wkb_writer writer;
+std::vector<unsigned char> const& wkb = writer.write(polygon);
+\endcode
+*/
+class wkb_writer
+{
+public :
+    enum byte_order
+    {
+        big_endian = detail::wkb::byte_order_type::xdr,
+        little_endian = detail::wkb::byte_order_type::ndr,
+#ifdef BOOST_BIG_ENDIAN
+        native = big_endian
+#else
+        native = little_endian
+#endif
+    };
+
+    explicit inline wkb_writer(byte_order order = native)
+        : m_byte_order(order)
+    {}
+
+    inline byte_order get_byte_order() const { return m_byte_order; }
+
+    /*!
+    \brief Writes the WKB of a geometry at the specified location
+    \details The location should have room for wkb_size(geometry) bytes
+    \return a pointer past the last byte written
+    */
+    template <typename Geometry>
+    inline unsigned char* write_to(Geometry const& geometry,
+                                   unsigned char* bytes) const
+    {
+        concept::check<Geometry const>();
+        return detail::wkb::buffer_writer<Geometry>::write(geometry, bytes,
+            static_cast<detail::wkb::byte_order_type::enum_t>(m_byte_order));
+    }
+
+    /*!
+    \brief Appends the WKB of a geometry to a buffer
+    \param geometry \param_geometry
+    \param buffer vector to which the WKB is appended
+    */
+    template <typename Geometry>
+    inline void append(Geometry const& geometry,
+                       std::vector<unsigned char>& buffer) const
+    {
+        std::size_t const offset = buffer.size();
+        buffer.resize(offset + wkb_size(geometry));
+        write_to(geometry, &buffer[offset]);
+    }
+
+    /*!
+    \brief Returns the WKB of a geometry
+    \details The returned vector is a buffer owned by the writer, which is
+        reused (and overwritten) by the next call
+    */
+    template <typename Geometry>
+    inline std::vector<unsigned char> const& write(Geometry const& geometry)
+    {
+        m_buffer.clear();
+        append(geometry, m_buffer);
+        return m_buffer;
+    }
+
+private :
+    byte_order m_byte_order;
+    std::vector<unsigned char> m_buffer;
+};
+
+
+/*!
+\brief Writes many geometries as WKB into one contiguous buffer
+\details The WKB of all geometries is stored consecutively, and an offsets
+    table is maintained: the WKB of geometry i starts at offsets()[i] and
+    ends at offsets()[i + 1]. The offsets table therefore has one entry
+    more than the number of geometries. This is the layout used for bulk
+    loading into databases (e.g. binary COPY or array binding), or for
+    columnar (e.g. Arrow) binary columns.
+    Geometries can be appended one by one, or as a range, in which case
+    the total size is computed first and the buffer is resized only once.
+\par Example:
+\code
+wkb_batch_writer writer;
+writer.append(polygons);
+for (std::size_t i = 0; i < writer.count(); i++)
+{
+    bind(writer.wkb(i), writer.wkb_size(i));
+}
+\endcode
+*/
+class wkb_batch_writer
+{
+public :
+    typedef wkb_writer::byte_order byte_order;
+
+    explicit inline wkb_batch_writer(byte_order order = wkb_writer::native)
+        : m_writer(order)
+        , m_offsets(1, 0)
+    {}
+
+    //! Reserves memory for a number of bytes and a number of geometries
+    inline void reserve(std::size_t bytes, std::size_t geometries)
+    {
+        m_buffer.reserve(bytes);
+        m_offsets.reserve(geometries + 1);
+    }
+
+    inline void clear()
+    {
+        m_buffer.clear();
+        m_offsets.resize(1);
+    }
+
+    /*!
+    \brief Appends the WKB of a geometry
+    \return the index of the geometry in the batch
+    */
+    template <typename Geometry>
+    inline std::size_t append(Geometry const& geometry)
+    {
+        m_writer.append(geometry, m_buffer);
+        m_offsets.push_back(m_buffer.size());
+        return m_offsets.size() - 2;
+    }
+
+    /*!
+    \brief Appends the WKB of all geometries of a range
+    \details The size of all WKB is computed first, such that the buffer is
+        resized only once
+    */
+    template <typename Range>
+    inline void append_range(Range const& geometries)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        std::size_t const first = m_offsets.size() - 1;
+        std::size_t offset = m_buffer.size();
+        m_offsets.reserve(m_offsets.size() + boost::size(geometries));
+        for (iterator it = boost::begin(geometries);
+             it != boost::end(geometries);
+             ++it)
+        {
+            offset += geometry::wkb_size(*it);
+            m_offsets.push_back(offset);
+        }
+
+        m_buffer.resize(offset);
+        std::size_t index = first;
+        for (iterator it = boost::begin(geometries);
+             it != boost::end(geometries);
+             ++it, ++index)
+        {
+            m_writer.write_to(*it, data() + m_offsets[index]);
+        }
+    }
+
+    //! Returns the number of geometries in the batch
+    inline std::size_t count() const { return m_offsets.size() - 1; }
+
+    //! Returns the WKB of a geometry in the batch
+    inline unsigned char const* wkb(std::size_t index) const
+    {
+        return data() + m_offsets[index];
+    }
+
+    //! Returns the number of bytes of the WKB of a geometry in the batch
+    inline std::size_t wkb_size(std::size_t index) const
+    {
+        return m_offsets[index + 1] - m_offsets[index];
+    }
+
+    inline std::vector<unsigned char> const& buffer() const
+    {
+        return m_buffer;
+    }
+
+    inline std::vector<std::size_t> const& offsets() const
+    {
+        return m_offsets;
+    }
+
+private :
+    // The first byte of the buffer, or a null pointer if it is empty
+    inline unsigned char* data()
+    {
+        return m_buffer.empty() ? 0 : &m_buffer[0];
+    }
+
+    inline unsigned char const* data() const
+    {
+        return m_buffer.empty() ? 0 : &m_buffer[0];
+    }
+
+    wkb_writer m_writer;
+    std::vector<unsigned char> m_buffer;
+    std::vector<std::size_t> m_offsets;
+};
+
+
+}} // namespace boost::geometry
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_WRITER_HPP
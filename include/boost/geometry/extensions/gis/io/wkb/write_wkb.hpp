@@ -11,6 +11,7 @@
 
 #include <iterator>
 
+#include <boost/range.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/static_assert.hpp>
 
@@ -62,6 +63,51 @@ struct write_wkb<polygon_tag, G>
     }
 };
 
+template <typename G>
+struct write_wkb<multi_point_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multi_writer
+            <
+                G,
+                detail::wkb::point_writer<typename boost::range_value<G>::type>
+            >::write(geometry, iter, byte_order);
+    }
+};
+
+template <typename G>
+struct write_wkb<multi_linestring_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multi_writer
+            <
+                G,
+                detail::wkb::linestring_writer<typename boost::range_value<G>::type>
+            >::write(geometry, iter, byte_order);
+    }
+};
+
+template <typename G>
+struct write_wkb<multi_polygon_tag, G>
+{
+    template <typename OutputIterator>
+    static inline bool write(const G& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multi_writer
+            <
+                G,
+                detail::wkb::polygon_writer<typename boost::range_value<G>::type>
+            >::write(geometry, iter, byte_order);
+    }
+};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
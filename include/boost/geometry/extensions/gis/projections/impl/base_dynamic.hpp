@@ -9,9 +9,9 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
-
 #include <boost/geometry/extensions/gis/projections/projection.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -43,6 +43,13 @@ public:
         return m_proj.forward(ll, xy);
     }
 
+    virtual bool forward_n(LL_T const* lon, LL_T const* lat,
+                           XY_T* x, XY_T* y, std::size_t count) const
+    {
+        // One virtual call for all points, the projection is inlined
+        return m_proj.forward_n(lon, lat, x, y, count);
+    }
+
     virtual void fwd(LL_T& lp_lon, LL_T& lp_lat, XY_T& xy_x, XY_T& xy_y) const
     {
         m_proj.fwd(lp_lon, lp_lat, xy_x, xy_y);
@@ -53,6 +60,7 @@ public:
         // exception?
         return false;
     }
+
     virtual void inv(XY_T& , XY_T& , LL_T& , LL_T& ) const
     {
         // exception?
@@ -86,6 +94,12 @@ public :
         return this->m_proj.inverse(xy, ll);
     }
 
+    virtual bool inverse_n(XY_T const* x, XY_T const* y,
+                           LL_T* lon, LL_T* lat, std::size_t count) const
+    {
+        return this->m_proj.inverse_n(x, y, lon, lat, count);
+    }
+
     void inv(XY_T& xy_x, XY_T& xy_y, LL_T& lp_lon, LL_T& lp_lat) const
     {
         this->m_proj.inv(xy_x, xy_y, lp_lon, lp_lat);
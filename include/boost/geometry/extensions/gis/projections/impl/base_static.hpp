@@ -15,8 +15,12 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+
 #include <boost/geometry/extensions/gis/projections/impl/pj_fwd.hpp>
 #include <boost/geometry/extensions/gis/projections/impl/pj_inv.hpp>
 
@@ -28,10 +32,29 @@ namespace boost { namespace geometry { namespace projections
 namespace detail
 {
 
+// Factor converting the angles of LL to radians (1 if LL is in radians)
+template <typename LL>
+inline double radian_factor()
+{
+    LL unit;
+    geometry::set<0>(unit, 1);
+    return geometry::get_as_radian<0>(unit);
+}
+
 // Base-template-forward
 template <typename Prj, typename LL, typename XY, typename P>
 struct base_t_f
 {
+protected:
+
+    // Some projections do not work with float -> wrong results
+    // TODO: make traits which select <double> from int/float/double and else selects T
+
+    //typedef typename geometry::coordinate_type<LL>::type LL_T;
+    //typedef typename geometry::coordinate_type<XY>::type XY_T;
+    typedef double LL_T;
+    typedef double XY_T;
+
 public:
 
     typedef LL geographic_point_type; ///< latlong point type
@@ -58,6 +81,41 @@ public:
         }
     }
 
+    inline bool forward_n(LL_T const* lon, LL_T const* lat,
+                          XY_T* x, XY_T* y, std::size_t count) const
+    {
+        return pj_fwd_n(m_prj, m_par, radian_factor<LL>(),
+                        lon, lat, x, y, count) == 0;
+    }
+
+    // Projects n (at most BATCH_SIZE) points, prepared by pj_fwd_n, and sets
+    // error to 1 for points which cannot be projected. This calls fwd per
+    // point. Projections can hide it by a branch free version, which can
+    // be vectorized by the compiler
+    inline void fwd_n(LL_T const* lp_lon, LL_T const* lp_lat,
+                      XY_T* xy_x, XY_T* xy_y, LL_T* error,
+                      std::size_t n) const
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            xy_x[i] = 0;
+            xy_y[i] = 0;
+            if (error[i] == 0)
+            {
+                LL_T lon = lp_lon[i];
+                LL_T lat = lp_lat[i];
+                try
+                {
+                    m_prj.fwd(lon, lat, xy_x[i], xy_y[i]);
+                }
+                catch(...)
+                {
+                    error[i] = 1;
+                }
+            }
+        }
+    }
+
     inline std::string name() const
     {
         return this->m_par.name;
@@ -65,14 +123,6 @@ public:
 
 protected:
 
-    // Some projections do not work with float -> wrong results
-    // TODO: make traits which select <double> from int/float/double and else selects T
-
-    //typedef typename geometry::coordinate_type<LL>::type LL_T;
-    //typedef typename geometry::coordinate_type<XY>::type XY_T;
-    typedef double LL_T;
-    typedef double XY_T;
-
     P m_par;
     const Prj& m_prj;
 };
@@ -81,6 +131,10 @@ protected:
 template <typename Prj, typename LL, typename XY, typename P>
 struct base_t_fi : public base_t_f<Prj, LL, XY, P>
 {
+protected :
+    typedef typename base_t_f<Prj, LL, XY, P>::LL_T LL_T;
+    typedef typename base_t_f<Prj, LL, XY, P>::XY_T XY_T;
+
 public :
     inline base_t_fi(Prj const& prj, P const& params)
         : base_t_f<Prj, LL, XY, P>(prj, params)
@@ -98,6 +152,35 @@ public :
             return false;
         }
     }
+
+    inline bool inverse_n(XY_T const* x, XY_T const* y,
+                          LL_T* lon, LL_T* lat, std::size_t count) const
+    {
+        return pj_inv_n(this->m_prj, this->m_par, 1.0 / radian_factor<LL>(),
+                        x, y, lon, lat, count) == 0;
+    }
+
+    // Inverse of n (at most BATCH_SIZE) points, see fwd_n
+    inline void inv_n(XY_T const* xy_x, XY_T const* xy_y,
+                      LL_T* lp_lon, LL_T* lp_lat, LL_T* error,
+                      std::size_t n) const
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            lp_lon[i] = 0;
+            lp_lat[i] = 0;
+            XY_T x = xy_x[i];
+            XY_T y = xy_y[i];
+            try
+            {
+                this->m_prj.inv(x, y, lp_lon[i], lp_lat[i]);
+            }
+            catch(...)
+            {
+                error[i] = 1;
+            }
+        }
+    }
 };
 
 } // namespace detail
@@ -35,6 +35,10 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -93,6 +97,84 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
     geometry::set<1>(xy, par.fr_meter * (par.a * y + par.y0));
 }
 
+/* forward projection entry for count points, in separate arrays */
+/* angles are multiplied by to_radian, points are projected per block of */
+/* BATCH_SIZE by prj.fwd_n, failed points get HUGE_VAL */
+/* returns the number of failed points */
+template <typename Prj, typename P, typename LL_T, typename XY_T>
+inline std::size_t pj_fwd_n(Prj const& prj, P const& par, double to_radian,
+                            LL_T const* lon, LL_T const* lat,
+                            XY_T* x, XY_T* y, std::size_t count)
+{
+    static const double half_pi = geometry::math::half_pi<double>();
+    static const double pi = boost::math::constants::pi<double>();
+    static const double two_pi = boost::math::constants::two_pi<double>();
+
+    LL_T lp_lon[BATCH_SIZE];
+    LL_T lp_lat[BATCH_SIZE];
+    LL_T error[BATCH_SIZE];
+
+    std::size_t failed = 0;
+    for (std::size_t first = 0; first < count; first += BATCH_SIZE)
+    {
+        std::size_t const n = (std::min)(BATCH_SIZE, count - first);
+        XY_T* const xy_x = x + first;
+        XY_T* const xy_y = y + first;
+
+        /* the checks of pj_fwd, branch free: failed points continue as 0 */
+        for (std::size_t i = 0; i < n; i++)
+        {
+            double const lo = lon[first + i] * to_radian;
+            double const la = lat[first + i] * to_radian;
+            double const t = geometry::math::abs(la) - half_pi;
+            double const e = t > forwrd::EPS || geometry::math::abs(lo) > 10. ? 1. : 0.;
+            double const pole = la < 0. ? -half_pi : half_pi;
+            error[i] = e;
+            lp_lon[i] = e != 0. ? 0. : lo;
+            lp_lat[i] = e != 0. ? 0. : geometry::math::abs(t) <= forwrd::EPS ? pole : la;
+        }
+
+        if (par.geoc)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                double const la = lp_lat[i];
+                double const geoc = atan(par.rone_es * tan(la));
+                lp_lat[i] = geometry::math::abs(geometry::math::abs(la) - half_pi) <= forwrd::EPS ? la : geoc;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            lp_lon[i] -= par.lam0;
+        }
+
+        if (! par.over)
+        {
+            /* adjlon, branch free */
+            for (std::size_t i = 0; i < n; i++)
+            {
+                double const lo = lp_lon[i];
+                double adjusted = lo + pi;
+                adjusted -= two_pi * std::floor(adjusted / two_pi);
+                adjusted -= pi;
+                lp_lon[i] = geometry::math::abs(lo) <= pi ? lo : adjusted;
+            }
+        }
+
+        prj.fwd_n(lp_lon, lp_lat, xy_x, xy_y, error, n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            double const e = error[i];
+            xy_x[i] = e != 0. ? HUGE_VAL : par.fr_meter * (par.a * xy_x[i] + par.x0);
+            xy_y[i] = e != 0. ? HUGE_VAL : par.fr_meter * (par.a * xy_y[i] + par.y0);
+            failed += e != 0. ? 1 : 0;
+        }
+    }
+    return failed;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -35,9 +35,12 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_PJ_INV_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_PJ_INV_HPP
 
-
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 
 #include <boost/geometry/extensions/gis/projections/impl/adjlon.hpp>
+#include <boost/geometry/extensions/gis/projections/impl/projects.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -74,6 +77,79 @@ inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
     geometry::set_from_radian<1>(ll, lat);
 }
 
+/* inverse projection entry for count points, in separate arrays */
+/* points are projected per block of BATCH_SIZE by prj.inv_n, resulting */
+/* angles are multiplied by from_radian, failed points get HUGE_VAL */
+/* returns the number of failed points */
+template <typename PRJ, typename PAR, typename XY_T, typename LL_T>
+inline std::size_t pj_inv_n(PRJ const& prj, PAR const& par, double from_radian,
+                            XY_T const* x, XY_T const* y,
+                            LL_T* lon, LL_T* lat, std::size_t count)
+{
+    static const double half_pi = geometry::math::half_pi<double>();
+    static const double pi = boost::math::constants::pi<double>();
+    static const double two_pi = boost::math::constants::two_pi<double>();
+
+    XY_T xy_x[BATCH_SIZE];
+    XY_T xy_y[BATCH_SIZE];
+    LL_T error[BATCH_SIZE];
+
+    std::size_t failed = 0;
+    for (std::size_t first = 0; first < count; first += BATCH_SIZE)
+    {
+        std::size_t const n = (std::min)(BATCH_SIZE, count - first);
+        LL_T* const lp_lon = lon + first;
+        LL_T* const lp_lat = lat + first;
+
+        /* descale and de-offset */
+        for (std::size_t i = 0; i < n; i++)
+        {
+            xy_x[i] = (x[first + i] * par.to_meter - par.x0) * par.ra;
+            xy_y[i] = (y[first + i] * par.to_meter - par.y0) * par.ra;
+            error[i] = 0.;
+        }
+
+        prj.inv_n(xy_x, xy_y, lp_lon, lp_lat, error, n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            lp_lon[i] += par.lam0;
+        }
+
+        if (! par.over)
+        {
+            /* adjlon, branch free */
+            for (std::size_t i = 0; i < n; i++)
+            {
+                double const lo = lp_lon[i];
+                double adjusted = lo + pi;
+                adjusted -= two_pi * std::floor(adjusted / two_pi);
+                adjusted -= pi;
+                lp_lon[i] = geometry::math::abs(lo) <= pi ? lo : adjusted;
+            }
+        }
+
+        if (par.geoc)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                double const la = lp_lat[i];
+                double const geoc = atan(par.one_es * tan(la));
+                lp_lat[i] = geometry::math::abs(geometry::math::abs(la) - half_pi) > inv::EPS ? geoc : la;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            double const e = error[i];
+            lp_lon[i] = e != 0. ? HUGE_VAL : lp_lon[i] * from_radian;
+            lp_lat[i] = e != 0. ? HUGE_VAL : lp_lat[i] * from_radian;
+            failed += e != 0. ? 1 : 0;
+        }
+    }
+    return failed;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -35,6 +35,7 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PROJECTS_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PROJECTS_HPP
 
+#include <cstddef>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -51,6 +52,9 @@ namespace detail
 /* some useful constants */
 static const double FORTPI = boost::math::constants::pi<double>() / 4.0;
 
+/* number of points projected per block by forward_n / inverse_n */
+static const std::size_t BATCH_SIZE = 256;
+
 static const int PJD_UNKNOWN =0;
 static const int PJD_3PARAM = 1;
 static const int PJD_7PARAM = 2;
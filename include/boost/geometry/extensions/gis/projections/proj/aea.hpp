@@ -161,6 +161,24 @@ namespace boost { namespace geometry { namespace projections
                     }
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    double rho[BATCH_SIZE], lam[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const sinphi = sin(lp_lat[i]);
+                        double const r = this->m_proj_parm.c - (this->m_proj_parm.ellips ? this->m_proj_parm.n * pj_qsfn(sinphi,
+                            this->m_par.e, this->m_par.one_es) : this->m_proj_parm.n2 * sinphi);
+                        error[i] = r < 0. ? 1. : error[i];
+                        rho[i] = this->m_proj_parm.dd * sqrt(r < 0. ? 0. : r);
+                        lam[i] = lp_lon[i] * this->m_proj_parm.n;
+                    }
+                    for (std::size_t i = 0; i < n; i++)
+                        xy_x[i] = rho[i] * sin(lam[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        xy_y[i] = this->m_proj_parm.rho0 - rho[i] * cos(lam[i]);
+                }
+
                 static inline std::string get_name()
                 {
                     return "aea_ellipsoid";
@@ -198,6 +198,34 @@ namespace boost { namespace geometry { namespace projections
                         xy_x = xy_y = HUGE_VAL;
                 }
 
+                // Version of fwd for n points, see base_t_f::fwd_n
+                // (sin and cos in separate loops, they are not vectorized together)
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* , std::size_t n) const
+                {
+                    double Cn[BATCH_SIZE], sin_Cn[BATCH_SIZE], cos_Cn[BATCH_SIZE], sin_Ce[BATCH_SIZE], cos_Ce[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        Cn[i] = gatg(this->m_proj_parm.cbg, PROJ_ETMERC_ORDER, lp_lat[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        sin_Cn[i] = sin(Cn[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        cos_Cn[i] = cos(Cn[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        sin_Ce[i] = sin(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        cos_Ce[i] = cos(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++) {
+                        double dCn, dCe;
+                        double cn = atan2(sin_Cn[i], cos_Ce[i]*cos_Cn[i]);
+                        double ce = atan2(sin_Ce[i]*cos_Cn[i], boost::math::hypot(sin_Cn[i], cos_Cn[i]*cos_Ce[i]));
+                        ce  = asinhy(tan(ce));
+                        cn += clenS(this->m_proj_parm.gtu, PROJ_ETMERC_ORDER, 2*cn, 2*ce, &dCn, &dCe);
+                        ce += dCe;
+                        bool const valid = fabs(ce) <= 2.623395162778;
+                        xy_y[i] = valid ? this->m_proj_parm.Qn * cn + this->m_proj_parm.Zb : HUGE_VAL;
+                        xy_x[i] = valid ? this->m_proj_parm.Qn * ce : HUGE_VAL;
+                    }
+                }
+
                 // INVERSE(e_inverse)  ellipsoid
                 // Project coordinates from cartesian (x, y) to geographic (lon, lat)
                 inline void inv(cartesian_type& xy_x, cartesian_type& xy_y, geographic_type& lp_lon, geographic_type& lp_lat) const
@@ -187,6 +187,47 @@ namespace boost { namespace geometry { namespace projections
                     lp_lat = pj_authlat(asin(ab), this->m_proj_parm.apa);
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    double coslam[BATCH_SIZE], sinlam[BATCH_SIZE], q[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        coslam[i] = cos(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        sinlam[i] = sin(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        q[i] = pj_qsfn(sin(lp_lat[i]), this->m_par.e, this->m_par.one_es);
+
+                    int const mode = this->m_proj_parm.mode;
+                    if (mode == N_POLE || mode == S_POLE) {
+                        double const sign = mode == S_POLE ? 1. : -1.;
+                        for (std::size_t i = 0; i < n; i++) {
+                            double const b = lp_lat[i] - sign * geometry::math::half_pi<double>();
+                            double const qq = this->m_proj_parm.qp + sign * q[i];
+                            double const rho = sqrt(qq >= 0. ? qq : 0.);
+                            error[i] = fabs(b) < EPS10 ? 1. : error[i];
+                            xy_x[i] = qq >= 0. ? rho * sinlam[i] : 0.;
+                            xy_y[i] = qq >= 0. ? coslam[i] * (sign * rho) : 0.;
+                        }
+                        return;
+                    }
+
+                    bool const obliq = mode == OBLIQ;
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const sinb = q[i] / this->m_proj_parm.qp;
+                        double const cosb = sqrt(1. - sinb * sinb);
+                        double const b = obliq
+                            ? 1. + this->m_proj_parm.sinb1 * sinb + this->m_proj_parm.cosb1 * cosb * coslam[i]
+                            : 1. + cosb * coslam[i];
+                        double const r = sqrt(2. / (fabs(b) < EPS10 ? 1. : b));
+                        error[i] = fabs(b) < EPS10 ? 1. : error[i];
+                        xy_y[i] = obliq
+                            ? this->m_proj_parm.ymf * r * (this->m_proj_parm.cosb1 * sinb - this->m_proj_parm.sinb1 * cosb * coslam[i])
+                            : r * sinb * this->m_proj_parm.ymf;
+                        xy_x[i] = this->m_proj_parm.xmf * r * cosb * sinlam[i];
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "laea_ellipsoid";
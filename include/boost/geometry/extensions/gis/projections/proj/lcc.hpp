@@ -143,6 +143,25 @@ namespace boost { namespace geometry { namespace projections
                 }
                 #endif
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    double rho[BATCH_SIZE], lam[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const phi = lp_lat[i];
+                        double const r = this->m_proj_parm.c * (this->m_proj_parm.ellips ? pow(pj_tsfn(phi, sin(phi),
+                            this->m_par.e), this->m_proj_parm.n) : pow(tan(FORTPI + .5 * phi), -this->m_proj_parm.n));
+                        bool const pole = fabs(fabs(phi) - geometry::math::half_pi<double>()) < EPS10;
+                        error[i] = pole && (phi * this->m_proj_parm.n) <= 0. ? 1. : error[i];
+                        rho[i] = pole ? 0. : r;
+                        lam[i] = lp_lon[i] * this->m_proj_parm.n;
+                    }
+                    for (std::size_t i = 0; i < n; i++)
+                        xy_x[i] = this->m_par.k0 * (rho[i] * sin(lam[i]));
+                    for (std::size_t i = 0; i < n; i++)
+                        xy_y[i] = this->m_par.k0 * (this->m_proj_parm.rho0 - rho[i] * cos(lam[i]));
+                }
+
                 static inline std::string get_name()
                 {
                     return "lcc_ellipsoid";
@@ -86,6 +86,20 @@ namespace boost { namespace geometry { namespace projections
                     lp_lon = xy_x / this->m_par.k0;
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    double sinphi[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        sinphi[i] = sin(lp_lat[i]);
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const phi = lp_lat[i];
+                        error[i] = fabs(fabs(phi) - geometry::math::half_pi<double>()) <= EPS10 ? 1. : error[i];
+                        xy_x[i] = this->m_par.k0 * lp_lon[i];
+                        xy_y[i] = - this->m_par.k0 * log(pj_tsfn(phi, sinphi[i], this->m_par.e));
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "merc_ellipsoid";
@@ -124,6 +138,26 @@ namespace boost { namespace geometry { namespace projections
                     lp_lon = xy_x / this->m_par.k0;
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const phi = lp_lat[i];
+                        error[i] = fabs(fabs(phi) - geometry::math::half_pi<double>()) <= EPS10 ? 1. : error[i];
+                        xy_x[i] = this->m_par.k0 * lp_lon[i];
+                        xy_y[i] = this->m_par.k0 * log(tan(FORTPI + .5 * phi));
+                    }
+                }
+
+                // Branch free version of inv for n points, see base_t_fi::inv_n
+                inline void inv_n(cartesian_type const* xy_x, cartesian_type const* xy_y, geographic_type* lp_lon, geographic_type* lp_lat, geographic_type* , std::size_t n) const
+                {
+                    for (std::size_t i = 0; i < n; i++) {
+                        lp_lat[i] = geometry::math::half_pi<double>() - 2. * atan(exp(-xy_y[i] / this->m_par.k0));
+                        lp_lon[i] = xy_x[i] / this->m_par.k0;
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "merc_spheroid";
@@ -175,6 +175,49 @@ namespace boost { namespace geometry { namespace projections
                     throw proj_exception();;
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* , std::size_t n) const
+                {
+                    double coslam[BATCH_SIZE], sinlam[BATCH_SIZE], sinphi[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        coslam[i] = cos(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        sinlam[i] = sin(lp_lon[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        sinphi[i] = sin(lp_lat[i]);
+
+                    int const mode = this->m_proj_parm.mode;
+                    if (mode == N_POLE || mode == S_POLE) {
+                        double const sign = mode == S_POLE ? -1. : 1.;
+                        for (std::size_t i = 0; i < n; i++) {
+                            double const x = this->m_proj_parm.akm1 * pj_tsfn(sign * lp_lat[i], sign * sinphi[i], this->m_par.e);
+                            xy_y[i] = - x * (sign * coslam[i]);
+                            xy_x[i] = x * sinlam[i];
+                        }
+                        return;
+                    }
+
+                    double X[BATCH_SIZE], sinX[BATCH_SIZE], cosX[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        X[i] = 2. * atan(ssfn_(lp_lat[i], sinphi[i], this->m_par.e)) - geometry::math::half_pi<double>();
+                    for (std::size_t i = 0; i < n; i++)
+                        sinX[i] = sin(X[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        cosX[i] = cos(X[i]);
+
+                    bool const obliq = mode == OBLIQ;
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const A = obliq
+                            ? this->m_proj_parm.akm1 / (this->m_proj_parm.cosX1 * (1. + this->m_proj_parm.sinX1 * sinX[i] +
+                               this->m_proj_parm.cosX1 * cosX[i] * coslam[i]))
+                            : 2. * this->m_proj_parm.akm1 / (1. + cosX[i] * coslam[i]);
+                        xy_y[i] = obliq
+                            ? A * (this->m_proj_parm.cosX1 * sinX[i] - this->m_proj_parm.sinX1 * cosX[i] * coslam[i])
+                            : A * sinX[i];
+                        xy_x[i] = A * cosX[i] * sinlam[i];
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "stere_ellipsoid";
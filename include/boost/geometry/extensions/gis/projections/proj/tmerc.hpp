@@ -160,6 +160,43 @@ namespace boost { namespace geometry { namespace projections
                     }
                 }
 
+                // Branch free version of fwd for n points, see base_t_f::fwd_n
+                // (sin and cos in separate loops, they are not vectorized together)
+                inline void fwd_n(geographic_type const* lp_lon, geographic_type const* lp_lat, cartesian_type* xy_x, cartesian_type* xy_y, geographic_type* error, std::size_t n) const
+                {
+                    double sinphi[BATCH_SIZE], cosphi[BATCH_SIZE];
+                    for (std::size_t i = 0; i < n; i++)
+                        sinphi[i] = sin(lp_lat[i]);
+                    for (std::size_t i = 0; i < n; i++)
+                        cosphi[i] = cos(lp_lat[i]);
+                    for (std::size_t i = 0; i < n; i++) {
+                        double const lam = lp_lon[i];
+                        double const sp = sinphi[i];
+                        double const cp = cosphi[i];
+                        double al, als, n_, t;
+
+                        error[i] = lam < -geometry::math::half_pi<double>() || lam > geometry::math::half_pi<double>() ? 1. : error[i];
+
+                        t = fabs(cp) > 1e-10 ? sp/cp : 0.;
+                        t *= t;
+                        al = cp * lam;
+                        als = al * al;
+                        al /= sqrt(1. - this->m_par.es * sp * sp);
+                        n_ = this->m_proj_parm.esp * cp * cp;
+                        xy_x[i] = this->m_par.k0 * al * (FC1 +
+                            FC3 * als * (1. - t + n_ +
+                            FC5 * als * (5. + t * (t - 18.) + n_ * (14. - 58. * t)
+                            + FC7 * als * (61. + t * ( t * (179. - t) - 479. ) )
+                            )));
+                        xy_y[i] = this->m_par.k0 * (pj_mlfn(lp_lat[i], sp, cp, this->m_proj_parm.en) - this->m_proj_parm.ml0 +
+                            sp * al * lam * FC2 * ( 1. +
+                            FC4 * als * (5. - t + n_ * (9. + 4. * n_) +
+                            FC6 * als * (61. + t * (t - 58.) + n_ * (270. - 330 * t)
+                            + FC8 * als * (1385. + t * ( t * (543. - t) - 3111.) )
+                            ))));
+                    }
+                }
+
                 static inline std::string get_name()
                 {
                     return "tmerc_ellipsoid";
@@ -10,10 +10,16 @@
 #define BOOST_GEOMETRY_STRATEGY_PROJECT_TRANSFORMER_HPP
 
 
+#include <cstddef>
+
+#include <boost/range.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/extensions/gis/projections/impl/projects.hpp>
 #include <boost/geometry/extensions/gis/projections/factory.hpp>
 #include <boost/geometry/extensions/gis/projections/parameters.hpp>
 
@@ -62,4 +68,82 @@ struct project_transformer
 }}} // namespace boost::geometry::projections
 
 
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace transform
+{
+
+// Projects the points of a range per block, with one (virtual) call
+// of forward_n per block instead of one call of forward per point
+template <typename LatLong, typename Cartesian>
+struct transform_points<projections::project_transformer<LatLong, Cartesian> >
+{
+    typedef projections::project_transformer<LatLong, Cartesian> strategy_type;
+
+    template <typename PointOut, typename Range, typename OutputIterator>
+    static inline bool apply(Range const& range,
+        OutputIterator out, strategy_type const& strategy)
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        typedef projections::projection<LatLong, Cartesian> projection_type;
+        typedef typename projection_type::LL_T ll_type;
+        typedef typename projection_type::XY_T xy_type;
+
+        static const std::size_t block_size = projections::detail::BATCH_SIZE;
+        ll_type lon[block_size], lat[block_size];
+        xy_type x[block_size], y[block_size];
+
+        iterator_type it = boost::begin(range);
+        iterator_type const end = boost::end(range);
+        while (it != end)
+        {
+            iterator_type const first = it;
+            std::size_t count = 0;
+            for ( ; it != end && count < block_size; ++it, ++count)
+            {
+                lon[count] = geometry::get<0>(*it);
+                lat[count] = geometry::get<1>(*it);
+            }
+
+            PointOut point_out;
+            if (! strategy.m_prj->forward_n(lon, lat, x, y, count))
+            {
+                // Redo this block point by point, to stop at the same point
+                for (iterator_type pit = first; pit != it; ++pit)
+                {
+                    if (! transform_point::apply(*pit, point_out, strategy))
+                    {
+                        return false;
+                    }
+                    *out++ = point_out;
+                }
+                continue;
+            }
+
+            iterator_type pit = first;
+            for (std::size_t i = 0; i < count; ++i, ++pit)
+            {
+                // Copy third or higher dimensions, as in apply
+                geometry::detail::conversion::point_to_point<point_type,
+                        PointOut, 2, geometry::dimension<PointOut>::value>
+                    ::apply(*pit, point_out);
+                geometry::set<0>(point_out, x[i]);
+                geometry::set<1>(point_out, y[i]);
+                *out++ = point_out;
+            }
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::transform
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
 #endif // BOOST_GEOMETRY_STRATEGY_PROJECT_TRANSFORMER_HPP
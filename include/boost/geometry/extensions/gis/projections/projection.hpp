@@ -10,7 +10,11 @@
 #define BOOST_GEOMETRY_PROJECTIONS_PROJECTION_HPP
 
 
+#include <cmath>
+#include <cstddef>
 #include <string>
+
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/extensions/gis/projections/impl/projects.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -27,14 +31,12 @@ namespace boost { namespace geometry { namespace projections
 template <typename LL, typename XY>
 class projection
 {
-    protected :
+    public :
         // see comment above
         //typedef typename geometry::coordinate_type<LL>::type LL_T;
         //typedef typename geometry::coordinate_type<XY>::type XY_T;
-        typedef double LL_T;
-        typedef double XY_T;
-
-    public :
+        typedef double LL_T; ///< coordinate type of lon / lat arrays
+        typedef double XY_T; ///< coordinate type of x / y arrays
 
         typedef LL geographic_point_type; ///< latlong point type
         typedef XY cartesian_point_type;  ///< xy point type
@@ -45,6 +47,48 @@ class projection
         /// Inverse projection, from Cartesian to Latitude-Longitude
         virtual bool inverse(XY const& xy, LL& lp) const = 0;
 
+        /// Forward projection of count points, from separate arrays of
+        /// longitudes / latitudes (in the units of LL) to arrays of x / y.
+        /// Points which cannot be projected get HUGE_VAL. Returns false
+        /// if any of the points could not be projected
+        virtual bool forward_n(LL_T const* lon, LL_T const* lat,
+                               XY_T* x, XY_T* y, std::size_t count) const
+        {
+            bool result = true;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                LL lp;
+                XY xy;
+                geometry::set<0>(lp, lon[i]);
+                geometry::set<1>(lp, lat[i]);
+                bool const projected = forward(lp, xy);
+                x[i] = projected ? geometry::get<0>(xy) : HUGE_VAL;
+                y[i] = projected ? geometry::get<1>(xy) : HUGE_VAL;
+                result = result && projected;
+            }
+            return result;
+        }
+
+        /// Inverse projection of count points, from separate arrays of
+        /// x / y to arrays of longitudes / latitudes (in the units of LL)
+        virtual bool inverse_n(XY_T const* x, XY_T const* y,
+                               LL_T* lon, LL_T* lat, std::size_t count) const
+        {
+            bool result = true;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                XY xy;
+                LL lp;
+                geometry::set<0>(xy, x[i]);
+                geometry::set<1>(xy, y[i]);
+                bool const projected = inverse(xy, lp);
+                lon[i] = projected ? geometry::get<0>(lp) : HUGE_VAL;
+                lat[i] = projected ? geometry::get<1>(lp) : HUGE_VAL;
+                result = result && projected;
+            }
+            return result;
+        }
+
         /// Forward projection using lon / lat and x / y separately
         virtual void fwd(LL_T& lp_lon, LL_T& lp_lat, XY_T& xy_x, XY_T& xy_y) const = 0;
 
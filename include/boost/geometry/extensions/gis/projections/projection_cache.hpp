@@ -0,0 +1,247 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_PROJECTIONS_PROJECTION_CACHE_HPP
+#define BOOST_GEOMETRY_PROJECTIONS_PROJECTION_CACHE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/config.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <boost/geometry/extensions/gis/projections/epsg.hpp>
+#include <boost/geometry/extensions/gis/projections/factory.hpp>
+#include <boost/geometry/extensions/gis/projections/parameters.hpp>
+#include <boost/geometry/extensions/gis/projections/projection.hpp>
+
+// Define BOOST_GEOMETRY_NO_THREADS to use the cache without locking
+#if ! defined(BOOST_NO_CXX11_HDR_MUTEX) && ! defined(BOOST_GEOMETRY_NO_THREADS)
+#define BOOST_GEOMETRY_PROJECTION_CACHE_USE_MUTEX
+#include <mutex>
+#endif
+
+
+namespace boost { namespace geometry { namespace projections
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+struct parameter_name_less
+{
+    static inline std::string name(std::string const& argument)
+    {
+        return argument.substr(0, argument.find('='));
+    }
+
+    inline bool operator()(std::string const& left, std::string const& right) const
+    {
+        return name(left) < name(right);
+    }
+};
+
+/*!
+\brief Normalizes a projection definition, such as "+proj=utm +zone=11",
+    to compare it with other definitions
+\details Arguments are split as in pj_init_plus, trimmed and sorted by name.
+    Arguments with the same name keep their order, because pj_param uses
+    the first one.
+*/
+inline std::string normalize_definition(std::string const& definition)
+{
+    static const char* sep = " +";
+
+    std::vector<std::string> arguments;
+    std::string def = boost::trim_copy(definition);
+    boost::trim_left_if(def, boost::is_any_of(sep));
+
+    std::string::size_type loc = def.find(sep);
+    while (loc != std::string::npos)
+    {
+        std::string par = def.substr(0, loc);
+        boost::trim(par);
+        if (! par.empty())
+        {
+            arguments.push_back(par);
+        }
+
+        def.erase(0, loc);
+        boost::trim_left_if(def, boost::is_any_of(sep));
+        loc = def.find(sep);
+    }
+
+    if (! def.empty())
+    {
+        arguments.push_back(def);
+    }
+
+    std::stable_sort(arguments.begin(), arguments.end(), parameter_name_less());
+
+    std::string result;
+    for (std::vector<std::string>::const_iterator it = arguments.begin();
+        it != arguments.end(); ++it)
+    {
+        if (! result.empty())
+        {
+            result += " ";
+        }
+        result += "+";
+        result += *it;
+    }
+    return result;
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Thread safe cache of projections, keyed by their definition
+\details Creating a projection parses its definition and initializes its
+    parameters. The cache does that once per definition, and returns the
+    same projection for each following request. Definitions are compared
+    after normalization, so "+proj=merc +ellps=WGS84" and
+    "+ellps=WGS84  +proj=merc" share the projection.
+    Projections are immutable, their forward and inverse methods can be
+    called from several threads at the same time.
+\ingroup projection
+\tparam LatLong latlong point type
+\tparam Cartesian xy point type
+\tparam Parameters parameter type, normally not specified
+*/
+template <typename LatLong, typename Cartesian, typename Parameters = parameters>
+class projection_cache : boost::noncopyable
+{
+public :
+
+    typedef projection<LatLong, Cartesian> projection_type;
+    typedef boost::shared_ptr<projection_type const> pointer_type;
+
+    projection_cache()
+        : m_hits(0)
+        , m_misses(0)
+    {}
+
+    /// Returns the projection of a definition, such as "+proj=utm +zone=11",
+    /// or an empty pointer if the projection is unknown.
+    /// Throws proj_exception for invalid parameters
+    inline pointer_type get(std::string const& definition)
+    {
+        return get(detail::normalize_definition(definition), definition, true);
+    }
+
+    /// Returns the projection of an EPSG code, or an empty pointer if the
+    /// code or the projection is unknown
+    inline pointer_type get(int epsg_code)
+    {
+        std::string const definition = detail::code_to_string(epsg_code);
+        if (definition.empty())
+        {
+            return pointer_type();
+        }
+        // As projections::init(epsg_code), without defaults, which can give
+        // another projection than the same definition as a string
+        return get("+init=epsg:" + boost::lexical_cast<std::string>(epsg_code),
+                   definition, false);
+    }
+
+    /// Number of requests for which the projection was in the cache
+    inline std::size_t hits() const
+    {
+        lock_type lock(m_mutex);
+        return m_hits;
+    }
+
+    /// Number of requests for which the projection was created
+    inline std::size_t misses() const
+    {
+        lock_type lock(m_mutex);
+        return m_misses;
+    }
+
+    /// Number of projections in the cache
+    inline std::size_t size() const
+    {
+        lock_type lock(m_mutex);
+        return m_cache.size();
+    }
+
+    /// Removes all projections (projections in use stay valid),
+    /// and resets the statistics
+    inline void clear()
+    {
+        lock_type lock(m_mutex);
+        m_cache.clear();
+        m_hits = 0;
+        m_misses = 0;
+    }
+
+private :
+
+    typedef std::map<std::string, pointer_type> cache_type;
+
+#ifdef BOOST_GEOMETRY_PROJECTION_CACHE_USE_MUTEX
+    typedef std::mutex mutex_type;
+    typedef std::lock_guard<std::mutex> lock_type;
+#else
+    struct mutex_type {};
+    struct lock_type
+    {
+        explicit lock_type(mutex_type&) {}
+    };
+#endif
+
+    pointer_type get(std::string const& key, std::string const& definition,
+                     bool use_defaults)
+    {
+        {
+            lock_type lock(m_mutex);
+            typename cache_type::const_iterator it = m_cache.find(key);
+            if (it != m_cache.end())
+            {
+                m_hits++;
+                return it->second;
+            }
+            m_misses++;
+        }
+
+        // Create without locking, other threads can use the cache meanwhile.
+        // The factory is not modified by create_new
+        Parameters const par = detail::pj_init_plus(definition, use_defaults);
+        pointer_type created(m_factory.create_new(par));
+        if (! created)
+        {
+            return created;
+        }
+
+        lock_type lock(m_mutex);
+        // If another thread created it meanwhile, use that one
+        return m_cache.insert(std::make_pair(key, created)).first->second;
+    }
+
+    factory<LatLong, Cartesian, Parameters> m_factory;
+    cache_type m_cache;
+    std::size_t m_hits;
+    std::size_t m_misses;
+    mutable mutex_type m_mutex;
+};
+
+
+}}} // namespace boost::geometry::projections
+
+
+#endif // BOOST_GEOMETRY_PROJECTIONS_PROJECTION_CACHE_HPP
@@ -0,0 +1,194 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_UTIL_PARALLEL_FOR_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_UTIL_PARALLEL_FOR_HPP
+
+
+#include <cstddef>
+
+#include <boost/config.hpp>
+
+// Define BOOST_GEOMETRY_NO_THREADS to force serial execution
+#if ! defined(BOOST_NO_CXX11_HDR_THREAD) \
+ && ! defined(BOOST_NO_CXX11_HDR_ATOMIC) \
+ && ! defined(BOOST_NO_CXX11_HDR_EXCEPTION) \
+ && ! defined(BOOST_GEOMETRY_NO_THREADS)
+#define BOOST_GEOMETRY_USE_THREADS
+#endif
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+
+/*!
+\brief Returns the number of threads used if the caller specifies 0
+*/
+inline std::size_t default_thread_count()
+{
+#ifdef BOOST_GEOMETRY_USE_THREADS
+    unsigned int const n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+#else
+    return 1;
+#endif
+}
+
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+template <typename Function>
+struct for_each_index_worker
+{
+    Function const& function;
+    std::size_t count;
+    std::size_t chunk_size;
+    std::atomic<std::size_t>& next;
+    std::exception_ptr& error;
+    std::mutex& error_mutex;
+
+    void operator()() const
+    {
+        try
+        {
+            for (;;)
+            {
+                std::size_t const first = next.fetch_add(chunk_size);
+                if (first >= count)
+                {
+                    return;
+                }
+                std::size_t const last = first + chunk_size < count
+                                       ? first + chunk_size : count;
+                for (std::size_t i = first; i < last; i++)
+                {
+                    function(i);
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (! error)
+            {
+                error = std::current_exception();
+            }
+            // Let the other workers stop as soon as possible
+            next.store(count);
+        }
+    }
+};
+#endif
+
+
+/*!
+\brief Calls function(i) for all i in [0, count), distributing
+    chunks of indices over a number of threads
+\details The function should be thread-safe for different indices.
+    Chunks are handed out dynamically, so uneven work per index is
+    balanced. If the function throws, the first exception is rethrown
+    in the calling thread after all workers are finished. Without
+    thread support the indices are processed serially, in order.
+\param count number of indices
+\param function function object called with each index
+\param thread_count number of threads, 0 means the hardware concurrency
+\param chunk_size number of consecutive indices handed out at once
+*/
+template <typename Function>
+inline void for_each_index(std::size_t count, Function const& function,
+                           std::size_t thread_count = 0,
+                           std::size_t chunk_size = 16)
+{
+    if (thread_count == 0)
+    {
+        thread_count = default_thread_count();
+    }
+    if (chunk_size == 0)
+    {
+        chunk_size = 1;
+    }
+
+    std::size_t const chunks = (count + chunk_size - 1) / chunk_size;
+    if (thread_count > chunks)
+    {
+        thread_count = chunks;
+    }
+
+#ifdef BOOST_GEOMETRY_USE_THREADS
+    if (thread_count > 1)
+    {
+        std::atomic<std::size_t> next(0);
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        for_each_index_worker<Function> const worker
+            = { function, count, chunk_size, next, error, error_mutex };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        try
+        {
+            for (std::size_t t = 1; t < thread_count; t++)
+            {
+                threads.push_back(std::thread(worker));
+            }
+        }
+        catch (...)
+        {
+            // Threads which are already started must be joined before
+            // they are destroyed, let them stop as soon as possible
+            next.store(count);
+            for (std::size_t t = 0; t < threads.size(); t++)
+            {
+                threads[t].join();
+            }
+            throw;
+        }
+
+        // The calling thread participates as well
+        worker();
+
+        for (std::size_t t = 0; t < threads.size(); t++)
+        {
+            threads[t].join();
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        function(i);
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_UTIL_PARALLEL_FOR_HPP
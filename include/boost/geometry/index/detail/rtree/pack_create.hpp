@@ -11,8 +11,14 @@
 #ifndef BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 #define BOOST_GEOMETRY_INDEX_DETAIL_RTREE_PACK_CREATE_HPP
 
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/index/detail/algorithms/bounds.hpp>
+#include <boost/geometry/index/parameters.hpp>
 
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
 
@@ -90,6 +96,262 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
     static inline void apply(EIt , EIt , EIt , Box const& , Box & , Box & , std::size_t ) {}
 };
 
+// Splits the entries for two subtrees
+template <typename PackingAlgorithm>
+struct partition_entries
+{
+    // index::topdown_packing - the median is found and the box is halved along its biggest edge
+    template <typename EIt, typename Box>
+    static inline void apply(EIt first, EIt median, EIt last, Box const& box, Box & left, Box & right)
+    {
+        static const std::size_t dimension = geometry::dimension<Box>::value;
+
+        typename coordinate_type<Box>::type greatest_length;
+        std::size_t greatest_dim_index = 0;
+        biggest_edge<dimension>::apply(box, greatest_length, greatest_dim_index);
+        nth_element_and_half_boxes<0, dimension>
+            ::apply(first, median, last, box, left, right, greatest_dim_index);
+    }
+};
+
+// Curve orders - the entries are already sorted, the boxes are not used
+struct partition_sorted_entries
+{
+    template <typename EIt, typename Box>
+    static inline void apply(EIt , EIt , EIt , Box const& box, Box & left, Box & right)
+    {
+        left = box;
+        right = box;
+    }
+};
+
+template <>
+struct partition_entries<index::hilbert_packing> : partition_sorted_entries {};
+
+template <>
+struct partition_entries<index::morton_packing> : partition_sorted_entries {};
+
+// The number of bits of each coordinate of a curve key, such that the key fits in 64 bits
+template <std::size_t Dimension>
+struct curve_bits
+{
+    BOOST_STATIC_ASSERT(0 < Dimension && Dimension <= 64);
+    static const std::size_t value = 64 / Dimension < 32 ? 64 / Dimension : 32;
+};
+
+// Scales the coordinates of points in the box to integers of curve_bits bits
+template <std::size_t I, std::size_t Dimension>
+struct curve_coordinates
+{
+    template <typename Box>
+    static inline void init(Box const& box, double * mins, double * scales)
+    {
+        double const lo = boost::numeric_cast<double>(geometry::get<min_corner, I>(box));
+        double const hi = boost::numeric_cast<double>(geometry::get<max_corner, I>(box));
+        mins[I] = lo;
+        scales[I] = lo < hi ? max_coordinate() / (hi - lo) : 0.0;
+
+        curve_coordinates<I+1, Dimension>::init(box, mins, scales);
+    }
+
+    template <typename Point>
+    static inline void apply(Point const& pt, double const* mins, double const* scales, boost::uint32_t * coords)
+    {
+        double const c = (boost::numeric_cast<double>(geometry::get<I>(pt)) - mins[I]) * scales[I];
+        coords[I] = c <= 0.0 ? 0
+                  : c >= max_coordinate() ? static_cast<boost::uint32_t>(max_coordinate())
+                  : static_cast<boost::uint32_t>(c);
+
+        curve_coordinates<I+1, Dimension>::apply(pt, mins, scales, coords);
+    }
+
+    static inline double max_coordinate()
+    {
+        return static_cast<double>((boost::uint64_t(1) << curve_bits<Dimension>::value) - 1);
+    }
+};
+
+template <std::size_t Dimension>
+struct curve_coordinates<Dimension, Dimension>
+{
+    template <typename Box>
+    static inline void init(Box const& , double * , double * ) {}
+
+    template <typename Point>
+    static inline void apply(Point const& , double const* , double const* , boost::uint32_t * ) {}
+};
+
+// Interleaves the bits of the coordinates, the most significant bits first.
+// The bits of each byte are spread using a table.
+template <std::size_t Dimension>
+class interleave_table
+{
+public:
+    inline interleave_table()
+    {
+        for ( std::size_t b = 0 ; b < 256 ; ++b )
+        {
+            boost::uint64_t spread = 0;
+            for ( std::size_t j = 0 ; j < 8 && j * Dimension < 64 ; ++j )
+                if ( b & (std::size_t(1) << j) )
+                    spread |= boost::uint64_t(1) << (j * Dimension);
+            m_spread[b] = spread;
+        }
+    }
+
+    inline boost::uint64_t apply(boost::uint32_t const* coords) const
+    {
+        boost::uint64_t key = 0;
+        for ( std::size_t i = 0 ; i < Dimension ; ++i )
+            for ( std::size_t k = 0 ; k < 4 && 8 * k * Dimension < 64 ; ++k )
+                key |= m_spread[(coords[i] >> (8 * k)) & 0xff] << (8 * k * Dimension + Dimension - 1 - i);
+        return key;
+    }
+
+private:
+    boost::uint64_t m_spread[256];
+};
+
+struct morton_key
+{
+    template <std::size_t Dimension>
+    static inline boost::uint64_t apply(boost::uint32_t * coords, interleave_table<Dimension> const& table)
+    {
+        return table.apply(coords);
+    }
+};
+
+// The coordinates are transformed to the transposed Hilbert index,
+// see J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004.
+// The branches of the original algorithm are replaced by masks.
+struct hilbert_key
+{
+    template <std::size_t Dimension>
+    static inline boost::uint64_t apply(boost::uint32_t * x, interleave_table<Dimension> const& table)
+    {
+        boost::uint32_t const m = boost::uint32_t(1) << (curve_bits<Dimension>::value - 1);
+
+        // inverse undo
+        for ( boost::uint32_t q = m ; q > 1 ; q >>= 1 )
+        {
+            boost::uint32_t const p = q - 1;
+            for ( std::size_t i = 0 ; i < Dimension ; ++i )
+            {
+                // if the bit is set, invert the lower bits of x[0],
+                // otherwise exchange the lower bits of x[0] and x[i]
+                boost::uint32_t const set = boost::uint32_t(0) - ((x[i] & q) != 0 ? 1u : 0u);
+                x[0] ^= p & set;
+                boost::uint32_t const t = (x[0] ^ x[i]) & p & ~set;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+
+        // Gray encode
+        for ( std::size_t i = 1 ; i < Dimension ; ++i )
+            x[i] ^= x[i-1];
+        boost::uint32_t t = 0;
+        for ( boost::uint32_t q = m ; q > 1 ; q >>= 1 )
+            if ( x[Dimension-1] & q )
+                t ^= q - 1;
+        for ( std::size_t i = 0 ; i < Dimension ; ++i )
+            x[i] ^= t;
+
+        return table.apply(x);
+    }
+};
+
+// LSD radix sort of pairs of keys and indexes, with 11-bit digits. The counts of all
+// digits are gathered in one pass and digits equal for all keys are skipped.
+// The sort is stable.
+template <typename KeyEntry>
+inline void radix_sort(std::vector<KeyEntry> & entries, std::size_t key_bits)
+{
+    std::size_t const digit_bits = 11;
+    std::size_t const radix = std::size_t(1) << digit_bits;
+    std::size_t const mask = radix - 1;
+    std::size_t const passes = (key_bits + digit_bits - 1) / digit_bits;
+    std::size_t const count = entries.size();
+
+    std::vector<std::size_t> counts(passes * radix, 0);
+    for ( std::size_t i = 0 ; i < count ; ++i )
+        for ( std::size_t p = 0 ; p < passes ; ++p )
+            ++counts[p * radix + ((entries[i].first >> (digit_bits * p)) & mask)];
+
+    std::vector<KeyEntry> buffer;
+    for ( std::size_t p = 0 ; p < passes ; ++p )
+    {
+        std::size_t * offsets = &counts[p * radix];
+        if ( offsets[(entries[0].first >> (digit_bits * p)) & mask] == count )
+            continue;
+
+        std::size_t sum = 0;
+        for ( std::size_t d = 0 ; d < radix ; ++d )
+        {
+            std::size_t const c = offsets[d];
+            offsets[d] = sum;
+            sum += c;
+        }
+
+        buffer.resize(count);
+        for ( std::size_t i = 0 ; i < count ; ++i )
+            buffer[offsets[(entries[i].first >> (digit_bits * p)) & mask]++] = entries[i];
+        entries.swap(buffer);
+    }
+}
+
+// Orders the entries before the nodes are created
+template <typename PackingAlgorithm>
+struct order_entries
+{
+    // index::topdown_packing - the order is defined while the nodes are created
+    template <typename Entries, typename Box>
+    static inline void apply(Entries & , Box const& ) {}
+};
+
+template <typename CurveKey>
+struct order_entries_along_curve
+{
+    template <typename Entries, typename Box>
+    static inline void apply(Entries & entries, Box const& box)
+    {
+        static const std::size_t dimension = geometry::dimension<Box>::value;
+        typedef std::pair<boost::uint64_t, std::size_t> key_entry;
+
+        if ( entries.size() < 2 )
+            return;
+
+        double mins[dimension];
+        double scales[dimension];
+        curve_coordinates<0, dimension>::init(box, mins, scales);
+
+        interleave_table<dimension> const table;
+
+        std::vector<key_entry> keys;
+        keys.reserve(entries.size());
+        for ( std::size_t i = 0 ; i < entries.size() ; ++i )
+        {
+            boost::uint32_t coords[dimension];
+            curve_coordinates<0, dimension>::apply(entries[i].first, mins, scales, coords);
+            keys.push_back(key_entry(CurveKey::apply(coords, table), i));
+        }
+
+        radix_sort(keys, dimension * curve_bits<dimension>::value);
+
+        Entries sorted;
+        sorted.reserve(entries.size());
+        for ( std::size_t i = 0 ; i < keys.size() ; ++i )
+            sorted.push_back(entries[keys[i].second]);
+        entries.swap(sorted);
+    }
+};
+
+template <>
+struct order_entries<index::hilbert_packing> : order_entries_along_curve<hilbert_key> {};
+
+template <>
+struct order_entries<index::morton_packing> : order_entries_along_curve<morton_key> {};
+
 } // namespace pack_utils
 
 // STR leafs number are calculated as rcount/max
@@ -118,8 +380,15 @@ struct nth_element_and_half_boxes<Dimension, Dimension>
 // L1          125               52
 // L2  25  25  25  25  25   25  17    10
 // L3  5x5 5x5 5x5 5x5 5x5  5x5 3x5+2 2x5
-
-template <typename Value, typename Options, typename Translator, typename Box, typename Allocators>
+//
+// For index::hilbert_packing and index::morton_packing the values are first sorted
+// along the curve and the same numbers of elements are taken in this order, so each
+// node contains a contiguous part of the curve. The subtrees are split at multiples
+// of their maximal counts, so the leafs are the same as the ones created bottom-up
+// from consecutive groups of Max values.
+
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators,
+          typename PackingAlgorithm = index::topdown_packing>
 class pack
 {
     typedef typename rtree::node<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag>::type node;
@@ -183,6 +452,8 @@ public:
             entries.push_back(std::make_pair(pt, first));
         }
 
+        pack_utils::order_entries<PackingAlgorithm>::apply(entries, hint_box.get());
+
         subtree_elements_counts subtree_counts = calculate_subtree_elements_counts(values_count, parameters, leafs_level);
         internal_element el = per_level(entries.begin(), entries.end(), hint_box.get(), values_count, subtree_counts,
                                         parameters, translator, allocators);
@@ -362,12 +633,9 @@ private:
         std::size_t median_count = calculate_median_count(values_count, subtree_counts);
         EIt median = first + median_count;
 
-        coordinate_type greatest_length;
-        std::size_t greatest_dim_index = 0;
-        pack_utils::biggest_edge<dimension>::apply(hint_box, greatest_length, greatest_dim_index);
         Box left, right;
-        pack_utils::nth_element_and_half_boxes<0, dimension>
-            ::apply(first, median, last, hint_box, left, right, greatest_dim_index);
+        pack_utils::partition_entries<PackingAlgorithm>
+            ::apply(first, median, last, hint_box, left, right);
         
         per_level_packets(first, median, left,
                           median_count, subtree_counts, next_subtree_counts,
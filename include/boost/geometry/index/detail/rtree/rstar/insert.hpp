@@ -123,6 +123,8 @@ public:
         }
         BOOST_CATCH_END
 
+        rtree::add_reinsert_statistics(parameters, reinserted_elements_count);
+
         ::boost::ignore_unused_variable_warning(parameters);
     }
 
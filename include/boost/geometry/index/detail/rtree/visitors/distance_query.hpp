@@ -29,7 +29,8 @@ public:
         m_neighbors.reserve(m_count);
     }
 
-    inline void store(Value const& val, distance_type const& curr_comp_dist)
+    // returns true if the value is added to the neighbors
+    inline bool store(Value const& val, distance_type const& curr_comp_dist)
     {
         if ( m_neighbors.size() < m_count )
         {
@@ -37,6 +38,8 @@ public:
 
             if ( m_neighbors.size() == m_count )
                 std::make_heap(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+
+            return true;
         }
         else
         {
@@ -46,8 +49,12 @@ public:
                 m_neighbors.back().first = curr_comp_dist;
                 m_neighbors.back().second = val;
                 std::push_heap(m_neighbors.begin(), m_neighbors.end(), neighbors_less);
+
+                return true;
             }
         }
+
+        return false;
     }
 
     inline bool has_enough_neighbors() const
@@ -97,7 +104,8 @@ template <
     typename Allocators,
     typename Predicates,
     unsigned DistancePredicateIndex,
-    typename OutIter
+    typename OutIter,
+    typename Statistics = typename rtree::statistics_collector_type<typename Options::parameters_type>::type
 >
 class distance_query
     : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
@@ -120,10 +128,12 @@ public:
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline distance_query(parameters_type const& parameters, Translator const& translator, Predicates const& pred, OutIter out_it)
+    inline distance_query(parameters_type const& parameters, Translator const& translator, Predicates const& pred, OutIter out_it,
+                          Statistics const& statistics = Statistics())
         : m_parameters(parameters), m_translator(translator)
         , m_pred(pred)
         , m_result(nearest_predicate_access::get(m_pred).count, out_it)
+        , m_statistics(statistics)
     {}
 
     inline void operator()(internal_node const& n)
@@ -141,10 +151,14 @@ public:
         
         elements_type const& elements = rtree::elements(n);
 
+        m_statistics.visit_internal();
+
         // fill array of nodes meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_statistics.check_bounds();
+
             // if current node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(m_pred, 0, it->first) )
@@ -166,12 +180,16 @@ public:
 
                 // add current node's data into the list
                 active_branch_list.push_back( std::make_pair(node_distance, it->second) );
+                m_statistics.push_branch();
             }
         }
 
         // if there aren't any nodes in ABL - return
         if ( active_branch_list.empty() )
+        {
+            m_statistics.leave();
             return;
+        }
         
         // sort array
         std::sort(active_branch_list.begin(), active_branch_list.end(), abl_less);
@@ -188,6 +206,8 @@ public:
             rtree::apply_visitor(*this, *(it->second));
         }
 
+        m_statistics.leave();
+
         // ALTERNATIVE VERSION - use heap instead of sorted container
         // It seems to be faster for greater MaxElements and slower otherwise
         // CONSIDER: using one global container/heap for active branches
@@ -221,10 +241,14 @@ public:
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
         
+        m_statistics.visit_leaf();
+
         // search leaf for closest value meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            m_statistics.check_value();
+
             // if value meets predicates
             if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(m_pred, *it, m_translator(*it)) )
             {
@@ -234,10 +258,13 @@ public:
                 if ( calculate_value_distance::apply(predicate(), m_translator(*it), value_distance) )
                 {
                     // store value
-                    m_result.store(*it, value_distance);
+                    if ( m_result.store(*it, value_distance) )
+                        m_statistics.push_heap();
                 }
             }
         }
+
+        m_statistics.leave();
     }
 
     inline size_t finish()
@@ -245,6 +272,11 @@ public:
         return m_result.finish();
     }
 
+    inline Statistics & statistics()
+    {
+        return m_statistics;
+    }
+
 private:
     static inline bool abl_less(
         std::pair<node_distance_type, typename Allocators::node_pointer> const& p1,
@@ -276,6 +308,8 @@ private:
 
     Predicates m_pred;
     distance_query_result<Value, Translator, value_distance_type, OutIter> m_result;
+
+    Statistics m_statistics;
 };
 
 template <
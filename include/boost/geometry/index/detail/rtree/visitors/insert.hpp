@@ -356,6 +356,8 @@ protected:
 
         split_algo::apply(additional_nodes, n, n_box, m_parameters, m_translator, m_allocators);                // MAY THROW (V, E: alloc, copy, N:alloc)
 
+        rtree::add_split_statistics(m_parameters);
+
         BOOST_GEOMETRY_INDEX_ASSERT(additional_nodes.size() == 1, "unexpected number of additional nodes");
 
         // TODO add all additional nodes
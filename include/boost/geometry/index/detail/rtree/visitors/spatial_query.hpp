@@ -15,7 +15,8 @@ namespace boost { namespace geometry { namespace index {
 
 namespace detail { namespace rtree { namespace visitors {
 
-template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates, typename OutIter>
+template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates, typename OutIter,
+          typename Statistics = typename rtree::statistics_collector_type<typename Options::parameters_type>::type>
 struct spatial_query
     : public rtree::visitor<Value, typename Options::parameters_type, Box, Allocators, typename Options::node_tag, true>::type
 {
@@ -27,8 +28,9 @@ struct spatial_query
 
     static const unsigned predicates_len = index::detail::predicates_length<Predicates>::value;
 
-    inline spatial_query(Translator const& t, Predicates const& p, OutIter out_it)
-        : tr(t), pred(p), out_iter(out_it), found_count(0)
+    inline spatial_query(Translator const& t, Predicates const& p, OutIter out_it,
+                         Statistics const& s = Statistics())
+        : tr(t), pred(p), out_iter(out_it), found_count(0), stats(s)
     {}
 
     inline void operator()(internal_node const& n)
@@ -36,15 +38,21 @@ struct spatial_query
         typedef typename rtree::elements_type<internal_node>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
+        stats.visit_internal();
+
         // traverse nodes meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            stats.check_bounds();
+
             // if node meets predicates
             // 0 - dummy value
             if ( index::detail::predicates_check<index::detail::bounds_tag, 0, predicates_len>(pred, 0, it->first) )
                 rtree::apply_visitor(*this, *it->second);
         }
+
+        stats.leave();
     }
 
     inline void operator()(leaf const& n)
@@ -52,10 +60,14 @@ struct spatial_query
         typedef typename rtree::elements_type<leaf>::type elements_type;
         elements_type const& elements = rtree::elements(n);
 
+        stats.visit_leaf();
+
         // get all values meeting predicates
         for (typename elements_type::const_iterator it = elements.begin();
             it != elements.end(); ++it)
         {
+            stats.check_value();
+
             // if value meets predicates
             if ( index::detail::predicates_check<index::detail::value_tag, 0, predicates_len>(pred, *it, tr(*it)) )
             {
@@ -65,6 +77,8 @@ struct spatial_query
                 ++found_count;
             }
         }
+
+        stats.leave();
     }
 
     Translator const& tr;
@@ -73,6 +87,8 @@ struct spatial_query
 
     OutIter out_iter;
     size_type found_count;
+
+    Statistics stats;
 };
 
 template <typename Value, typename Options, typename Translator, typename Box, typename Allocators, typename Predicates>
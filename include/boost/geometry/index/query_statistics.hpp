@@ -0,0 +1,225 @@
+// Boost.Geometry Index
+//
+// R-tree query statistics
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
+
+#include <cstddef>
+
+namespace boost { namespace geometry { namespace index {
+
+/*!
+\brief Counters of the work done by r-tree queries and modifications.
+
+Levels are counted from the root, which is level 0.
+
+\par Example
+\verbatim
+bgi::query_statistics stats;
+tree.query(bgi::intersects(box), std::back_inserter(result), stats);
+std::cout << stats.nodes_visited << " " << stats.leaf_entries_tested << std::endl;
+\endverbatim
+*/
+struct query_statistics
+{
+    /*! \brief The number of levels of which predicate checks are counted separately, checks of deeper levels are added to the last one. */
+    static const std::size_t max_levels = 16;
+
+    inline query_statistics()
+    {
+        reset();
+    }
+
+    inline void reset()
+    {
+        queries = 0;
+        nodes_visited = 0;
+        leaves_visited = 0;
+        leaf_entries_tested = 0;
+        branch_pushes = 0;
+        heap_pushes = 0;
+        splits = 0;
+        reinsertions = 0;
+        for ( std::size_t i = 0 ; i < max_levels ; ++i )
+            predicate_checks[i] = 0;
+    }
+
+    inline query_statistics & operator+=(query_statistics const& other)
+    {
+        queries += other.queries;
+        nodes_visited += other.nodes_visited;
+        leaves_visited += other.leaves_visited;
+        leaf_entries_tested += other.leaf_entries_tested;
+        branch_pushes += other.branch_pushes;
+        heap_pushes += other.heap_pushes;
+        splits += other.splits;
+        reinsertions += other.reinsertions;
+        for ( std::size_t i = 0 ; i < max_levels ; ++i )
+            predicate_checks[i] += other.predicate_checks[i];
+        return *this;
+    }
+
+    /*! \brief The number of queries. */
+    std::size_t queries;
+    /*! \brief The number of nodes visited by queries, internal nodes and leafs. */
+    std::size_t nodes_visited;
+    /*! \brief The number of leafs visited by queries. */
+    std::size_t leaves_visited;
+    /*! \brief The number of values tested against the predicates. */
+    std::size_t leaf_entries_tested;
+    /*! \brief The number of predicate checks of node boxes or values, per level of the node containing them. */
+    std::size_t predicate_checks[max_levels];
+    /*! \brief The number of nodes added to the active branch lists of nearest queries. */
+    std::size_t branch_pushes;
+    /*! \brief The number of values pushed into the heap of neighbors of nearest queries. */
+    std::size_t heap_pushes;
+    /*! \brief The number of node splits by insertions. */
+    std::size_t splits;
+    /*! \brief The number of elements removed for forced reinsertion by R*-tree insertions. */
+    std::size_t reinsertions;
+};
+
+namespace detail { namespace rtree {
+
+// Cumulative counters of the r-tree, kept by its parameters. Parameters don't
+// collect anything, unless this is specialized for them (see with_statistics
+// in index/statistics.hpp).
+template <typename Parameters>
+struct parameters_statistics
+{
+    static inline void add(Parameters const&, query_statistics const&) {}
+    static inline void add_split(Parameters const&) {}
+    static inline void add_reinsert(Parameters const&, std::size_t) {}
+};
+
+template <typename Parameters>
+inline void add_statistics(Parameters const& parameters, query_statistics const& s)
+{
+    parameters_statistics<Parameters>::add(parameters, s);
+}
+
+template <typename Parameters>
+inline void add_split_statistics(Parameters const& parameters)
+{
+    parameters_statistics<Parameters>::add_split(parameters);
+}
+
+template <typename Parameters>
+inline void add_reinsert_statistics(Parameters const& parameters, std::size_t count)
+{
+    parameters_statistics<Parameters>::add_reinsert(parameters, count);
+}
+
+// Collector of the statistics of one query, the no_statistics version is used
+// if statistics are not collected and is optimized away.
+struct no_statistics
+{
+    inline void visit_internal() {}
+    inline void visit_leaf() {}
+    inline void leave() {}
+    inline void check_bounds() {}
+    inline void check_value() {}
+    inline void push_branch() {}
+    inline void push_heap() {}
+
+    template <typename Parameters>
+    inline void finish(Parameters const&) {}
+};
+
+class statistics_collector
+{
+public:
+    inline statistics_collector()
+        : m_level(0)
+        , m_destination(0)
+    {}
+
+    inline explicit statistics_collector(query_statistics & destination)
+        : m_level(0)
+        , m_destination(&destination)
+    {}
+
+    inline void visit_internal()
+    {
+        ++m_statistics.nodes_visited;
+        ++m_level;
+    }
+
+    inline void visit_leaf()
+    {
+        ++m_statistics.nodes_visited;
+        ++m_statistics.leaves_visited;
+        ++m_level;
+    }
+
+    inline void leave()
+    {
+        --m_level;
+    }
+
+    inline void check_bounds()
+    {
+        ++m_statistics.predicate_checks[level_index()];
+    }
+
+    inline void check_value()
+    {
+        ++m_statistics.leaf_entries_tested;
+        ++m_statistics.predicate_checks[level_index()];
+    }
+
+    inline void push_branch()
+    {
+        ++m_statistics.branch_pushes;
+    }
+
+    inline void push_heap()
+    {
+        ++m_statistics.heap_pushes;
+    }
+
+    // Adds the counters of the query to the destination, if any, and to
+    // the cumulative counters of the r-tree, if it collects them
+    template <typename Parameters>
+    inline void finish(Parameters const& parameters)
+    {
+        m_statistics.queries = 1;
+        if ( m_destination )
+            *m_destination += m_statistics;
+        add_statistics(parameters, m_statistics);
+    }
+
+private:
+    // The level of the node being visited, the root is level 0. Checks before
+    // visiting any node (m_level == 0) are not done, but would count as root.
+    inline std::size_t level_index() const
+    {
+        return m_level == 0 ? 0
+             : m_level <= query_statistics::max_levels ? m_level - 1
+             : query_statistics::max_levels - 1;
+    }
+
+    query_statistics m_statistics;
+    std::size_t m_level;
+    query_statistics * m_destination;
+};
+
+// The collector used by queries not passing statistics
+template <typename Parameters>
+struct statistics_collector_type
+{
+    typedef no_statistics type;
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_QUERY_STATISTICS_HPP
@@ -17,6 +17,7 @@
 
 // Boost
 #include <boost/tuple/tuple.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <boost/move/move.hpp>
 
 // Boost.Geometry
@@ -42,6 +43,7 @@
 #include <boost/geometry/index/detail/exception.hpp>
 
 #include <boost/geometry/index/detail/rtree/options.hpp>
+#include <boost/geometry/index/query_statistics.hpp>
 
 #include <boost/geometry/index/indexable.hpp>
 #include <boost/geometry/index/equal_to.hpp>
@@ -295,12 +297,46 @@ public:
                  allocator_type const& allocator = allocator_type())
         : m_members(getter, equal, parameters, allocator)
     {
-        typedef detail::rtree::pack<value_type, options_type, translator_type, box_type, allocators_type> pack;
-        size_type vc = 0, ll = 0;
-        m_members.root = pack::apply(first, last, vc, ll,
-                                     m_members.parameters(), m_members.translator(), m_members.allocators());
-        m_members.values_count = vc;
-        m_members.leafs_level = ll;
+        this->pack_construct(first, last, index::topdown_packing());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using the passed packing algorithm.
+
+    \par Example
+    \verbatim
+    bgi::rtree< value_type, bgi::linear<16> > rt(values.begin(), values.end(), bgi::hilbert_packing());
+    \endverbatim
+
+    \param first        The beginning of the range of Values.
+    \param last         The end of the range of Values.
+    \param packing      The packing algorithm, index::topdown_packing, index::hilbert_packing
+                        or index::morton_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Iterator, typename PackingAlgorithm>
+    inline rtree(Iterator first, Iterator last,
+                 PackingAlgorithm const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type(),
+                 typename boost::enable_if_c<
+                     index::detail::is_packing_algorithm<PackingAlgorithm>::value
+                 >::type * = 0)
+        : m_members(getter, equal, parameters, allocator)
+    {
+        this->pack_construct(first, last, packing);
     }
 
     /*!
@@ -327,12 +363,45 @@ public:
                           allocator_type const& allocator = allocator_type())
         : m_members(getter, equal, parameters, allocator)
     {
-        typedef detail::rtree::pack<value_type, options_type, translator_type, box_type, allocators_type> pack;
-        size_type vc = 0, ll = 0;
-        m_members.root = pack::apply(::boost::begin(rng), ::boost::end(rng), vc, ll,
-                                     m_members.parameters(), m_members.translator(), m_members.allocators());
-        m_members.values_count = vc;
-        m_members.leafs_level = ll;
+        this->pack_construct(::boost::begin(rng), ::boost::end(rng), index::topdown_packing());
+    }
+
+    /*!
+    \brief The constructor.
+
+    The tree is created using the passed packing algorithm.
+
+    \par Example
+    \verbatim
+    bgi::rtree< value_type, bgi::linear<16> > rt(values, bgi::hilbert_packing());
+    \endverbatim
+
+    \param rng          The range of Values.
+    \param packing      The packing algorithm, index::topdown_packing, index::hilbert_packing
+                        or index::morton_packing.
+    \param parameters   The parameters object.
+    \param getter       The function object extracting Indexable from Value.
+    \param equal        The function object comparing Values.
+    \param allocator    The allocator object.
+
+    \par Throws
+    \li If allocator copy constructor throws.
+    \li If Value copy constructor or copy assignment throws.
+    \li If allocation throws or returns invalid value.
+    */
+    template<typename Range, typename PackingAlgorithm>
+    inline rtree(Range const& rng,
+                 PackingAlgorithm const& packing,
+                 parameters_type const& parameters = parameters_type(),
+                 indexable_getter const& getter = indexable_getter(),
+                 value_equal const& equal = value_equal(),
+                 allocator_type const& allocator = allocator_type(),
+                 typename boost::enable_if_c<
+                     index::detail::is_packing_algorithm<PackingAlgorithm>::value
+                 >::type * = 0)
+        : m_members(getter, equal, parameters, allocator)
+    {
+        this->pack_construct(::boost::begin(rng), ::boost::end(rng), packing);
     }
 
     /*!
@@ -835,7 +904,46 @@ public:
         static const bool is_distance_predicate = 0 < distance_predicates_count;
         BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
 
-        return query_dispatch(predicates, out_it, boost::mpl::bool_<is_distance_predicate>());
+        typedef typename detail::rtree::statistics_collector_type<Parameters>::type statistics_type;
+
+        return query_dispatch(predicates, out_it, statistics_type(), boost::mpl::bool_<is_distance_predicate>());
+    }
+
+    /*!
+    \brief Finds values meeting passed predicates and collects the statistics of the query.
+
+    This query function performs the same search as query(predicates, out_it) and adds the counters of the
+    nodes visited, the predicates checked and, for nearest queries, the nodes and values pushed, to the
+    passed statistics. This way one query or a series of queries may be analyzed, also for r-trees not
+    collecting statistics themselves.
+
+    \par Example
+    \verbatim
+    bgi::query_statistics stats;
+    tree.query(bgi::nearest(pt, 5), std::back_inserter(result), stats);
+    \endverbatim
+
+    \par Throws
+    If Value copy constructor or copy assignment throws.
+    If predicates copy throws.
+
+    \param predicates   Predicates.
+    \param out_it       The output iterator, e.g. generated by std::back_inserter().
+    \param statistics   The statistics to which the counters of the query are added.
+
+    \return             The number of values found.
+    */
+    template <typename Predicates, typename OutIter>
+    size_type query(Predicates const& predicates, OutIter out_it, index::query_statistics & statistics) const
+    {
+        if ( !m_members.root )
+            return 0;
+
+        static const unsigned distance_predicates_count = detail::predicates_count_distance<Predicates>::value;
+        static const bool is_distance_predicate = 0 < distance_predicates_count;
+        BOOST_MPL_ASSERT_MSG((distance_predicates_count <= 1), PASS_ONLY_ONE_DISTANCE_PREDICATE, (Predicates));
+
+        return query_dispatch(predicates, out_it, detail::rtree::statistics_collector(statistics), boost::mpl::bool_<is_distance_predicate>());
     }
 
     /*!
@@ -1340,6 +1448,41 @@ public:
         return m_members.parameters();
     }
 
+    /*!
+    \brief Returns the statistics collected by the rtree.
+
+    Available only for an rtree created with parameters wrapped in index::with_statistics,
+    defined in boost/geometry/index/statistics.hpp.
+
+    \par Example
+    \verbatim
+    bgi::rtree< value_type, bgi::with_statistics< bgi::rstar<16> > > tree(values);
+    bgi::query_statistics stats = tree.statistics();
+    \endverbatim
+
+    \return     The counters collected since the construction or the last reset.
+
+    \par Throws
+    Nothing.
+    */
+    inline index::query_statistics statistics() const
+    {
+        return detail::rtree::parameters_statistics<parameters_type>::get(m_members.parameters());
+    }
+
+    /*!
+    \brief Sets the statistics collected by the rtree to zero.
+
+    Available only for an rtree created with parameters wrapped in index::with_statistics.
+
+    \par Throws
+    Nothing.
+    */
+    inline void reset_statistics()
+    {
+        detail::rtree::parameters_statistics<parameters_type>::reset(m_members.parameters());
+    }
+
     /*!
     \brief Returns function retrieving Indexable from Value.
 
@@ -1497,6 +1640,26 @@ private:
         return 0;
     }
 
+    /*!
+    \brief Create the R-tree from the Values using the packing algorithm.
+
+    \par Exception-safety
+    strong
+    */
+    template <typename Iterator, typename PackingAlgorithm>
+    inline void pack_construct(Iterator first, Iterator last, PackingAlgorithm const& /*packing*/)
+    {
+        typedef detail::rtree::pack
+            <
+                value_type, options_type, translator_type, box_type, allocators_type, PackingAlgorithm
+            > pack;
+        size_type vc = 0, ll = 0;
+        m_members.root = pack::apply(first, last, vc, ll,
+                                     m_members.parameters(), m_members.translator(), m_members.allocators());
+        m_members.values_count = vc;
+        m_members.leafs_level = ll;
+    }
+
     /*!
     \brief Create an empty R-tree i.e. new empty root node and clear other attributes.
 
@@ -1654,14 +1817,16 @@ private:
     \par Exception-safety
     strong
     */
-    template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, Statistics const& statistics, boost::mpl::bool_<false> const& /*is_distance_predicate*/) const
     {
-        detail::rtree::visitors::spatial_query<value_type, options_type, translator_type, box_type, allocators_type, Predicates, OutIter>
-            find_v(m_members.translator(), predicates, out_it);
+        detail::rtree::visitors::spatial_query<value_type, options_type, translator_type, box_type, allocators_type, Predicates, OutIter, Statistics>
+            find_v(m_members.translator(), predicates, out_it, statistics);
 
         detail::rtree::apply_visitor(find_v, *m_members.root);
 
+        find_v.stats.finish(m_members.parameters());
+
         return find_v.found_count;
     }
 
@@ -1671,8 +1836,8 @@ private:
     \par Exception-safety
     strong
     */
-    template <typename Predicates, typename OutIter>
-    size_type query_dispatch(Predicates const& predicates, OutIter out_it, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
+    template <typename Predicates, typename OutIter, typename Statistics>
+    size_type query_dispatch(Predicates const& predicates, OutIter out_it, Statistics const& statistics, boost::mpl::bool_<true> const& /*is_distance_predicate*/) const
     {
         BOOST_GEOMETRY_INDEX_ASSERT(m_members.root, "The root must exist");
 
@@ -1685,11 +1850,14 @@ private:
             allocators_type,
             Predicates,
             distance_predicate_index,
-            OutIter
-        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it);
+            OutIter,
+            Statistics
+        > distance_v(m_members.parameters(), m_members.translator(), predicates, out_it, statistics);
 
         detail::rtree::apply_visitor(distance_v, *m_members.root);
 
+        distance_v.statistics().finish(m_members.parameters());
+
         return distance_v.finish();
     }
     
@@ -1986,6 +2154,31 @@ query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
     return tree.query(predicates, out_it);
 }
 
+/*!
+\brief Finds values meeting passed predicates and collects the statistics of the query.
+
+It calls \c rtree::query(Predicates const&, OutIter, query_statistics&).
+
+\ingroup rtree_functions
+
+\param tree         The rtree.
+\param predicates   Predicates.
+\param out_it       The output iterator, e.g. generated by std::back_inserter().
+\param statistics   The statistics to which the counters of the query are added.
+
+\return             The number of values found.
+*/
+template <typename Value, typename Parameters, typename IndexableGetter, typename EqualTo, typename Allocator,
+          typename Predicates, typename OutIter> inline
+typename rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator>::size_type
+query(rtree<Value, Parameters, IndexableGetter, EqualTo, Allocator> const& tree,
+      Predicates const& predicates,
+      OutIter out_it,
+      index::query_statistics & statistics)
+{
+    return tree.query(predicates, out_it, statistics);
+}
+
 /*!
 \brief Returns the query iterator pointing at the begin of the query range.
 
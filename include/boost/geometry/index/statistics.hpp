@@ -0,0 +1,240 @@
+// Boost.Geometry Index
+//
+// R-tree collecting query and modification statistics
+//
+// Copyright (c) 2026 Boost.Geometry contributors.
+//
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_INDEX_STATISTICS_HPP
+#define BOOST_GEOMETRY_INDEX_STATISTICS_HPP
+
+#include <cstddef>
+
+#include <boost/atomic.hpp>
+
+#include <boost/geometry/index/query_statistics.hpp>
+#include <boost/geometry/index/detail/rtree/options.hpp>
+
+namespace boost { namespace geometry { namespace index {
+
+namespace detail { namespace rtree {
+
+// Cumulative counters, which may be updated by concurrent queries
+class atomic_statistics
+{
+public:
+    inline atomic_statistics()
+    {
+        reset();
+    }
+
+    inline void reset()
+    {
+        queries.store(0, boost::memory_order_relaxed);
+        nodes_visited.store(0, boost::memory_order_relaxed);
+        leaves_visited.store(0, boost::memory_order_relaxed);
+        leaf_entries_tested.store(0, boost::memory_order_relaxed);
+        branch_pushes.store(0, boost::memory_order_relaxed);
+        heap_pushes.store(0, boost::memory_order_relaxed);
+        splits.store(0, boost::memory_order_relaxed);
+        reinsertions.store(0, boost::memory_order_relaxed);
+        for ( std::size_t i = 0 ; i < query_statistics::max_levels ; ++i )
+            predicate_checks[i].store(0, boost::memory_order_relaxed);
+    }
+
+    inline void add(query_statistics const& s)
+    {
+        add(queries, s.queries);
+        add(nodes_visited, s.nodes_visited);
+        add(leaves_visited, s.leaves_visited);
+        add(leaf_entries_tested, s.leaf_entries_tested);
+        add(branch_pushes, s.branch_pushes);
+        add(heap_pushes, s.heap_pushes);
+        add(splits, s.splits);
+        add(reinsertions, s.reinsertions);
+        for ( std::size_t i = 0 ; i < query_statistics::max_levels ; ++i )
+            add(predicate_checks[i], s.predicate_checks[i]);
+    }
+
+    inline query_statistics get() const
+    {
+        query_statistics result;
+        result.queries = queries.load(boost::memory_order_relaxed);
+        result.nodes_visited = nodes_visited.load(boost::memory_order_relaxed);
+        result.leaves_visited = leaves_visited.load(boost::memory_order_relaxed);
+        result.leaf_entries_tested = leaf_entries_tested.load(boost::memory_order_relaxed);
+        result.branch_pushes = branch_pushes.load(boost::memory_order_relaxed);
+        result.heap_pushes = heap_pushes.load(boost::memory_order_relaxed);
+        result.splits = splits.load(boost::memory_order_relaxed);
+        result.reinsertions = reinsertions.load(boost::memory_order_relaxed);
+        for ( std::size_t i = 0 ; i < query_statistics::max_levels ; ++i )
+            result.predicate_checks[i] = predicate_checks[i].load(boost::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    atomic_statistics(atomic_statistics const&);
+    atomic_statistics & operator=(atomic_statistics const&);
+
+    static inline void add(boost::atomic<std::size_t> & counter, std::size_t value)
+    {
+        if ( value > 0 )
+            counter.fetch_add(value, boost::memory_order_relaxed);
+    }
+
+    boost::atomic<std::size_t> queries;
+    boost::atomic<std::size_t> nodes_visited;
+    boost::atomic<std::size_t> leaves_visited;
+    boost::atomic<std::size_t> leaf_entries_tested;
+    boost::atomic<std::size_t> predicate_checks[query_statistics::max_levels];
+    boost::atomic<std::size_t> branch_pushes;
+    boost::atomic<std::size_t> heap_pushes;
+    boost::atomic<std::size_t> splits;
+    boost::atomic<std::size_t> reinsertions;
+};
+
+}} // namespace detail::rtree
+
+/*!
+\brief Parameters of an r-tree collecting statistics.
+
+Wraps the parameters of the balancing algorithm, e.g. <tt>with_statistics< rstar<16> ></tt>.
+This header has to be included to use it, other r-trees don't depend on Boost.Atomic.
+The r-tree collects the statistics of all its queries and insertions. Each query collects its
+counters locally and adds them to the cumulative counters when it is finished, using atomic
+operations, so concurrent queries may be performed. R-trees with other parameters don't
+collect anything.
+
+The counters are not copied with the parameters, each r-tree has its own counters.
+Queries of query iterators are not counted.
+
+\par Example
+\verbatim
+typedef bgi::rtree<value_type, bgi::with_statistics< bgi::rstar<16> > > rtree_type;
+rtree_type tree(values);
+tree.query(bgi::nearest(pt, 5), std::back_inserter(result));
+bgi::query_statistics stats = tree.statistics();
+\endverbatim
+
+\tparam Parameters  The parameters of the balancing algorithm.
+*/
+template <typename Parameters>
+class with_statistics
+    : public Parameters
+{
+public:
+    /*!
+    \brief The constructor.
+
+    \param parameters   The parameters of the balancing algorithm.
+    */
+    explicit with_statistics(Parameters const& parameters = Parameters())
+        : Parameters(parameters)
+    {}
+
+    with_statistics(with_statistics const& other)
+        : Parameters(other)
+    {}
+
+    with_statistics & operator=(with_statistics const& other)
+    {
+        Parameters::operator=(other);
+        return *this;
+    }
+
+    /*!
+    \brief Returns the counters collected since construction or the last reset.
+    */
+    query_statistics statistics() const
+    {
+        return m_statistics.get();
+    }
+
+    /*!
+    \brief Sets all counters to zero.
+    */
+    void reset_statistics() const
+    {
+        m_statistics.reset();
+    }
+
+    /*!
+    \brief Adds counters to the cumulative counters.
+    */
+    void add_statistics(query_statistics const& s) const
+    {
+        m_statistics.add(s);
+    }
+
+private:
+    mutable detail::rtree::atomic_statistics m_statistics;
+};
+
+namespace detail { namespace rtree {
+
+template <typename Parameters>
+struct parameters_statistics< index::with_statistics<Parameters> >
+{
+    typedef index::with_statistics<Parameters> parameters_type;
+
+    static inline query_statistics get(parameters_type const& parameters)
+    {
+        return parameters.statistics();
+    }
+
+    static inline void reset(parameters_type const& parameters)
+    {
+        parameters.reset_statistics();
+    }
+
+    static inline void add(parameters_type const& parameters, query_statistics const& s)
+    {
+        parameters.add_statistics(s);
+    }
+
+    static inline void add_split(parameters_type const& parameters)
+    {
+        query_statistics s;
+        s.splits = 1;
+        parameters.add_statistics(s);
+    }
+
+    static inline void add_reinsert(parameters_type const& parameters, std::size_t count)
+    {
+        query_statistics s;
+        s.reinsertions = count;
+        parameters.add_statistics(s);
+    }
+};
+
+template <typename Parameters>
+struct statistics_collector_type< index::with_statistics<Parameters> >
+{
+    typedef statistics_collector type;
+};
+
+// The same options, with the wrapping parameters, through which the visitors
+// collect the statistics
+template <typename Parameters>
+struct options_type< index::with_statistics<Parameters> >
+{
+    typedef typename options_type<Parameters>::type base_options;
+
+    typedef options<
+        index::with_statistics<Parameters>,
+        typename base_options::insert_tag,
+        typename base_options::choose_next_node_tag,
+        typename base_options::split_tag,
+        typename base_options::redistribute_tag,
+        typename base_options::node_tag
+    > type;
+};
+
+}} // namespace detail::rtree
+
+}}} // namespace boost::geometry::index
+
+#endif // BOOST_GEOMETRY_INDEX_STATISTICS_HPP
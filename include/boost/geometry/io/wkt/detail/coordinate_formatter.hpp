@@ -0,0 +1,516 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
+
+#include <cfloat>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <ios>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/io/wkt/detail/coordinate_parser.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Notation of floating point coordinates, written by wkt_writer
+*/
+enum coordinate_notation
+{
+    //! As std::ostream writes by default (printf "%g")
+    notation_general,
+    //! As std::ostream writes with std::fixed (printf "%f")
+    notation_fixed,
+    //! The fewest significant digits that read back to the same value
+    notation_shortest
+};
+
+
+// Limits for the significant digits tried for shortest notation. With max
+// digits (max_digits10 of C++11: 17 for double, 9 for float) all values
+// read back to the same value
+template <typename T>
+struct shortest_digits
+{
+    static const int min = std::numeric_limits<T>::digits10;
+    static const int max = 2 + std::numeric_limits<T>::digits * 30103 / 100000;
+};
+
+
+//! Appends an unsigned integer in decimal notation
+inline void append_unsigned(std::string& buffer, boost::uint64_t value)
+{
+    char digits[24];
+    char* it = digits + sizeof(digits);
+    do
+    {
+        *--it = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    buffer.append(it, digits + sizeof(digits));
+}
+
+
+//! Writes a value as std::ostream does, used for types and precisions
+//! which are not handled otherwise
+template <typename T>
+inline void stream_format(std::string& buffer, T const& value,
+                          coordinate_notation notation, int precision)
+{
+    std::ostringstream out;
+    if (notation == notation_fixed)
+    {
+        out << std::fixed;
+    }
+    out.precision(precision);
+    out << value;
+    buffer += out.str();
+}
+
+
+//! Appends an unsigned integer of scaled digits as a decimal number with
+//! the specified number of decimals, e.g. 12345 with 3 decimals as 12.345
+inline void append_decimals(std::string& buffer, boost::uint64_t digits,
+                            int decimals)
+{
+    char text[24];
+    char* const end = text + sizeof(text);
+    char* it = end;
+    do
+    {
+        *--it = static_cast<char>('0' + digits % 10);
+        digits /= 10;
+    } while (digits != 0);
+
+    int const length = static_cast<int>(end - it);
+    if (decimals <= 0)
+    {
+        buffer.append(it, end);
+    }
+    else if (length <= decimals)
+    {
+        buffer += "0.";
+        buffer.append(decimals - length, '0');
+        buffer.append(it, end);
+    }
+    else
+    {
+        buffer.append(it, end - decimals);
+        buffer += '.';
+        buffer.append(end - decimals, end);
+    }
+}
+
+
+// The exact products below require double arithmetic without extended
+// precision (e.g. not the x87 FPU), otherwise sprintf is used
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+static const bool exact_double_arithmetic = false;
+#else
+static const bool exact_double_arithmetic = true;
+#endif
+
+//! Calculates the product of two doubles exactly, as the sum of the rounded
+//! product and its rounding error (Dekker)
+inline void two_product(double a, double b, double& product, double& error)
+{
+    double const splitter = 134217729.0; // 2^27 + 1
+    double const ca = splitter * a;
+    double const a_high = ca - (ca - a);
+    double const a_low = a - a_high;
+    double const cb = splitter * b;
+    double const b_high = cb - (cb - b);
+    double const b_low = b - b_high;
+
+    product = a * b;
+    error = ((a_high * b_high - product) + a_high * b_low + a_low * b_high)
+        + a_low * b_low;
+}
+
+
+/*!
+\brief Rounds a non-negative value, multiplied by 10^decimals, to an integer
+\details The rounding is exact, with ties to even, as printf rounds.
+    The product is calculated exactly as a sum of two doubles, such that
+    the rounding does not suffer from the error of the multiplication.
+    Returns false if the result is too large.
+*/
+inline bool round_scaled(double value, int decimals, boost::uint64_t& result)
+{
+    if (! exact_double_arithmetic
+        || decimals < 0
+        || decimals > fast_path_limits<double>::max_exponent)
+    {
+        return false;
+    }
+
+    double high, low;
+    two_product(value, power_of_ten<double>(decimals), high, low);
+
+    if (! (high < 9.2e18)) // fits in 64 bits, also after rounding
+    {
+        return false;
+    }
+    if (high < 0.25)
+    {
+        // Also avoids inexact errors of very small values
+        result = 0;
+        return true;
+    }
+
+    // The exact product is high + low, where low is at most half the
+    // unit in the last place of high. If high has a fraction (below 2^52)
+    // it determines the rounding, together with the sign of low.
+    // Otherwise low is rounded. All comparisons are exact.
+    double const integral = std::floor(high);
+    int direction = 0;
+    if (high != integral)
+    {
+        result = static_cast<boost::uint64_t>(integral);
+        double const half = (high - integral) - 0.5;
+        direction = half > 0 ? 1 : half < 0 ? -1 : low > 0 ? 1 : low < 0 ? -1 : 0;
+    }
+    else
+    {
+        double const low_integral = std::floor(low);
+        double const mid = low_integral + 0.5;
+        result = static_cast<boost::uint64_t>(high)
+            + static_cast<boost::int64_t>(low_integral);
+        direction = low > mid ? 1 : low < mid ? -1 : 0;
+    }
+
+    // Ties are rounded to even
+    if (direction > 0 || (direction == 0 && (result & 1)))
+    {
+        result++;
+    }
+    return true;
+}
+
+
+//! Returns true if value * 10^decimals, calculated exactly, is less than limit
+inline bool scaled_less(double value, int decimals, double limit)
+{
+    double high, low;
+    two_product(value, power_of_ten<double>(decimals), high, low);
+    return high < limit || (high == limit && low < 0);
+}
+
+
+/*!
+\brief Appends a value as printf writes it with "%.*f"
+\details Returns false if the value is not handled here: large values
+    and high precisions
+*/
+inline bool append_fixed(std::string& buffer, double value, int precision)
+{
+    boost::uint64_t digits;
+    if (! boost::math::isfinite(value)
+        || ! round_scaled(std::fabs(value), precision, digits))
+    {
+        return false;
+    }
+
+    if (boost::math::signbit(value))
+    {
+        buffer += '-';
+    }
+    append_decimals(buffer, digits, precision);
+    return true;
+}
+
+
+/*!
+\brief Appends a value as printf writes it with "%.*g"
+\details Returns false if the value is not handled here: values
+    written with an exponent, and precisions above 17
+*/
+inline bool append_general(std::string& buffer, double value, int precision)
+{
+    if (precision == 0)
+    {
+        precision = 1;
+    }
+
+    if (value == 0)
+    {
+        buffer += boost::math::signbit(value) ? "-0" : "0";
+        return true;
+    }
+
+    double const magnitude = std::fabs(value);
+    if (precision > 17
+        || ! boost::math::isfinite(value)
+        || magnitude >= 1.0e17
+        || magnitude < 1.0e-6)
+    {
+        return false;
+    }
+
+    // Find the decimal exponent, such that the value has the number of
+    // significant digits of the precision before the point, if it is
+    // multiplied by 10^(precision - 1 - exponent)
+    double const lower = power_of_ten<double>(precision - 1);
+    double const upper = lower * 10.0;
+    int exponent = static_cast<int>(std::floor(std::log10(magnitude)));
+    for (int i = 0; i < 2; i++)
+    {
+        int const decimals = precision - 1 - exponent;
+        if (decimals < 0 || decimals > fast_path_limits<double>::max_exponent)
+        {
+            return false;
+        }
+        if (scaled_less(magnitude, decimals, lower))
+        {
+            exponent--;
+        }
+        else if (! scaled_less(magnitude, decimals, upper))
+        {
+            exponent++;
+        }
+    }
+
+    // Compare the digits as integers, above 2^53 not all are doubles
+    boost::uint64_t const lower_digits = static_cast<boost::uint64_t>(lower);
+    boost::uint64_t const upper_digits = static_cast<boost::uint64_t>(upper);
+
+    int decimals = precision - 1 - exponent;
+    boost::uint64_t digits;
+    if (decimals < 0
+        || ! round_scaled(magnitude, decimals, digits)
+        || digits < lower_digits)
+    {
+        return false;
+    }
+    if (digits >= upper_digits)
+    {
+        // Rounded up to the next power of ten (e.g. 9.9999999 to 10)
+        exponent++;
+        decimals--;
+        digits /= 10;
+    }
+
+    // Values with these exponents are written in scientific notation
+    if (exponent < -4 || exponent >= precision)
+    {
+        return false;
+    }
+
+    // Remove trailing zeros
+    while (decimals > 0 && digits % 10 == 0)
+    {
+        digits /= 10;
+        decimals--;
+    }
+
+    if (value < 0)
+    {
+        buffer += '-';
+    }
+    append_decimals(buffer, digits, decimals);
+    return true;
+}
+
+
+// Maximum precision written with sprintf into a buffer of 512 characters
+// (fixed notation of the largest double has 309 digits before the point)
+static const int max_print_precision = 150;
+
+//! Appends one floating point value, written by sprintf, independent of
+//! the decimal point of the C locale
+inline void append_printed(std::string& buffer, char const* format,
+                           int precision, double value)
+{
+    char out[512];
+    int const n = std::sprintf(out, format, precision, value);
+    if (n <= 0)
+    {
+        return;
+    }
+
+    char const point = *std::localeconv()->decimal_point;
+    if (point != '.')
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (out[i] == point)
+            {
+                out[i] = '.';
+            }
+        }
+    }
+    buffer.append(out, n);
+}
+
+
+template
+<
+    typename CoordinateType,
+    bool IsFloat = boost::is_same<CoordinateType, double>::value
+                || boost::is_same<CoordinateType, float>::value,
+    bool IsIntegral = boost::is_integral<CoordinateType>::value
+>
+struct coordinate_formatter
+{
+    // Other types (e.g. long double, rational, ttmath): use a stream,
+    // which is what the std::ostream based writer does as well
+    static inline void apply(std::string& buffer, CoordinateType const& value,
+                             coordinate_notation notation, int precision)
+    {
+        stream_format(buffer, value,
+            notation == notation_shortest ? notation_general : notation,
+            notation == notation_shortest
+                ? (std::numeric_limits<CoordinateType>::is_specialized
+                    ? shortest_digits<CoordinateType>::max : 17)
+                : precision);
+    }
+};
+
+template <typename CoordinateType>
+struct coordinate_formatter<CoordinateType, true, false>
+{
+    static inline void apply(std::string& buffer, CoordinateType const& value,
+                             coordinate_notation notation, int precision)
+    {
+        if (notation == notation_shortest)
+        {
+            apply_shortest(buffer, value);
+        }
+        else if (precision > max_print_precision)
+        {
+            stream_format(buffer, value, notation, precision);
+        }
+        else if (notation == notation_fixed)
+        {
+            if (! append_fixed(buffer, value, precision))
+            {
+                append_printed(buffer, "%.*f", precision, value);
+            }
+        }
+        else if (! append_general(buffer, value, precision))
+        {
+            append_printed(buffer, "%.*g", precision, value);
+        }
+    }
+
+private :
+    static inline void apply_shortest(std::string& buffer,
+                                      CoordinateType const& value)
+    {
+        typedef shortest_digits<CoordinateType> limits;
+
+        std::size_t const size = buffer.size();
+        if (boost::math::isfinite(value))
+        {
+            // Write with increasing precision until it reads back the same
+            for (int p = limits::min; p < limits::max; p++)
+            {
+                if (! append_general(buffer, value, p))
+                {
+                    append_printed(buffer, "%.*g", p, value);
+                }
+                if (coordinate_parser<CoordinateType>::apply(
+                        text_range(buffer.data() + size,
+                                   buffer.data() + buffer.size())) == value)
+                {
+                    return;
+                }
+                buffer.resize(size);
+            }
+        }
+        append_printed(buffer, "%.*g", limits::max, value);
+    }
+};
+
+template <typename CoordinateType>
+struct coordinate_formatter<CoordinateType, false, true>
+{
+    static inline void apply(std::string& buffer, CoordinateType const& value,
+                             coordinate_notation notation, int precision)
+    {
+        if (sizeof(CoordinateType) == 1)
+        {
+            // bool and characters are streamed in their own way
+            stream_format(buffer, value, notation, precision);
+        }
+        else if (value < 0)
+        {
+            buffer += '-';
+            // Avoids overflow for the minimum value
+            append_unsigned(buffer,
+                boost::uint64_t(0) - static_cast<boost::uint64_t>(value));
+        }
+        else
+        {
+            append_unsigned(buffer, static_cast<boost::uint64_t>(value));
+        }
+    }
+};
+
+
+/*!
+\brief Output for the WKT writing implementation, appending to a std::string
+\details It has the stream operators used by the implementation, so the
+    same implementation writes to std::ostream and to a string buffer.
+*/
+class buffer_output
+{
+public :
+    inline buffer_output(std::string& buffer,
+                         coordinate_notation notation, int precision)
+        : m_buffer(buffer)
+        , m_notation(notation)
+        , m_precision(precision)
+    {}
+
+    inline buffer_output& operator<<(char const* s)
+    {
+        m_buffer += s;
+        return *this;
+    }
+
+    template <typename CoordinateType>
+    inline buffer_output& operator<<(CoordinateType const& value)
+    {
+        coordinate_formatter<CoordinateType>::apply(m_buffer, value,
+            m_notation, m_precision);
+        return *this;
+    }
+
+private :
+    std::string& m_buffer;
+    coordinate_notation m_notation;
+    int m_precision;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_FORMATTER_HPP
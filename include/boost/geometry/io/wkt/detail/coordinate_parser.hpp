@@ -0,0 +1,254 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
+
+#include <limits>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Parses a decimal number of the form [+-]digits[.digits][(e|E)[+-]digits]
+\details The significant digits are collected in an integer mantissa,
+    the position of the decimal point and the exponent in a power of ten.
+    Returns false if the token has another form, or if the mantissa
+    does not fit in 64 bits.
+*/
+inline bool parse_decimal(text_range const& token,
+                          bool& negative,
+                          boost::uint64_t& mantissa,
+                          int& exponent)
+{
+    char const* it = token.begin();
+    char const* const end = token.end();
+
+    negative = false;
+    mantissa = 0;
+    exponent = 0;
+
+    if (it != end && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    // 10^19 < 2^64, so 19 digits always fit
+    int digits = 0;
+    bool has_digits = false;
+    for (; it != end && *it >= '0' && *it <= '9'; ++it)
+    {
+        has_digits = true;
+        if (mantissa != 0 || *it != '0')
+        {
+            if (++digits > 19)
+            {
+                return false;
+            }
+            mantissa = mantissa * 10 + (*it - '0');
+        }
+    }
+    if (it != end && *it == '.')
+    {
+        for (++it; it != end && *it >= '0' && *it <= '9'; ++it)
+        {
+            has_digits = true;
+            if (mantissa != 0 || *it != '0')
+            {
+                if (++digits > 19)
+                {
+                    return false;
+                }
+                mantissa = mantissa * 10 + (*it - '0');
+            }
+            exponent--;
+        }
+    }
+    if (! has_digits)
+    {
+        return false;
+    }
+
+    if (it != end && (*it == 'e' || *it == 'E'))
+    {
+        ++it;
+        bool negative_exponent = false;
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            negative_exponent = *it == '-';
+            ++it;
+        }
+        if (it == end)
+        {
+            return false;
+        }
+        int e = 0;
+        for (; it != end && *it >= '0' && *it <= '9'; ++it)
+        {
+            if (e > 10000)
+            {
+                return false;
+            }
+            e = e * 10 + (*it - '0');
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+
+    return it == end;
+}
+
+
+// Limits of the exact (Clinger) fast path: the mantissa and the power
+// of ten are both exactly representable, so one multiplication or division
+// gives the correctly rounded result
+template <typename T>
+struct fast_path_limits
+{
+    static const bool enabled = false;
+    static const boost::uint64_t max_mantissa = 0;
+    static const int max_exponent = 0;
+};
+
+template <>
+struct fast_path_limits<double>
+{
+    static const bool enabled = std::numeric_limits<double>::digits == 53
+        && std::numeric_limits<double>::radix == 2;
+    static const boost::uint64_t max_mantissa = boost::uint64_t(1) << 53;
+    static const int max_exponent = 22;
+};
+
+template <>
+struct fast_path_limits<float>
+{
+    static const bool enabled = std::numeric_limits<float>::digits == 24
+        && std::numeric_limits<float>::radix == 2;
+    static const boost::uint64_t max_mantissa = boost::uint64_t(1) << 24;
+    static const int max_exponent = 10;
+};
+
+
+template <typename T>
+inline T power_of_ten(int n)
+{
+    // Exact for the exponents allowed by fast_path_limits
+    T result = 1;
+    T base = 10;
+    for (; n > 0; n >>= 1)
+    {
+        if (n & 1)
+        {
+            result *= base;
+        }
+        base *= base;
+    }
+    return result;
+}
+
+
+template
+<
+    typename CoordinateType,
+    bool IsFloat = fast_path_limits<CoordinateType>::enabled,
+    bool IsIntegral = boost::is_integral<CoordinateType>::value
+>
+struct coordinate_parser
+{
+    // Other types (e.g. long double, rational, ttmath): use coordinate_cast
+    static inline CoordinateType apply(text_range const& token)
+    {
+        return coordinate_cast<CoordinateType>::apply(token.str());
+    }
+};
+
+template <typename CoordinateType>
+struct coordinate_parser<CoordinateType, true, false>
+{
+    typedef fast_path_limits<CoordinateType> limits;
+
+    static inline CoordinateType apply(text_range const& token)
+    {
+        bool negative;
+        boost::uint64_t mantissa;
+        int exponent;
+        if (parse_decimal(token, negative, mantissa, exponent)
+            && mantissa <= limits::max_mantissa
+            && exponent <= limits::max_exponent
+            && exponent >= -limits::max_exponent)
+        {
+            CoordinateType value = static_cast<CoordinateType>(mantissa);
+            if (exponent > 0)
+            {
+                value *= power_of_ten<CoordinateType>(exponent);
+            }
+            else if (exponent < 0)
+            {
+                value /= power_of_ten<CoordinateType>(-exponent);
+            }
+            return negative ? -value : value;
+        }
+
+        // Too many digits, big exponent, nan/inf, or invalid:
+        // coordinate_cast rounds correctly, or throws
+        return coordinate_cast<CoordinateType>::apply(token.str());
+    }
+};
+
+template <typename CoordinateType>
+struct coordinate_parser<CoordinateType, false, true>
+{
+    static inline CoordinateType apply(text_range const& token)
+    {
+        // Fast path for plain integers, without overflow
+        bool negative;
+        boost::uint64_t mantissa;
+        int exponent;
+        if (parse_decimal(token, negative, mantissa, exponent)
+            && exponent == 0
+            && ! boost::is_same<CoordinateType, bool>::value
+            && mantissa <= static_cast<boost::uint64_t>
+                    ((std::numeric_limits<CoordinateType>::max)())
+            && (! negative || boost::is_signed<CoordinateType>::value)
+            && token.end()[-1] >= '0' && token.end()[-1] <= '9')
+        {
+            // Check that no '.' or exponent occurs (e.g. "1." or "1e0")
+            for (char const* it = token.begin(); it != token.end(); ++it)
+            {
+                if (*it == '.' || *it == 'e' || *it == 'E')
+                {
+                    return coordinate_cast<CoordinateType>::apply(token.str());
+                }
+            }
+            CoordinateType const value = static_cast<CoordinateType>(mantissa);
+            return negative ? static_cast<CoordinateType>(-value) : value;
+        }
+        return coordinate_cast<CoordinateType>::apply(token.str());
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_COORDINATE_PARSER_HPP
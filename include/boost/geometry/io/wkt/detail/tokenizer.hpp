@@ -0,0 +1,225 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Refers to (a part of) the WKT text which is parsed, without copying
+\note It is implicitly constructible from std::string, which must
+    outlive it
+*/
+class text_range
+{
+public :
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+
+    inline text_range()
+        : m_begin(NULL)
+        , m_end(NULL)
+    {}
+
+    inline text_range(char const* begin, char const* end)
+        : m_begin(begin)
+        , m_end(end)
+    {}
+
+    inline text_range(std::string const& s)
+        : m_begin(s.data())
+        , m_end(s.data() + s.size())
+    {}
+
+    inline char const* begin() const { return m_begin; }
+    inline char const* end() const { return m_end; }
+    inline std::size_t size() const { return m_end - m_begin; }
+    inline bool empty() const { return m_begin == m_end; }
+
+    inline std::string str() const
+    {
+        return std::string(m_begin, m_end);
+    }
+
+    inline bool operator==(char const* s) const
+    {
+        std::size_t const n = std::strlen(s);
+        return n == size() && std::memcmp(m_begin, s, n) == 0;
+    }
+
+    inline bool operator!=(char const* s) const
+    {
+        return ! operator==(s);
+    }
+
+private :
+    char const* m_begin;
+    char const* m_end;
+};
+
+
+//! Compares a token case-insensitively (ASCII only) with a keyword
+inline bool iequals(text_range const& token, char const* keyword)
+{
+    char const* it = token.begin();
+    for (; it != token.end() && *keyword != '\0'; ++it, ++keyword)
+    {
+        char c = *it;
+        if (c >= 'a' && c <= 'z')
+        {
+            c = c - 'a' + 'A';
+        }
+        char k = *keyword;
+        if (k >= 'a' && k <= 'z')
+        {
+            k = k - 'a' + 'A';
+        }
+        if (c != k)
+        {
+            return false;
+        }
+    }
+    return it == token.end() && *keyword == '\0';
+}
+
+
+/*!
+\brief Iterates through the tokens of a WKT text. Whitespace separates
+    tokens and is skipped, the characters '(', ')' and ',' are tokens
+    on their own. Tokens refer into the text, nothing is copied.
+*/
+class token_iterator
+{
+public :
+    typedef std::forward_iterator_tag iterator_category;
+    typedef text_range value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef text_range const* pointer;
+    typedef text_range const& reference;
+
+    inline token_iterator()
+        : m_end(NULL)
+    {}
+
+    inline token_iterator(char const* begin, char const* end)
+        : m_end(end)
+    {
+        find(begin);
+    }
+
+    inline reference operator*() const { return m_token; }
+    inline pointer operator->() const { return &m_token; }
+
+    inline token_iterator& operator++()
+    {
+        find(m_token.end());
+        return *this;
+    }
+
+    inline token_iterator operator++(int)
+    {
+        token_iterator result = *this;
+        ++*this;
+        return result;
+    }
+
+    inline bool operator==(token_iterator const& other) const
+    {
+        return m_token.begin() == other.m_token.begin();
+    }
+
+    inline bool operator!=(token_iterator const& other) const
+    {
+        return m_token.begin() != other.m_token.begin();
+    }
+
+private :
+    static inline bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static inline bool is_separator(char c)
+    {
+        return c == '(' || c == ')' || c == ',';
+    }
+
+    inline void find(char const* it)
+    {
+        while (it != m_end && is_space(*it))
+        {
+            ++it;
+        }
+        char const* token_end = it;
+        if (it != m_end)
+        {
+            ++token_end;
+            if (! is_separator(*it))
+            {
+                while (token_end != m_end
+                       && ! is_space(*token_end)
+                       && ! is_separator(*token_end))
+                {
+                    ++token_end;
+                }
+            }
+        }
+        m_token = text_range(it, token_end);
+    }
+
+    char const* m_end;
+    text_range m_token;
+};
+
+
+/*!
+\brief Splits a WKT text into tokens, see token_iterator
+*/
+class tokenizer
+{
+public :
+    typedef token_iterator iterator;
+    typedef token_iterator const_iterator;
+
+    explicit inline tokenizer(text_range const& text)
+        : m_text(text)
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_text.begin(), m_text.end());
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_text.end(), m_text.end());
+    }
+
+private :
+    text_range m_text;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
@@ -23,9 +23,7 @@
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
-#include <boost/algorithm/string.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -52,9 +50,9 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
-#include <boost/geometry/util/coordinate_cast.hpp>
-
+#include <boost/geometry/io/wkt/detail/coordinate_parser.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 namespace boost { namespace geometry
 {
@@ -69,24 +67,25 @@ struct read_wkt_exception : public geometry::exception
     read_wkt_exception(std::string const& msg,
                        Iterator const& it,
                        Iterator const& end,
-                       std::string const& wkt)
+                       detail::wkt::text_range const& wkt)
         : message(msg)
-        , wkt(wkt)
+        , wkt(wkt.begin(), wkt.size() > 100 ? wkt.begin() + 100 : wkt.end())
     {
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(it->begin(), it->end());
             source += "'";
         }
-        complete = message + source + " in '" + wkt.substr(0, 100) + "'";
+        complete = message + source + " in '" + this->wkt + "'";
     }
 
-    read_wkt_exception(std::string const& msg, std::string const& wkt)
+    read_wkt_exception(std::string const& msg,
+                       detail::wkt::text_range const& wkt)
         : message(msg)
-        , wkt(wkt)
+        , wkt(wkt.begin(), wkt.size() > 100 ? wkt.begin() + 100 : wkt.end())
     {
-        complete = message + "' in (" + wkt.substr(0, 100) + ")";
+        complete = message + "' in (" + this->wkt + ")";
     }
 
     virtual ~read_wkt_exception() throw() {}
@@ -108,7 +107,6 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
 
 template <typename Point,
           std::size_t Dimension = 0,
@@ -118,7 +116,7 @@ struct parsing_assigner
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
                              Point& point,
-                             std::string const& wkt)
+                             text_range const& wkt)
     {
         typedef typename coordinate_type<Point>::type coordinate_type;
 
@@ -129,13 +127,14 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Parse the token in place. A float or double is computed with
+            // one multiplication or division if its integer mantissa and the
+            // power of ten are both exact (for double: mantissa <= 2^53 and
+            // decimal exponent within [-22, 22]), which rounds correctly.
+            // Other values use coordinate_cast, for correct rounding as well
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(*it));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -161,7 +160,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
     static inline void apply(tokenizer::iterator&,
                              tokenizer::iterator const&,
                              Point&,
-                             std::string const&)
+                             text_range const&)
     {
     }
 };
@@ -171,7 +170,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
 template <typename Iterator>
 inline void handle_open_parenthesis(Iterator& it,
                                     Iterator const& end,
-                                    std::string const& wkt)
+                                    text_range const& wkt)
 {
     if (it == end || *it != "(")
     {
@@ -184,7 +183,7 @@ inline void handle_open_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void handle_close_parenthesis(Iterator& it,
                                      Iterator const& end,
-                                     std::string const& wkt)
+                                     text_range const& wkt)
 {
     if (it != end && *it == ")")
     {
@@ -199,7 +198,7 @@ inline void handle_close_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void check_end(Iterator& it,
                       Iterator const& end,
-                      std::string const& wkt)
+                      text_range const& wkt)
 {
     if (it != end)
     {
@@ -220,7 +219,7 @@ struct container_inserter
     template <typename OutputIterator>
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              OutputIterator out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -316,7 +315,7 @@ struct container_appender
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              Geometry out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -353,7 +352,7 @@ struct point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              P& point)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -368,7 +367,7 @@ struct linestring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              Geometry& geometry)
     {
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
@@ -381,7 +380,7 @@ struct ring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              Ring& ring)
     {
         // A ring should look like polygon((x y,x y,x y...))
@@ -406,7 +405,7 @@ struct polygon_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              Polygon& poly)
     {
 
@@ -448,10 +447,10 @@ struct polygon_parser
 
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   char const* value,
                    bool& is_present)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         is_present = true;
         return true;
@@ -460,11 +459,11 @@ inline bool one_of(tokenizer::iterator const& it,
 }
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   char const* value,
                    bool& present1,
                    bool& present2)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         present1 = true;
         present2 = true;
@@ -503,19 +502,19 @@ inline void handle_empty_z_m(tokenizer::iterator& it,
 
 /*!
 \brief Internal, starts parsing
-\param tokens boost tokens, parsed with separator " " and keeping separator "()"
+\param tokens tokens, separated by whitespace, "(", ")" and ","
 \param geometry string to compare with first token
 */
 template <typename Geometry>
 inline bool initialize(tokenizer const& tokens,
-                       std::string const& geometry_name,
-                       std::string const& wkt,
+                       char const* geometry_name,
+                       text_range const& wkt,
                        tokenizer::iterator& it,
                        tokenizer::iterator& end)
 {
     it = tokens.begin();
     end = tokens.end();
-    if (it != end && boost::iequals(*it++, geometry_name))
+    if (it != end && iequals(*it++, geometry_name))
     {
         bool has_empty, has_z, has_m;
 
@@ -552,11 +551,11 @@ inline bool initialize(tokenizer const& tokens,
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(text_range const& wkt, Geometry& geometry)
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<Geometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -570,11 +569,11 @@ struct geometry_parser
 template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
 struct multi_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(text_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -607,7 +606,7 @@ struct noparenthesis_point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             text_range const& wkt,
                              P& point)
     {
         parsing_assigner<P>::apply(it, end, point, wkt);
@@ -617,11 +616,11 @@ struct noparenthesis_point_parser
 template <typename MultiGeometry, typename PrefixPolicy>
 struct multi_point_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(text_range const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
 
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
@@ -677,13 +676,13 @@ struct multi_point_parser
 template <typename Box>
 struct box_parser
 {
-    static inline void apply(std::string const& wkt, Box& box)
+    static inline void apply(text_range const& wkt, Box& box)
     {
         bool should_close = false;
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
-        if (it != end && boost::iequals(*it, "POLYGON"))
+        if (it != end && iequals(*it, "POLYGON"))
         {
             ++it;
             bool has_empty, has_z, has_m;
@@ -696,7 +695,7 @@ struct box_parser
             handle_open_parenthesis(it, end, wkt);
             should_close = true;
         }
-        else if (it != end && boost::iequals(*it, "BOX"))
+        else if (it != end && iequals(*it, "BOX"))
         {
             ++it;
         }
@@ -747,14 +746,14 @@ struct box_parser
 template <typename Segment>
 struct segment_parser
 {
-    static inline void apply(std::string const& wkt, Segment& segment)
+    static inline void apply(text_range const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end &&
-            (boost::iequals(*it, "SEGMENT")
-            || boost::iequals(*it, "LINESTRING") ))
+            (iequals(*it, "SEGMENT")
+            || iequals(*it, "LINESTRING") ))
         {
             ++it;
         }
@@ -898,6 +897,26 @@ inline void read_wkt(std::string const& wkt, Geometry& geometry)
     dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(wkt, geometry);
 }
 
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) into a geometry (any geometry)
+\ingroup wkt
+\details The text is parsed in place, it is not copied and not
+    tokenized into separate strings
+\tparam Geometry \tparam_geometry
+\param begin pointer to the first character of the \ref WKT
+\param end pointer past the last character of the \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_wkt(char const* begin, char const* end, Geometry& geometry)
+{
+    geometry::concept::check<Geometry>();
+    dispatch::read_wkt
+        <
+            typename tag<Geometry>::type, Geometry
+        >::apply(detail::wkt::text_range(begin, end), geometry);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_WKT_READ_HPP
@@ -43,6 +43,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/geometries/ring.hpp>
 
+#include <boost/geometry/io/wkt/detail/coordinate_formatter.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 
@@ -62,8 +63,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -73,8 +74,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -110,8 +111,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -126,8 +127,8 @@ struct wkt_point
 template <typename Range, typename PrefixPolicy, typename SuffixPolicy>
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closed)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -164,8 +165,8 @@ struct wkt_range
         os << SuffixPolicy::apply();
     }
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range)
     {
         apply(os, range, false);
@@ -192,8 +193,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -219,8 +220,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry)
     {
         os << PrefixPolicy::apply();
@@ -248,8 +249,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box)
     {
         // Convert to ring, then stream
@@ -276,8 +277,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment)
     {
         // Convert to two points, then stream
@@ -506,6 +507,89 @@ inline wkt_manipulator<Geometry> wkt(Geometry const& geometry)
     return wkt_manipulator<Geometry>(geometry);
 }
 
+/*!
+\brief Writes geometries as \ref WKT into a string buffer, without std::ostream
+\ingroup wkt
+\details The writer formats coordinates itself, avoiding the overhead of
+    stream formatting and locales. It can be reused for many geometries.
+    Floating point coordinates are written in one of the notations:
+    - general: as std::ostream writes by default, with the specified
+      precision (6 by default, like std::ostream)
+    - fixed: as std::ostream writes with std::fixed and the precision
+    - shortest: with the fewest significant digits (of 15, 16 or 17 for
+      double) that read back to the same coordinate value
+    In general and fixed notation, the output is identical to the output
+    of the wkt manipulator, streamed with the same precision and notation
+    into a stream with the classic locale.
+\par Example:
+\code
+wkt_writer writer(wkt_writer::shortest);
+std::string buffer;
+for (...)
+{
+    writer.append(polygon, buffer);
+    buffer += '\n';
+}
+\endcode
+*/
+class wkt_writer
+{
+public :
+    enum notation
+    {
+        general = detail::wkt::notation_general,
+        fixed = detail::wkt::notation_fixed,
+        shortest = detail::wkt::notation_shortest
+    };
+
+    explicit inline wkt_writer(int precision = 6)
+        : m_notation(general)
+        , m_precision(precision)
+    {}
+
+    explicit inline wkt_writer(notation n, int precision = 6)
+        : m_notation(n)
+        , m_precision(precision)
+    {}
+
+    inline notation get_notation() const { return m_notation; }
+    inline int precision() const { return m_precision; }
+
+    /*!
+    \brief Appends the WKT of a geometry to a buffer
+    \param geometry \param_geometry
+    \param buffer string to which the WKT is appended
+    */
+    template <typename Geometry>
+    inline void append(Geometry const& geometry, std::string& buffer) const
+    {
+        concept::check<Geometry const>();
+
+        detail::wkt::buffer_output output(buffer,
+            static_cast<detail::wkt::coordinate_notation>(m_notation),
+            m_precision);
+        dispatch::devarianted_wkt<Geometry>::apply(output, geometry);
+    }
+
+    /*!
+    \brief Returns the WKT of a geometry
+    \details The returned string is a buffer owned by the writer, which is
+        reused (and overwritten) by the next call
+    */
+    template <typename Geometry>
+    inline std::string const& write(Geometry const& geometry)
+    {
+        m_buffer.clear();
+        append(geometry, m_buffer);
+        return m_buffer;
+    }
+
+private :
+    notation m_notation;
+    int m_precision;
+    std::string m_buffer;
+};
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
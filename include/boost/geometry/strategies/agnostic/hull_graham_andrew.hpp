@@ -59,12 +59,17 @@ struct get_extremes
 {
     typedef typename point_type<InputRange>::type point_type;
 
-    point_type left, right;
+    // left/right are the extremes w.r.t. the specified predicates,
+    // bottom/top are the extremes in the second dimension. Together they
+    // form a quadrilateral inside the hull, used for prefiltering.
+    point_type left, right, bottom, top;
 
     bool first;
 
     StrategyLess less;
     StrategyGreater greater;
+    geometry::less<point_type, 1> less_y;
+    geometry::greater<point_type, 1> greater_y;
 
     inline get_extremes()
         : first(true)
@@ -85,6 +90,8 @@ struct get_extremes
 
         RangeIterator left_it = boost::begin(range);
         RangeIterator right_it = boost::begin(range);
+        RangeIterator bottom_it = boost::begin(range);
+        RangeIterator top_it = boost::begin(range);
 
         for (RangeIterator it = boost::begin(range) + 1;
             it != boost::end(range);
@@ -99,6 +106,16 @@ struct get_extremes
             {
                 right_it = it;
             }
+
+            if (less_y(*it, *bottom_it))
+            {
+                bottom_it = it;
+            }
+
+            if (greater_y(*it, *top_it))
+            {
+                top_it = it;
+            }
         }
 
         // Then compare with earlier
@@ -107,6 +124,8 @@ struct get_extremes
             // First time, assign left/right
             left = *left_it;
             right = *right_it;
+            bottom = *bottom_it;
+            top = *top_it;
             first = false;
         }
         else
@@ -122,6 +141,16 @@ struct get_extremes
             {
                 right = *right_it;
             }
+
+            if (less_y(*bottom_it, bottom))
+            {
+                bottom = *bottom_it;
+            }
+
+            if (greater_y(*top_it, top))
+            {
+                top = *top_it;
+            }
         }
     }
 };
@@ -142,10 +171,15 @@ struct assign_range
 
     point_type const& most_left;
     point_type const& most_right;
+    point_type const& most_bottom;
+    point_type const& most_top;
 
-    inline assign_range(point_type const& left, point_type const& right)
+    inline assign_range(point_type const& left, point_type const& right,
+                        point_type const& bottom, point_type const& top)
         : most_left(left)
         , most_right(right)
+        , most_bottom(bottom)
+        , most_top(top)
     {}
 
     inline void apply(InputRange const& range)
@@ -163,10 +197,21 @@ struct assign_range
             switch(dir)
             {
                 case 1 : // left side
-                    upper_points.push_back(*it);
+                    // Points strictly inside the triangle left-top-right
+                    // can never be part of the hull (Akl-Toussaint)
+                    if (side::apply(most_left, most_top, *it) != -1
+                        || side::apply(most_top, most_right, *it) != -1)
+                    {
+                        upper_points.push_back(*it);
+                    }
                     break;
                 case -1 : // right side
-                    lower_points.push_back(*it);
+                    // Similarly for the triangle left-bottom-right
+                    if (side::apply(most_left, most_bottom, *it) != 1
+                        || side::apply(most_bottom, most_right, *it) != 1)
+                    {
+                        lower_points.push_back(*it);
+                    }
                     break;
 
                 // 0: on line most_left-most_right,
@@ -259,14 +304,17 @@ public:
 
         // Bounding left/right points
         // Second pass, now that extremes are found, assign all points
-        // in either lower, either upper
+        // in either lower, either upper. Points inside the quadrilateral
+        // formed by the extremes are skipped, they are inside the hull
+        // and this saves copying and sorting them.
         detail::assign_range
             <
                 range_type,
                 range_iterator,
                 container_type,
                 typename strategy::side::services::default_strategy<cs_tag>::type
-            > assigner(extremes.left, extremes.right);
+            > assigner(extremes.left, extremes.right,
+                       extremes.bottom, extremes.top);
 
         geometry::detail::for_each_range(geometry, assigner);
 
@@ -20,6 +20,7 @@
 
 
 #include <cstddef>
+#include <utility>
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
@@ -119,43 +120,16 @@ namespace detail
             return *this;
         }
 
-        inline void consider(iterator_type begin,
-                             iterator_type end,
-                             distance_type const& max_dist,
-                             int& n,
-                             distance_strategy_type const& ps_distance_strategy) const
+        // Finds the point between begin and last which is the farthest
+        // from the segment (begin, last). Returns last if none is found.
+        // The first point having the maximum distance is returned
+        inline iterator_type farthest(iterator_type begin,
+                                      iterator_type last,
+                                      distance_type& md,
+                                      distance_strategy_type const& ps_distance_strategy) const
         {
-            std::size_t size = end - begin;
-
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
-            {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
-                {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
-                }
-                std::cout << "return because size=" << size << std::endl;
-#endif
-                return;
-            }
-
-            iterator_type last = end - 1;
-
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
-#endif
-
-
-            // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
+            md = distance_type(-1.0); // any value < 0
+            iterator_type candidate = last;
             for(iterator_type it = begin + 1; it != last; ++it)
             {
                 distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
@@ -163,9 +137,7 @@ namespace detail
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
                 std::cout << "consider " << dsv(it->p)
                     << " at " << double(dist)
-                    << ((dist > max_dist) ? " maybe" : " no")
                     << std::endl;
-
 #endif
                 if ( less()(md, dist) )
                 {
@@ -173,20 +145,68 @@ namespace detail
                     candidate = it;
                 }
             }
+            return candidate;
+        }
 
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
-            if ( less()(max_dist, md) )
+        // Handles the range [begin, end) iteratively. Instead of recursing
+        // into both halves the pending sub-ranges are kept on an explicit
+        // stack, so very long ranges cannot exhaust the call stack.
+        // The sub-ranges are independent, so the order in which they are
+        // processed does not influence the result.
+        inline void consider(iterator_type begin,
+                             iterator_type end,
+                             distance_type const& max_dist,
+                             int& n,
+                             distance_strategy_type const& ps_distance_strategy) const
+        {
+            typedef std::pair<iterator_type, iterator_type> sub_range_type;
+            std::vector<sub_range_type> stack;
+            stack.push_back(sub_range_type(begin, end));
+
+            while (! stack.empty())
             {
+                sub_range_type const sub_range = stack.back();
+                stack.pop_back();
+
+                std::size_t size = sub_range.second - sub_range.first;
+
+                // size must be at least 3
+                // because we want to consider a candidate point in between
+                if (size <= 2)
+                {
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+                    std::cout << "return because size=" << size << std::endl;
+#endif
+                    continue;
+                }
+
+                iterator_type last = sub_range.second - 1;
+
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+                std::cout << "find between " << dsv(sub_range.first->p)
+                    << " and " << dsv(last->p)
+                    << " size=" << size << std::endl;
+#endif
+
+                // Find most far point, compare to the current segment
+                distance_type md;
+                iterator_type candidate = farthest(sub_range.first, last,
+                                                   md, ps_distance_strategy);
+
+                // If a point is found, set the include flag
+                // and handle segments in between later
+                if ( less()(max_dist, md) )
+                {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
+                    std::cout << "use " << dsv(candidate->p) << std::endl;
 #endif
 
-                candidate->included = true;
-                n++;
+                    candidate->included = true;
+                    n++;
 
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
+                    stack.push_back(sub_range_type(candidate, sub_range.second));
+                    stack.push_back(sub_range_type(sub_range.first, candidate + 1));
+                }
             }
         }
 
@@ -0,0 +1,170 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_INTERSECTION_BATCH_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_INTERSECTION_BATCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace strategy { namespace intersection
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+/*!
+\brief True if relate_cartesian_segments calculates the sides of points of
+    this coordinate type in double precision (then segment_batch_filter can
+    be used)
+*/
+template <typename CoordinateType>
+struct is_batch_filter_coordinate
+    : boost::mpl::bool_
+        <
+            boost::is_integral<CoordinateType>::value
+            || boost::is_same<CoordinateType, float>::value
+            || boost::is_same<CoordinateType, double>::value
+        >
+{};
+
+
+/*!
+\brief Filters pairs of segments which are certainly disjoint, for one
+    segment (a) against n segments (b), given in separate coordinate arrays
+\details relate_cartesian_segments returns disjoint without calculating an
+    intersection if both points of one segment are at the same side of the
+    other segment. The filter calculates these four sides for all pairs
+    in a branch free loop, which the compiler can vectorize.
+    A pair is only marked as disjoint if both sides of one segment exceed
+    a margin, which covers the epsilon of side_by_triangle and the rounding
+    errors of both calculations (their determinants can differ in the order
+    of the points). Then the strategy also returns disjoint. Other pairs,
+    including touching, intersecting and (nearly) collinear pairs, are
+    marked as not disjoint and should be related by the strategy.
+    Coordinates must be those passed to the strategy (so robust coordinates,
+    if rescaled), see is_batch_filter_coordinate.
+*/
+struct segment_batch_filter
+{
+    static inline void apply(double ax1, double ay1, double ax2, double ay2,
+            double const* bx1, double const* by1,
+            double const* bx2, double const* by2,
+            std::size_t count,
+            unsigned char* disjoint)
+    {
+        double const eps = std::numeric_limits<double>::epsilon();
+        double const dx_a = ax2 - ax1;
+        double const dy_a = ay2 - ay1;
+        double const max_a = (std::max)(std::fabs(dx_a), std::fabs(dy_a));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double const dx_b = bx2[i] - bx1[i];
+            double const dy_b = by2[i] - by1[i];
+
+            // Vector from the first point of b to the first point of a
+            double const x = ax1 - bx1[i];
+            double const y = ay1 - by1[i];
+
+            // Sides of a1, a2 with respect to b, and of b1, b2 w.r.t. a
+            double const s1 = dx_b * y - dy_b * x;
+            double const s2 = dx_b * (y + dy_a) - dy_b * (x + dx_a);
+            double const s3 = dy_a * x - dx_a * y;
+            double const s4 = dx_a * (dy_b - y) - dy_a * (dx_b - x);
+
+            // All coordinate differences between the four points are
+            // smaller than 3 * m
+            double const m = (std::max)((std::max)(max_a,
+                    (std::max)(std::fabs(dx_b), std::fabs(dy_b))),
+                    (std::max)(std::fabs(x), std::fabs(y)));
+
+            // Epsilon of equals_by_policy (factor < 3m) and the rounding
+            // errors of both determinants (each below 36 eps m^2), doubled
+            double const margin = eps * (144.0 * m * m + 6.0 * m + 2.0);
+
+            int const a_at_same_side = ((s1 > margin) & (s2 > margin))
+                | ((s1 < -margin) & (s2 < -margin));
+            int const b_at_same_side = ((s3 > margin) & (s4 > margin))
+                | ((s3 < -margin) & (s4 < -margin));
+
+            // For NaN or infinite coordinates the comparisons are false
+            disjoint[i] = static_cast<unsigned char>(a_at_same_side | b_at_same_side);
+        }
+    }
+};
+
+
+/*!
+\brief Robust coordinates of (a part of) a range of segments, for
+    segment_batch_filter. The capacity is fixed, no memory is allocated
+*/
+template <std::size_t Capacity>
+struct segment_batch
+{
+    segment_batch()
+        : count(0)
+    {}
+
+    inline bool full() const
+    {
+        return count >= Capacity;
+    }
+
+    template <typename Point1, typename Point2>
+    inline void push_back(Point1 const& p1, Point2 const& p2)
+    {
+        x1[count] = geometry::get<0>(p1);
+        y1[count] = geometry::get<1>(p1);
+        x2[count] = geometry::get<0>(p2);
+        y2[count] = geometry::get<1>(p2);
+        count++;
+    }
+
+    // Sets disjoint[i] for all segments, see segment_batch_filter
+    template <typename Point1, typename Point2>
+    inline void filter(Point1 const& a1, Point2 const& a2,
+                       unsigned char* disjoint) const
+    {
+        segment_batch_filter::apply(geometry::get<0>(a1), geometry::get<1>(a1),
+                                    geometry::get<0>(a2), geometry::get<1>(a2),
+                                    x1, y1, x2, y2, count, disjoint);
+    }
+
+    double x1[Capacity];
+    double y1[Capacity];
+    double x2[Capacity];
+    double y2[Capacity];
+    std::size_t count;
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace strategy::intersection
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_INTERSECTION_BATCH_HPP
@@ -0,0 +1,131 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
+
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_void.hpp>
+
+#include <boost/geometry/arithmetic/determinant.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/precise_math.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+#include <boost/geometry/strategies/side.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace side
+{
+
+/*!
+\brief Check at which side of a segment a point lies:
+    left of segment (> 0), right of segment (< 0), on segment (0).
+    The side is exact for floating point coordinates
+\ingroup strategies
+\tparam CalculationType \tparam_calculation
+\details Unlike side_by_triangle, no epsilon is used: the side is only
+    zero if the point is exactly on the (infinite) line through the segment.
+    A floating point filter decides the side of almost all points as fast
+    as side_by_triangle. Only nearly collinear points are evaluated
+    adaptively (see util/precise_math.hpp), so the input does not need
+    to be rescaled (get_rescale_policy) to get consistent sides.
+    For integral or user defined coordinate types the determinant is
+    calculated as by side_by_triangle, which is exact if it does not
+    overflow.
+ */
+template <typename CalculationType = void>
+class side_robust
+{
+    template <typename PromotedType, bool IsFloatingPoint>
+    struct compute_side_value
+    {
+        template <typename P1, typename P2, typename P>
+        static inline PromotedType apply(P1 const& p1, P2 const& p2, P const& p)
+        {
+            return geometry::detail::precise_math::orient2d
+                <
+                    PromotedType
+                >(get<0>(p1), get<1>(p1),
+                  get<0>(p2), get<1>(p2),
+                  get<0>(p), get<1>(p));
+        }
+    };
+
+    template <typename PromotedType>
+    struct compute_side_value<PromotedType, false>
+    {
+        template <typename P1, typename P2, typename P>
+        static inline PromotedType apply(P1 const& p1, P2 const& p2, P const& p)
+        {
+            PromotedType const x = get<0>(p);
+            PromotedType const y = get<1>(p);
+            PromotedType const sx1 = get<0>(p1);
+            PromotedType const sy1 = get<1>(p1);
+            PromotedType const sx2 = get<0>(p2);
+            PromotedType const sy2 = get<1>(p2);
+
+            return geometry::detail::determinant<PromotedType>
+                (
+                    sx2 - sx1, sy2 - sy1,
+                    x - sx1, y - sy1
+                );
+        }
+    };
+
+public :
+
+    template <typename P1, typename P2, typename P>
+    static inline int apply(P1 const& p1, P2 const& p2, P const& p)
+    {
+        typedef typename boost::mpl::if_c
+            <
+                boost::is_void<CalculationType>::type::value,
+                typename select_most_precise
+                    <
+                        typename select_most_precise
+                            <
+                                typename coordinate_type<P1>::type,
+                                typename coordinate_type<P2>::type
+                            >::type,
+                        typename coordinate_type<P>::type
+                    >::type,
+                CalculationType
+            >::type coordinate_type;
+
+        // Promote float->double, small int->int
+        typedef typename select_most_precise
+            <
+                coordinate_type,
+                double
+            >::type promoted_type;
+
+        promoted_type const s = compute_side_value
+            <
+                promoted_type,
+                boost::is_floating_point<promoted_type>::value
+            >::apply(p1, p2, p);
+
+        promoted_type const zero = promoted_type();
+        return s > zero ? 1
+            : s < zero ? -1
+            : 0;
+    }
+};
+
+
+}} // namespace strategy::side
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_SIDE_ROBUST_HPP
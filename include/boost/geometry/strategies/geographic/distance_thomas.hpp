@@ -15,6 +15,8 @@
 #define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_THOMAS_HPP
 
 
+#include <iterator>
+
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 
@@ -24,6 +26,7 @@
 #include <boost/geometry/util/select_calculation_type.hpp>
 
 #include <boost/geometry/algorithms/detail/thomas_inverse.hpp>
+#include <boost/geometry/algorithms/detail/inverse_batch.hpp>
 
 namespace boost { namespace geometry
 {
@@ -89,6 +92,31 @@ public :
                          m_spheroid).distance;
     }
 
+    /*!
+    \brief Calculates the distances between pairs of points, in batches
+    \details The pairs are formed by the points of [first1, last1) and the
+        points starting at first2. The results are the same as calling apply
+        for each pair, but they are calculated per block of pairs, which
+        is faster for large numbers of points.
+    \return The output iterator, after the last distance written
+    */
+    template <typename Iterator1, typename Iterator2, typename OutputIterator>
+    inline OutputIterator apply_batch(Iterator1 first1, Iterator1 last1,
+                                      Iterator2 first2, OutputIterator out) const
+    {
+        typedef typename calculation_type
+            <
+                typename std::iterator_traits<Iterator1>::value_type,
+                typename std::iterator_traits<Iterator2>::value_type
+            >::type calculation_type;
+
+        return geometry::detail::inverse_batch_distances
+            <
+                geometry::detail::thomas_inverse<calculation_type, true, false>,
+                calculation_type
+            >::apply(first1, last1, first2, out, m_spheroid);
+    }
+
     inline Spheroid const& model() const
     {
         return m_spheroid;
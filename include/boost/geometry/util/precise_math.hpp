@@ -0,0 +1,377 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
+#define BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
+
+#include <cstddef>
+#include <limits>
+
+// The following code is based on "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates" by Richard Shewchuk,
+// J. Discrete Comput Geom (1997) 18: 305. https://doi.org/10.1007/PL00009321
+//
+// It assumes IEEE arithmetic with round to nearest, without extended
+// precision for intermediate results (e.g. x87) and without contraction
+// of a * b + c to fused multiply-add. Options such as -ffast-math break it.
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace precise_math
+{
+
+template <typename RealNumber>
+struct constants
+{
+    // Half of the machine epsilon: the largest relative rounding error
+    static inline RealNumber epsilon()
+    {
+        return std::numeric_limits<RealNumber>::epsilon() / 2;
+    }
+
+    // Splits a number in two halves of digits / 2 bits: 2^ceil(p/2) + 1
+    static inline RealNumber splitter()
+    {
+        int const half = (std::numeric_limits<RealNumber>::digits + 1) / 2;
+        RealNumber result = 1;
+        for (int i = 0; i < half; i++)
+        {
+            result *= 2;
+        }
+        return result + 1;
+    }
+
+    // Error bounds of the orientation test
+    static inline RealNumber orient2d_bound_a()
+    {
+        RealNumber const eps = epsilon();
+        return (3 + 16 * eps) * eps;
+    }
+
+    static inline RealNumber orient2d_bound_b()
+    {
+        RealNumber const eps = epsilon();
+        return (2 + 12 * eps) * eps;
+    }
+
+    static inline RealNumber orient2d_bound_c()
+    {
+        RealNumber const eps = epsilon();
+        return (9 + 64 * eps) * eps * eps;
+    }
+
+    static inline RealNumber result_bound()
+    {
+        RealNumber const eps = epsilon();
+        return (3 + 8 * eps) * eps;
+    }
+};
+
+// x + y == a + b, exactly, if |a| >= |b|
+template <typename RealNumber>
+inline void fast_two_sum(RealNumber const& a, RealNumber const& b,
+                         RealNumber& x, RealNumber& y)
+{
+    x = a + b;
+    RealNumber const b_virtual = x - a;
+    y = b - b_virtual;
+}
+
+// x + y == a + b, exactly
+template <typename RealNumber>
+inline void two_sum(RealNumber const& a, RealNumber const& b,
+                    RealNumber& x, RealNumber& y)
+{
+    x = a + b;
+    RealNumber const b_virtual = x - a;
+    RealNumber const a_virtual = x - b_virtual;
+    RealNumber const b_roundoff = b - b_virtual;
+    RealNumber const a_roundoff = a - a_virtual;
+    y = a_roundoff + b_roundoff;
+}
+
+// Roundoff y of x = a - b, such that x + y == a - b, exactly
+template <typename RealNumber>
+inline RealNumber two_diff_tail(RealNumber const& a, RealNumber const& b,
+                                RealNumber const& x)
+{
+    RealNumber const b_virtual = a - x;
+    RealNumber const a_virtual = x + b_virtual;
+    RealNumber const b_roundoff = b_virtual - b;
+    RealNumber const a_roundoff = a - a_virtual;
+    return a_roundoff + b_roundoff;
+}
+
+// x + y == a - b, exactly
+template <typename RealNumber>
+inline void two_diff(RealNumber const& a, RealNumber const& b,
+                     RealNumber& x, RealNumber& y)
+{
+    x = a - b;
+    y = two_diff_tail(a, b, x);
+}
+
+// high + low == a, both with at most half of the digits
+template <typename RealNumber>
+inline void split(RealNumber const& a, RealNumber& high, RealNumber& low)
+{
+    RealNumber const c = constants<RealNumber>::splitter() * a;
+    RealNumber const a_big = c - a;
+    high = c - a_big;
+    low = a - high;
+}
+
+// x + y == a * b, exactly
+template <typename RealNumber>
+inline void two_product(RealNumber const& a, RealNumber const& b,
+                        RealNumber& x, RealNumber& y)
+{
+    x = a * b;
+    RealNumber a_high, a_low, b_high, b_low;
+    split(a, a_high, a_low);
+    split(b, b_high, b_low);
+    RealNumber const err1 = x - (a_high * b_high);
+    RealNumber const err2 = err1 - (a_low * b_high);
+    RealNumber const err3 = err2 - (a_high * b_low);
+    y = (a_low * b_low) - err3;
+}
+
+// Expansion x (x[0] smallest) of (a1 + a0) - (b1 + b0), exactly
+template <typename RealNumber>
+inline void two_two_diff(RealNumber const& a1, RealNumber const& a0,
+                         RealNumber const& b1, RealNumber const& b0,
+                         RealNumber x[4])
+{
+    RealNumber i, j, k;
+    two_diff(a0, b0, i, x[0]);
+    two_sum(a1, i, j, k);
+    two_diff(k, b1, i, x[1]);
+    two_sum(j, i, x[3], x[2]);
+}
+
+// Sum of two expansions, without zero components. Returns the number of
+// components of h, which must have room for e_length + f_length components
+template <typename RealNumber>
+inline std::size_t fast_expansion_sum_zeroelim(
+        std::size_t e_length, RealNumber const* e,
+        std::size_t f_length, RealNumber const* f,
+        RealNumber* h)
+{
+    std::size_t e_index = 0;
+    std::size_t f_index = 0;
+    std::size_t h_index = 0;
+    RealNumber e_now = e[0];
+    RealNumber f_now = f[0];
+    RealNumber q, q_new, hh;
+
+    // Components are taken in order of increasing magnitude
+    if ((f_now > e_now) == (f_now > -e_now))
+    {
+        q = e_now;
+        if (++e_index < e_length) { e_now = e[e_index]; }
+    }
+    else
+    {
+        q = f_now;
+        if (++f_index < f_length) { f_now = f[f_index]; }
+    }
+
+    if (e_index < e_length && f_index < f_length)
+    {
+        if ((f_now > e_now) == (f_now > -e_now))
+        {
+            fast_two_sum(e_now, q, q_new, hh);
+            if (++e_index < e_length) { e_now = e[e_index]; }
+        }
+        else
+        {
+            fast_two_sum(f_now, q, q_new, hh);
+            if (++f_index < f_length) { f_now = f[f_index]; }
+        }
+        q = q_new;
+        if (hh != 0)
+        {
+            h[h_index++] = hh;
+        }
+
+        while (e_index < e_length && f_index < f_length)
+        {
+            if ((f_now > e_now) == (f_now > -e_now))
+            {
+                two_sum(q, e_now, q_new, hh);
+                if (++e_index < e_length) { e_now = e[e_index]; }
+            }
+            else
+            {
+                two_sum(q, f_now, q_new, hh);
+                if (++f_index < f_length) { f_now = f[f_index]; }
+            }
+            q = q_new;
+            if (hh != 0)
+            {
+                h[h_index++] = hh;
+            }
+        }
+    }
+
+    while (e_index < e_length)
+    {
+        two_sum(q, e_now, q_new, hh);
+        if (++e_index < e_length) { e_now = e[e_index]; }
+        q = q_new;
+        if (hh != 0)
+        {
+            h[h_index++] = hh;
+        }
+    }
+
+    while (f_index < f_length)
+    {
+        two_sum(q, f_now, q_new, hh);
+        if (++f_index < f_length) { f_now = f[f_index]; }
+        q = q_new;
+        if (hh != 0)
+        {
+            h[h_index++] = hh;
+        }
+    }
+
+    if (q != 0 || h_index == 0)
+    {
+        h[h_index++] = q;
+    }
+    return h_index;
+}
+
+// Exact continuation of orient2d, if its filter could not decide the sign
+template <typename RealNumber>
+inline RealNumber orient2d_adapt(RealNumber const& ax, RealNumber const& ay,
+                                 RealNumber const& bx, RealNumber const& by,
+                                 RealNumber const& cx, RealNumber const& cy,
+                                 RealNumber const& detsum)
+{
+    typedef constants<RealNumber> c;
+
+    RealNumber const acx = ax - cx;
+    RealNumber const bcx = bx - cx;
+    RealNumber const acy = ay - cy;
+    RealNumber const bcy = by - cy;
+
+    RealNumber det_left, det_left_tail, det_right, det_right_tail;
+    two_product(acx, bcy, det_left, det_left_tail);
+    two_product(acy, bcx, det_right, det_right_tail);
+
+    RealNumber b[4];
+    two_two_diff(det_left, det_left_tail, det_right, det_right_tail, b);
+
+    RealNumber det = b[0] + b[1] + b[2] + b[3];
+    RealNumber error_bound = c::orient2d_bound_b() * detsum;
+    if (det >= error_bound || -det >= error_bound)
+    {
+        return det;
+    }
+
+    RealNumber const acx_tail = two_diff_tail(ax, cx, acx);
+    RealNumber const bcx_tail = two_diff_tail(bx, cx, bcx);
+    RealNumber const acy_tail = two_diff_tail(ay, cy, acy);
+    RealNumber const bcy_tail = two_diff_tail(by, cy, bcy);
+
+    if (acx_tail == 0 && acy_tail == 0 && bcx_tail == 0 && bcy_tail == 0)
+    {
+        // The differences were exact, so is the determinant
+        return det;
+    }
+
+    error_bound = c::orient2d_bound_c() * detsum
+        + c::result_bound() * (det >= 0 ? det : -det);
+    det += (acx * bcy_tail + bcy * acx_tail)
+         - (acy * bcx_tail + bcx * acy_tail);
+    if (det >= error_bound || -det >= error_bound)
+    {
+        return det;
+    }
+
+    RealNumber s1, s0, t1, t0;
+    RealNumber u[4];
+    RealNumber c1[8], c2[12], d[16];
+
+    two_product(acx_tail, bcy, s1, s0);
+    two_product(acy_tail, bcx, t1, t0);
+    two_two_diff(s1, s0, t1, t0, u);
+    std::size_t const c1_length = fast_expansion_sum_zeroelim(4, b, 4, u, c1);
+
+    two_product(acx, bcy_tail, s1, s0);
+    two_product(acy, bcx_tail, t1, t0);
+    two_two_diff(s1, s0, t1, t0, u);
+    std::size_t const c2_length = fast_expansion_sum_zeroelim(c1_length, c1, 4, u, c2);
+
+    two_product(acx_tail, bcy_tail, s1, s0);
+    two_product(acy_tail, bcx_tail, t1, t0);
+    two_two_diff(s1, s0, t1, t0, u);
+    std::size_t const d_length = fast_expansion_sum_zeroelim(c2_length, c2, 4, u, d);
+
+    // The largest component has the sign of the expansion
+    return d[d_length - 1];
+}
+
+/*!
+\brief Orientation of a, b and c, with the exact sign:
+    positive if they are counterclockwise, negative if clockwise, zero if
+    collinear. The value approximates twice the signed area of the triangle
+\details A floating point filter decides the sign for almost all input.
+    Only if its error bound is exceeded, the determinant is evaluated
+    adaptively, with as many exact terms as necessary.
+*/
+template <typename RealNumber>
+inline RealNumber orient2d(RealNumber const& ax, RealNumber const& ay,
+                           RealNumber const& bx, RealNumber const& by,
+                           RealNumber const& cx, RealNumber const& cy)
+{
+    RealNumber const det_left = (ax - cx) * (by - cy);
+    RealNumber const det_right = (ay - cy) * (bx - cx);
+    RealNumber const det = det_left - det_right;
+
+    RealNumber detsum;
+    if (det_left > 0)
+    {
+        if (det_right <= 0)
+        {
+            return det;
+        }
+        detsum = det_left + det_right;
+    }
+    else if (det_left < 0)
+    {
+        if (det_right >= 0)
+        {
+            return det;
+        }
+        detsum = -det_left - det_right;
+    }
+    else
+    {
+        return det;
+    }
+
+    RealNumber const error_bound = constants<RealNumber>::orient2d_bound_a() * detsum;
+    if (det >= error_bound || -det >= error_bound)
+    {
+        return det;
+    }
+
+    return orient2d_adapt(ax, ay, bx, by, cx, cy, detsum);
+}
+
+}} // namespace detail::precise_math
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_UTIL_PRECISE_MATH_HPP
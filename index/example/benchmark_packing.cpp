@@ -0,0 +1,164 @@
+// Boost.Geometry Index
+// Additional tests
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the packing algorithms of the rtree: the time of the creation and of
+// spatial and knn queries, and the number of nodes visited by the queries,
+// for uniformly distributed and for clustered values (e.g. points of interest
+// in cities).
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+
+namespace bg = boost::geometry;
+namespace bgi = bg::index;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+typedef bg::model::box<P> B;
+typedef bgi::rtree<B, bgi::linear<16, 4> > RT;
+
+typedef boost::chrono::thread_clock clock_type;
+typedef boost::chrono::duration<float> duration_type;
+
+template <typename PackingAlgorithm>
+void benchmark(std::string const& name, std::vector<B> const& values,
+               std::vector<P> const& query_points, unsigned neighbours_count)
+{
+    clock_type::time_point start = clock_type::now();
+    RT t(values, PackingAlgorithm());
+    duration_type create_time = clock_type::now() - start;
+
+    std::vector<B> result;
+    result.reserve(100);
+
+    bgi::query_statistics spatial;
+    size_t spatial_found = 0;
+    start = clock_type::now();
+    for ( size_t i = 0 ; i < query_points.size() ; ++i )
+    {
+        double x = bg::get<0>(query_points[i]);
+        double y = bg::get<1>(query_points[i]);
+        result.clear();
+        t.query(bgi::intersects(B(P(x - 10, y - 10), P(x + 10, y + 10))), std::back_inserter(result), spatial);
+        spatial_found += result.size();
+    }
+    duration_type spatial_time = clock_type::now() - start;
+
+    bgi::query_statistics knn;
+    size_t knn_found = 0;
+    start = clock_type::now();
+    for ( size_t i = 0 ; i < query_points.size() ; ++i )
+    {
+        result.clear();
+        t.query(bgi::nearest(query_points[i], neighbours_count), std::back_inserter(result), knn);
+        knn_found += result.size();
+    }
+    duration_type knn_time = clock_type::now() - start;
+
+    std::cout << std::left << std::setw(10) << name << std::right
+              << std::setw(10) << create_time.count()
+              << std::setw(10) << spatial_time.count()
+              << std::setw(12) << double(spatial.nodes_visited) / spatial.queries
+              << std::setw(10) << knn_time.count()
+              << std::setw(12) << double(knn.nodes_visited) / knn.queries
+              << "   found " << spatial_found << ", " << knn_found
+              << std::endl;
+}
+
+void benchmark_all(std::string const& title, std::vector<B> const& values,
+                   std::vector<P> const& query_points, unsigned neighbours_count)
+{
+    std::cout << title << ", " << values.size() << " values, "
+              << query_points.size() << " queries" << std::endl;
+    std::cout << std::left << std::setw(10) << "packing" << std::right
+              << std::setw(10) << "create"
+              << std::setw(10) << "spatial"
+              << std::setw(12) << "nodes/query"
+              << std::setw(10) << "knn"
+              << std::setw(12) << "nodes/query"
+              << std::endl;
+
+    benchmark<bgi::topdown_packing>("top-down", values, query_points, neighbours_count);
+    benchmark<bgi::hilbert_packing>("hilbert", values, query_points, neighbours_count);
+    benchmark<bgi::morton_packing>("morton", values, query_points, neighbours_count);
+    std::cout << std::endl;
+}
+
+int main()
+{
+    size_t values_count = 1000000;
+    size_t queries_count = 100000;
+    size_t clusters_count = 200;
+    unsigned neighbours_count = 10;
+
+    boost::mt19937 rng;
+    double max_val = static_cast<double>(values_count / 2);
+    boost::uniform_real<double> range(-max_val, max_val);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<double> > rnd(rng, range);
+
+    // uniformly distributed values and queries
+    {
+        std::vector<B> values;
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            double x = rnd(), y = rnd();
+            values.push_back(B(P(x - 0.5, y - 0.5), P(x + 0.5, y + 0.5)));
+        }
+
+        std::vector<P> query_points;
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+            query_points.push_back(P(rnd() / 10, rnd() / 10));
+
+        benchmark_all("uniform", values, query_points, neighbours_count);
+    }
+
+    // values in clusters of different sizes, queried where the values are
+    {
+        boost::normal_distribution<double> normal(0.0, 1.0);
+        boost::variate_generator<boost::mt19937&, boost::normal_distribution<double> > nrnd(rng, normal);
+
+        std::vector<P> centers;
+        std::vector<double> radii;
+        for ( size_t i = 0 ; i < clusters_count ; ++i )
+        {
+            centers.push_back(P(rnd(), rnd()));
+            radii.push_back(max_val / 1000 * (1 + (i % 10) * (i % 10)));
+        }
+
+        std::vector<B> values;
+        values.reserve(values_count);
+        for ( size_t i = 0 ; i < values_count ; ++i )
+        {
+            // larger clusters contain more values
+            size_t c = static_cast<size_t>((rnd() / max_val + 1) / 2 * clusters_count) % clusters_count;
+            double x = bg::get<0>(centers[c]) + nrnd() * radii[c];
+            double y = bg::get<1>(centers[c]) + nrnd() * radii[c];
+            values.push_back(B(P(x - 0.5, y - 0.5), P(x + 0.5, y + 0.5)));
+        }
+
+        std::vector<P> query_points;
+        for ( size_t i = 0 ; i < queries_count ; ++i )
+        {
+            B const& b = values[(i * 7919) % values_count];
+            query_points.push_back(bg::return_centroid<P>(b));
+        }
+
+        benchmark_all("clustered", values, query_points, neighbours_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <geometry_index_test_common.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/are_boxes_ok.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/are_counts_ok.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/are_levels_ok.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point2d;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d;
+typedef bg::model::box<point2d> box2d;
+
+template <std::size_t Dimension>
+struct grid_point
+{
+    template <typename Point>
+    static Point apply(double x, double y, double ) { return Point(x, y); }
+};
+
+template <>
+struct grid_point<3>
+{
+    template <typename Point>
+    static Point apply(double x, double y, double z) { return Point(x, y, z); }
+};
+
+// Orders the points of a grid of size^Dimension points along the curve,
+// the coordinates of the grid correspond to the most significant bits of the keys
+template <typename PackingAlgorithm, typename Point>
+std::vector<Point> curve_order(std::size_t size)
+{
+    typedef std::pair<Point, std::size_t> entry_type;
+    static const std::size_t dimension = bg::dimension<Point>::value;
+
+    std::vector<entry_type> entries;
+    std::size_t const count = dimension == 3 ? size * size * size : size * size;
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        Point const pt = grid_point<dimension>::template apply<Point>(
+            double(i % size), double(i / size % size), double(i / size / size));
+        entries.push_back(entry_type(pt, i));
+    }
+    std::reverse(entries.begin(), entries.end());
+
+    double const m = double(size - 1);
+    bg::model::box<Point> const box(grid_point<dimension>::template apply<Point>(0, 0, 0),
+                                    grid_point<dimension>::template apply<Point>(m, m, m));
+
+    bgi::detail::rtree::pack_utils::order_entries<PackingAlgorithm>::apply(entries, box);
+
+    std::vector<Point> result;
+    for ( std::size_t i = 0 ; i < entries.size() ; ++i )
+        result.push_back(entries[i].first);
+    return result;
+}
+
+template <typename Point>
+void test_hilbert_order(std::size_t size)
+{
+    std::vector<Point> const points = curve_order<bgi::hilbert_packing, Point>(size);
+
+    // Consecutive points of the Hilbert curve are neighbors
+    for ( std::size_t i = 1 ; i < points.size() ; ++i )
+        BOOST_CHECK_CLOSE(bg::comparable_distance(points[i - 1], points[i]), 1.0, 0.0001);
+}
+
+void test_morton_order()
+{
+    std::vector<point2d> const points = curve_order<bgi::morton_packing, point2d>(4);
+
+    // The Z-order curve fills the quadrants one by one
+    for ( std::size_t i = 0 ; i < points.size() ; ++i )
+    {
+        std::size_t const quadrant = (bg::get<0>(points[i]) < 2 ? 0 : 2)
+                                   + (bg::get<1>(points[i]) < 2 ? 0 : 1);
+        BOOST_CHECK_EQUAL(quadrant, i / 4);
+    }
+}
+
+template <typename Rtree, typename Values>
+void check_rtree(Rtree const& tree, Values const& values)
+{
+    BOOST_CHECK_EQUAL(tree.size(), values.size());
+    if ( values.empty() )
+        return;
+
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_counts_ok(tree));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_levels_ok(tree));
+    BOOST_CHECK(bgi::detail::rtree::utilities::are_boxes_ok(tree));
+
+    box2d const query_box(point2d(20, 30), point2d(45, 42));
+    std::vector<box2d> result;
+    tree.query(bgi::intersects(query_box), std::back_inserter(result));
+
+    std::size_t expected = 0;
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+        if ( bg::intersects(values[i], query_box) )
+            ++expected;
+    BOOST_CHECK_EQUAL(result.size(), expected);
+
+    if ( values.size() >= 5 )
+    {
+        point2d const pt(50, 50);
+        std::vector<double> distances;
+        for ( std::size_t i = 0 ; i < values.size() ; ++i )
+            distances.push_back(bg::comparable_distance(pt, values[i]));
+        std::sort(distances.begin(), distances.end());
+
+        result.clear();
+        tree.query(bgi::nearest(pt, 5), std::back_inserter(result));
+        BOOST_CHECK_EQUAL(result.size(), 5u);
+
+        double farthest = 0;
+        for ( std::size_t i = 0 ; i < result.size() ; ++i )
+            farthest = (std::max)(farthest, bg::comparable_distance(pt, result[i]));
+        BOOST_CHECK_CLOSE(farthest, distances[4], 0.0001);
+    }
+}
+
+template <typename PackingAlgorithm, typename Parameters>
+void test_packing(Parameters const& parameters, std::size_t count)
+{
+    typedef bgi::rtree<box2d, Parameters> rtree_type;
+
+    // Clusters of small boxes
+    std::srand(static_cast<unsigned int>(count));
+    std::vector<box2d> values;
+    for ( std::size_t i = 0 ; i < count ; ++i )
+    {
+        double const cx = 10.0 * (i % 7) + 10.0 + (std::rand() % 1000) / 200.0;
+        double const cy = 12.0 * (i % 5) + 10.0 + (std::rand() % 1000) / 200.0;
+        values.push_back(box2d(point2d(cx, cy), point2d(cx + 0.5, cy + 0.5)));
+    }
+
+    rtree_type tree1(values.begin(), values.end(), PackingAlgorithm(), parameters);
+    check_rtree(tree1, values);
+
+    rtree_type tree2(values, PackingAlgorithm(), parameters);
+    check_rtree(tree2, values);
+}
+
+template <typename PackingAlgorithm>
+void test_packing_algorithm()
+{
+    std::size_t const counts[] = { 0, 1, 5, 177, 1000 };
+    for ( std::size_t i = 0 ; i < sizeof(counts) / sizeof(counts[0]) ; ++i )
+    {
+        test_packing<PackingAlgorithm>(bgi::linear<4>(), counts[i]);
+        test_packing<PackingAlgorithm>(bgi::rstar<16>(), counts[i]);
+        test_packing<PackingAlgorithm>(bgi::dynamic_quadratic(8), counts[i]);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_hilbert_order<point2d>(4);
+    test_hilbert_order<point2d>(16);
+    test_hilbert_order<point3d>(4);
+    test_morton_order();
+
+    test_packing_algorithm<bgi::topdown_packing>();
+    test_packing_algorithm<bgi::hilbert_packing>();
+    test_packing_algorithm<bgi::morton_packing>();
+
+    return 0;
+}
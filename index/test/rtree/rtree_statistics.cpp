@@ -0,0 +1,130 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <vector>
+
+#include <geometry_index_test_common.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/statistics.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::box<point_t> box_t;
+
+std::size_t total_checks(bgi::query_statistics const& s)
+{
+    std::size_t result = 0;
+    for ( std::size_t i = 0 ; i < bgi::query_statistics::max_levels ; ++i )
+        result += s.predicate_checks[i];
+    return result;
+}
+
+template <typename Params>
+void test_statistics(Params const& parameters, bool reinserts)
+{
+    typedef bgi::rtree<point_t, bgi::with_statistics<Params> > rtree_s;
+    typedef bgi::rtree<point_t, Params> rtree_p;
+
+    std::vector<point_t> values;
+    for ( int i = 0 ; i < 100 ; ++i )
+        for ( int j = 0 ; j < 100 ; ++j )
+            values.push_back(point_t(i, j));
+
+    // Insertions
+    bgi::with_statistics<Params> const parameters_s(parameters);
+
+    rtree_s tree(parameters_s);
+    for ( std::size_t i = 0 ; i < values.size() ; ++i )
+        tree.insert(values[i]);
+
+    bgi::query_statistics s = tree.statistics();
+    BOOST_CHECK(s.splits > 0);
+    BOOST_CHECK_EQUAL(s.reinsertions > 0, reinserts);
+    BOOST_CHECK_EQUAL(s.queries, 0u);
+    tree.reset_statistics();
+    BOOST_CHECK_EQUAL(tree.statistics().splits, 0u);
+
+    // Packed trees have the same structure, with or without statistics
+    rtree_s packed_s(values, parameters_s);
+    rtree_p packed_p(values, parameters);
+
+    box_t const box(point_t(10.5, 20.5), point_t(30.5, 25.5));
+    point_t const pt(50.2, 50.7);
+
+    bgi::query_statistics spatial, nearest, sum;
+    std::vector<point_t> result_s, result_p;
+
+    // Spatial query, with the same counters per query and cumulative
+    packed_s.query(bgi::intersects(box), std::back_inserter(result_s), spatial);
+    packed_p.query(bgi::intersects(box), std::back_inserter(result_p));
+    BOOST_CHECK_EQUAL(result_s.size(), 100u);
+    BOOST_CHECK_EQUAL(result_p.size(), 100u);
+    BOOST_CHECK_EQUAL(spatial.queries, 1u);
+    BOOST_CHECK(spatial.nodes_visited > spatial.leaves_visited);
+    BOOST_CHECK(spatial.leaves_visited > 0);
+    BOOST_CHECK(spatial.leaf_entries_tested >= result_s.size());
+    BOOST_CHECK(spatial.predicate_checks[0] > 0);
+    BOOST_CHECK(total_checks(spatial) > spatial.leaf_entries_tested);
+    BOOST_CHECK_EQUAL(spatial.heap_pushes, 0u);
+    BOOST_CHECK_EQUAL(spatial.branch_pushes, 0u);
+
+    s = packed_s.statistics();
+    BOOST_CHECK_EQUAL(s.queries, 1u);
+    BOOST_CHECK_EQUAL(s.nodes_visited, spatial.nodes_visited);
+    BOOST_CHECK_EQUAL(s.leaf_entries_tested, spatial.leaf_entries_tested);
+    BOOST_CHECK_EQUAL(total_checks(s), total_checks(spatial));
+
+    // The rtree without statistics collects them only if they are passed
+    bgi::query(packed_p, bgi::intersects(box), std::back_inserter(result_p), sum);
+    BOOST_CHECK_EQUAL(sum.nodes_visited, spatial.nodes_visited);
+    BOOST_CHECK_EQUAL(sum.leaf_entries_tested, spatial.leaf_entries_tested);
+
+    // Nearest query
+    result_s.clear();
+    packed_s.query(bgi::nearest(pt, 5), std::back_inserter(result_s), nearest);
+    BOOST_CHECK_EQUAL(result_s.size(), 5u);
+    BOOST_CHECK_EQUAL(nearest.queries, 1u);
+    BOOST_CHECK(nearest.heap_pushes >= 5u);
+    BOOST_CHECK(nearest.branch_pushes > 0);
+    BOOST_CHECK(nearest.leaf_entries_tested >= nearest.heap_pushes);
+
+    // Queries without passed statistics are counted as well
+    result_s.clear();
+    packed_s.query(bgi::intersects(box), std::back_inserter(result_s));
+
+    s = packed_s.statistics();
+    BOOST_CHECK_EQUAL(s.queries, 3u);
+    BOOST_CHECK_EQUAL(s.nodes_visited, 2 * spatial.nodes_visited + nearest.nodes_visited);
+    BOOST_CHECK_EQUAL(s.heap_pushes, nearest.heap_pushes);
+    BOOST_CHECK_EQUAL(s.splits, 0u);
+
+    // Passed statistics are accumulated
+    sum += nearest;
+    BOOST_CHECK_EQUAL(sum.queries, 2u);
+    BOOST_CHECK_EQUAL(sum.nodes_visited, spatial.nodes_visited + nearest.nodes_visited);
+
+    // Counters are not copied
+    rtree_s copy(packed_s);
+    BOOST_CHECK_EQUAL(copy.statistics().queries, 0u);
+    BOOST_CHECK_EQUAL(packed_s.statistics().queries, 3u);
+    BOOST_CHECK_EQUAL(packed_s.parameters().statistics().queries, 0u);
+}
+
+int test_main(int, char* [])
+{
+    test_statistics(bgi::linear<16>(), false);
+    test_statistics(bgi::quadratic<16>(), false);
+    test_statistics(bgi::rstar<16>(), true);
+    test_statistics(bgi::dynamic_rstar(16), true);
+
+    return 0;
+}
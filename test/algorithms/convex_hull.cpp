@@ -58,6 +58,11 @@ void test_all()
             2, 4, 0, 4);
     }
 
+    // many points inside the quadrilateral of the extremes
+    test_geometry<bg::model::multi_point<P> >(
+        "multipoint(0 0, 5 5, 10 0, 2 3, 7 8, 5 0, 0 5, 10 10, 4 9, 0 10, 1 8)",
+        11, 5, 100);
+
     // degenerated hulls
     test_geometry<bg::model::multi_point<P> >(
         "multipoint(0 0)",
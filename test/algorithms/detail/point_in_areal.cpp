@@ -0,0 +1,202 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/algorithms/detail/packed_box_index.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal.hpp>
+
+
+template <typename Polygon>
+Polygon make_square(double x, double y, double size, int holes)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef typename bg::ring_type<Polygon>::type ring_type;
+
+    Polygon polygon;
+    bg::append(polygon.outer(), point_type(x, y));
+    bg::append(polygon.outer(), point_type(x, y + size));
+    bg::append(polygon.outer(), point_type(x + size, y + size));
+    bg::append(polygon.outer(), point_type(x + size, y));
+    bg::append(polygon.outer(), point_type(x, y));
+
+    // Holes in a row, each a quarter of the size
+    double const hole = size / (2 * holes + 1);
+    for (int i = 0; i < holes; i++)
+    {
+        double const hx = x + (2 * i + 1) * hole;
+        double const hy = y + size / 2.0 - hole / 2.0;
+        ring_type ring;
+        bg::append(ring, point_type(hx, hy));
+        bg::append(ring, point_type(hx + hole, hy));
+        bg::append(ring, point_type(hx + hole, hy + hole));
+        bg::append(ring, point_type(hx, hy + hole));
+        bg::append(ring, point_type(hx, hy));
+        polygon.inners().push_back(ring);
+    }
+    return polygon;
+}
+
+
+template <typename P>
+void test_packed_box_index()
+{
+    typedef bg::model::box<P> box_type;
+
+    std::vector<box_type> boxes;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const x = (i * 37) % 100;
+        double const y = (i * 61) % 100;
+        boxes.push_back(box_type(P(x, y), P(x + 1 + i % 5, y + 1 + i % 3)));
+    }
+
+    bg::detail::packed_box_index<box_type> index;
+    index.assign(boxes);
+    BOOST_CHECK_EQUAL(index.size(), boxes.size());
+
+    for (int i = 0; i < 200; i++)
+    {
+        P const point(i % 103 + 0.5, (i * 7) % 101 + 0.25);
+        std::vector<std::size_t> result;
+        index.query(point, result);
+
+        std::size_t expected = 0;
+        for (std::size_t j = 0; j < boxes.size(); j++)
+        {
+            if (bg::covered_by(point, boxes[j]))
+            {
+                expected++;
+            }
+        }
+        BOOST_CHECK_EQUAL(result.size(), expected);
+
+        box_type const query(P(i % 97, i % 89), P(i % 97 + 3, i % 89 + 2));
+        result.clear();
+        index.query(query, result);
+        expected = 0;
+        for (std::size_t j = 0; j < boxes.size(); j++)
+        {
+            if (bg::intersects(query, boxes[j]))
+            {
+                expected++;
+            }
+        }
+        BOOST_CHECK_EQUAL(result.size(), expected);
+    }
+}
+
+
+template <typename P>
+void test_point_in_areal()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // 10x10 squares with 3 holes each, and one large polygon with many holes
+    multi_polygon mp;
+    for (int i = 0; i < 10; i++)
+    {
+        for (int j = 0; j < 10; j++)
+        {
+            mp.push_back(make_square<polygon>(i * 10.0, j * 10.0, 8.0, 3));
+        }
+    }
+    polygon const large = make_square<polygon>(0.0, 0.0, 100.0, 40);
+
+    bg::detail::relate::point_in_areal<multi_polygon> mp_locator(mp);
+    bg::detail::relate::point_in_areal<polygon> polygon_locator(large);
+
+    int counts[3] = { 0, 0, 0 };
+    for (int i = -4; i < 420; i++)
+    {
+        for (int j = -4; j < 420; j += 3)
+        {
+            // Also on boundaries and on vertices
+            P const point(i * 0.25, j * 0.25);
+
+            int const expected = bg::detail::within::point_in_geometry(point, mp);
+            BOOST_CHECK_EQUAL(mp_locator.apply(point), expected);
+            BOOST_CHECK_EQUAL(polygon_locator.apply(point),
+                bg::detail::within::point_in_geometry(point, large));
+            counts[expected + 1]++;
+        }
+    }
+
+    BOOST_CHECK(counts[0] > 0);
+    BOOST_CHECK(counts[1] > 0);
+    BOOST_CHECK(counts[2] > 0);
+}
+
+
+template <typename P>
+void test_relate_many_rings()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    multi_polygon grid, inner, shifted;
+    multi_linestring lines;
+    for (int i = 0; i < 20; i++)
+    {
+        for (int j = 0; j < 20; j++)
+        {
+            grid.push_back(make_square<polygon>(i * 10.0, j * 10.0, 8.0, 1));
+            // Inside the squares, outside the hole
+            inner.push_back(make_square<polygon>(i * 10.0 + 0.5, j * 10.0 + 0.5, 1.0, 0));
+            // Between the squares
+            shifted.push_back(make_square<polygon>(i * 10.0 + 8.5, j * 10.0 + 8.5, 1.0, 0));
+
+            linestring ls;
+            bg::append(ls, P(i * 10.0 + 0.5, j * 10.0 + 7.0));
+            bg::append(ls, P(i * 10.0 + 7.5, j * 10.0 + 7.0));
+            lines.push_back(ls);
+        }
+    }
+
+    // No turns at all: all rings are classified by point in geometry
+    BOOST_CHECK(bg::within(inner, grid));
+    BOOST_CHECK(! bg::within(grid, inner));
+    BOOST_CHECK(! bg::within(shifted, grid));
+    BOOST_CHECK(bg::disjoint(shifted, grid));
+    BOOST_CHECK(! bg::overlaps(inner, grid));
+    BOOST_CHECK(! bg::touches(inner, grid));
+    BOOST_CHECK_EQUAL(bg::relation(inner, grid).str(), "2FF1FF212");
+    BOOST_CHECK_EQUAL(bg::relation(shifted, grid).str(), "FF2FF1212");
+
+    BOOST_CHECK(bg::within(lines, grid));
+    BOOST_CHECK(! bg::within(lines, shifted));
+    BOOST_CHECK(! bg::crosses(lines, grid));
+
+    // One extra polygon overlapping one square
+    multi_polygon mixed = inner;
+    mixed.push_back(make_square<polygon>(95.0, 95.0, 3.0, 0));
+    BOOST_CHECK(! bg::within(mixed, grid));
+    BOOST_CHECK(bg::overlaps(mixed, grid));
+}
+
+
+int test_main(int, char* [])
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+
+    test_packed_box_index<point_type>();
+    test_point_in_areal<point_type>();
+    test_relate_many_rings<point_type>();
+
+    return 0;
+}
@@ -15,6 +15,8 @@
 // unit test to test disjoint for all geometry combinations
 
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include <boost/test/included/unit_test.hpp>
 
@@ -503,6 +505,69 @@ inline void test_multilinestring_multipolygon()
                   true);
 }
 
+// Multipolygon with enough rings to let the point location use an index:
+// a grid of 5x5 squares of 8x8, each with a square hole of 4x4
+inline std::string grid_with_holes_wkt()
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < 5; i++)
+    {
+        for (int j = 0; j < 5; j++)
+        {
+            int const x = i * 10;
+            int const y = j * 10;
+            out << (i + j > 0 ? "," : "")
+                << "((" << x << " " << y << "," << x + 8 << " " << y << ","
+                << x + 8 << " " << y + 8 << "," << x << " " << y + 8 << "),"
+                << "(" << x + 2 << " " << y + 2 << "," << x + 2 << " " << y + 6
+                << "," << x + 6 << " " << y + 6 << "," << x + 6 << " " << y + 2
+                << "))";
+        }
+    }
+    out << ")";
+    return out.str();
+}
+
+template <typename P>
+inline void test_multilinestring_multipolygon_many_rings()
+{
+    typedef bg::model::linestring<P> L;
+    typedef bg::model::multi_linestring<L> ML;
+    typedef bg::model::polygon<P, false, false> PL; // ccw, open
+    typedef bg::model::multi_polygon<PL> MPL;
+
+    typedef test_disjoint tester;
+
+    MPL const mpl = from_wkt<MPL>(grid_with_holes_wkt());
+
+    // In the gaps between the squares and inside the holes
+    tester::apply("ml-mpg-many-01",
+                  from_wkt<ML>("MULTILINESTRING((9 -1,9 49),(-1 19,49 19),"
+                               "(13 13,15 15),(43 43,44 45),(50 50,60 60))"),
+                  mpl,
+                  true);
+
+    // The last one inside the square in the upper right corner
+    tester::apply("ml-mpg-many-02",
+                  from_wkt<ML>("MULTILINESTRING((9 -1,9 49),(-1 19,49 19),"
+                               "(13 13,15 15),(41 41,47 41))"),
+                  mpl,
+                  false);
+
+    // The last one on the boundary of a hole
+    tester::apply("ml-mpg-many-03",
+                  from_wkt<ML>("MULTILINESTRING((13 13,15 15),(22 23,22 25))"),
+                  mpl,
+                  false);
+
+    // Crossing a hole
+    tester::apply("ml-mpg-many-04",
+                  from_wkt<ML>("MULTILINESTRING((13 13,15 15),(31 34,37 34))"),
+                  mpl,
+                  false);
+}
+
 //============================================================================
 
 template <typename CoordinateType>
@@ -522,6 +587,7 @@ inline void test_linear_areal()
 
     test_multilinestring_polygon<point_type>();
     test_multilinestring_multipolygon<point_type>();
+    test_multilinestring_multipolygon_many_rings<point_type>();
     test_multilinestring_ring<point_type>();
     test_multilinestring_box<point_type>();
 }
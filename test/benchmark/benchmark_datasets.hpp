@@ -0,0 +1,316 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Parameterized datasets for the benchmark suite. All datasets are generated
+// from a seed, such that runs on other platforms and of other releases
+// process the same geometries.
+
+#ifndef BOOST_GEOMETRY_TEST_BENCHMARK_DATASETS_HPP
+#define BOOST_GEOMETRY_TEST_BENCHMARK_DATASETS_HPP
+
+#include <cmath>
+#include <vector>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry.hpp>
+
+
+namespace benchmark
+{
+
+namespace bg = boost::geometry;
+
+typedef boost::minstd_rand base_generator_type;
+typedef boost::variate_generator
+    <
+        base_generator_type&, boost::uniform_real<>
+    > real_generator_type;
+
+
+// Adds a star to the ring, with points alternating between two radii.
+// The ring is closed and created in clockwise order.
+template <typename Ring>
+inline void make_star(Ring& ring, int count,
+            double cx, double cy, double radius1, double radius2,
+            double rotation = 0.0)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    double const delta = -2.0 * boost::math::constants::pi<double>() / count;
+    for (int i = 0; i <= count; i++)
+    {
+        double const angle = rotation + (i % count) * delta;
+        double const radius = i % 2 == 0 ? radius1 : radius2;
+        bg::append(ring, bg::make<point_type>(cx + radius * std::cos(angle),
+                                              cy + radius * std::sin(angle)));
+    }
+}
+
+
+// Stars in cells of a square field of cell_count x cell_count cells, with
+// random centers, radii and rotations. Stars of one set do not overlap,
+// stars of sets created with different seeds do.
+template <typename MultiPolygon>
+inline void random_stars(MultiPolygon& result, int cell_count,
+            int point_count, unsigned int seed)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    base_generator_type generator(seed);
+    real_generator_type random(generator, boost::uniform_real<>(0.0, 1.0));
+
+    double const cell_size = 10.0;
+    result.clear();
+    result.resize(cell_count * cell_count);
+    for (int i = 0; i < cell_count * cell_count; i++)
+    {
+        double const cx = cell_size * (i % cell_count + 0.4 + 0.2 * random());
+        double const cy = cell_size * (i / cell_count + 0.4 + 0.2 * random());
+        double const radius1 = cell_size * (0.25 + 0.15 * random());
+        double const radius2 = radius1 * (0.3 + 0.5 * random());
+        polygon_type& star = result[i];
+        make_star(bg::exterior_ring(star), point_count,
+                  cx, cy, radius1, radius2, random());
+    }
+    bg::correct(result);
+}
+
+
+// The star and the comb of the star_comb robustness test, the comb has
+// count teeth. All teeth cross the star several times.
+template <typename Polygon>
+inline void star_comb(Polygon& star, Polygon& comb, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    bg::clear(star);
+    bg::clear(comb);
+
+    make_star(bg::exterior_ring(star), 2 * (count | 1), 25.0, 25.0, 25.0, 12.5);
+
+    typename bg::ring_type<Polygon>::type& ring = bg::exterior_ring(comb);
+    bg::append(ring, bg::make<point_type>(25.0, 0.0));
+    bg::append(ring, bg::make<point_type>(0.0, 25.0));
+    bg::append(ring, bg::make<point_type>(25.0, 50.0));
+
+    double const diff = (25.0 / (count - 0.5)) / 2.0;
+    double const b1 = -25.0;
+    double const b2 = 25.0 - diff * 2.0;
+    double x1 = 50.0, x2 = 25.0;
+    for (int i = 0; i < count - 1; i++)
+    {
+        bg::append(ring, bg::make<point_type>(x1, x1 + b1)); x1 -= diff;
+        bg::append(ring, bg::make<point_type>(x1, x1 + b1)); x1 -= diff;
+        bg::append(ring, bg::make<point_type>(x2, x2 + b2)); x2 -= diff;
+        bg::append(ring, bg::make<point_type>(x2, x2 + b2)); x2 -= diff;
+    }
+    bg::append(ring, bg::make<point_type>(x1, x1 + b1));
+    bg::append(ring, bg::make<point_type>(25.0, 0.0));
+
+    bg::correct(star);
+    bg::correct(comb);
+}
+
+
+namespace detail
+{
+
+template <typename MultiPolygon, typename Generator>
+inline void recursive_polygons(MultiPolygon& result, Generator& random,
+            int level)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    result.clear();
+    if (level == 0)
+    {
+        double const x = random(), y = random();
+        polygon_type square;
+        bg::append(square, bg::make<point_type>(x, y));
+        bg::append(square, bg::make<point_type>(x, y + 1));
+        bg::append(square, bg::make<point_type>(x + 1, y + 1));
+        bg::append(square, bg::make<point_type>(x + 1, y));
+        bg::append(square, bg::make<point_type>(x, y));
+        bg::correct(square);
+        result.push_back(square);
+        return;
+    }
+
+    MultiPolygon p, q;
+    recursive_polygons(p, random, level - 1);
+    recursive_polygons(q, random, level - 1);
+    bg::union_(p, q, result);
+}
+
+} // namespace detail
+
+
+// The union of 2^level unit squares at random integer positions in a field,
+// created recursively as in the recursive_polygons robustness test. The
+// result has many touching rings and holes.
+template <typename MultiPolygon>
+inline void recursive_polygons(MultiPolygon& result, int level,
+            int field_size, unsigned int seed)
+{
+    base_generator_type generator(seed);
+    boost::variate_generator
+        <
+            base_generator_type&, boost::uniform_int<>
+        > random(generator, boost::uniform_int<>(0, field_size - 1));
+
+    detail::recursive_polygons(result, random, level);
+}
+
+
+// Parcels of a grid of cell_count x cell_count cells, resembling a cadastral
+// map. Corners are moved randomly by at most jitter times the cell size.
+// Each edge has vertices_per_edge vertices between the corners, which
+// deviate a little from the straight line. Adjacent parcels share their
+// edges exactly.
+template <typename Polygon>
+inline void grid(std::vector<Polygon>& result, int cell_count,
+            int vertices_per_edge, double jitter, unsigned int seed)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    base_generator_type generator(seed);
+    real_generator_type random(generator, boost::uniform_real<>(-1.0, 1.0));
+
+    double const cell_size = 100.0;
+    int const n = cell_count + 1;
+
+    // Corners, and edge vertices, horizontal edges from (i,j) to (i+1,j)
+    // first, then vertical edges from (i,j) to (i,j+1)
+    std::vector<point_type> corners(n * n);
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            corners[j * n + i] = bg::make<point_type>(
+                cell_size * (i + jitter * random()),
+                cell_size * (j + jitter * random()));
+        }
+    }
+
+    int const k = vertices_per_edge;
+    std::vector<point_type> vertices(2 * n * n * k);
+    for (int e = 0; e < 2 * n * n; e++)
+    {
+        int const c = e % (n * n);
+        bool const horizontal = e < n * n;
+        point_type const& p1 = corners[c];
+        point_type const& p2 = corners[horizontal
+            ? (c % n < n - 1 ? c + 1 : c)
+            : (c / n < n - 1 ? c + n : c)];
+        double const dx = bg::get<0>(p2) - bg::get<0>(p1);
+        double const dy = bg::get<1>(p2) - bg::get<1>(p1);
+        for (int v = 0; v < k; v++)
+        {
+            double const f = (v + 1.0) / (k + 1.0);
+            double const offset = 0.05 * random();
+            vertices[e * k + v] = bg::make<point_type>(
+                bg::get<0>(p1) + f * dx - offset * dy,
+                bg::get<1>(p1) + f * dy + offset * dx);
+        }
+    }
+
+    result.clear();
+    result.resize(cell_count * cell_count);
+    for (int j = 0; j < cell_count; j++)
+    {
+        for (int i = 0; i < cell_count; i++)
+        {
+            int const c = j * n + i;
+            int const bottom = c, top = c + n;
+            int const left = n * n + c, right = n * n + c + 1;
+
+            Polygon& parcel = result[j * cell_count + i];
+            bg::append(parcel, corners[c]);
+            for (int v = 0; v < k; v++)
+            {
+                bg::append(parcel, vertices[left * k + v]);
+            }
+            bg::append(parcel, corners[c + n]);
+            for (int v = 0; v < k; v++)
+            {
+                bg::append(parcel, vertices[top * k + v]);
+            }
+            bg::append(parcel, corners[c + n + 1]);
+            for (int v = k - 1; v >= 0; v--)
+            {
+                bg::append(parcel, vertices[right * k + v]);
+            }
+            bg::append(parcel, corners[c + 1]);
+            for (int v = k - 1; v >= 0; v--)
+            {
+                bg::append(parcel, vertices[bottom * k + v]);
+            }
+            bg::append(parcel, corners[c]);
+            bg::correct(parcel);
+        }
+    }
+}
+
+
+// Random points in the box (min_x, min_y) - (max_x, max_y)
+template <typename MultiPoint>
+inline void random_points(MultiPoint& result, int count,
+            double min_x, double min_y, double max_x, double max_y,
+            unsigned int seed)
+{
+    typedef typename boost::range_value<MultiPoint>::type point_type;
+
+    base_generator_type generator(seed);
+    real_generator_type random(generator, boost::uniform_real<>(0.0, 1.0));
+
+    result.clear();
+    for (int i = 0; i < count; i++)
+    {
+        double const x = min_x + (max_x - min_x) * random();
+        double const y = min_y + (max_y - min_y) * random();
+        result.push_back(bg::make<point_type>(x, y));
+    }
+}
+
+
+// A random walk of count points, with steps of at most step_size, which
+// resembles a digitized road or river
+template <typename Linestring>
+inline void random_walk(Linestring& result, int count, double step_size,
+            unsigned int seed)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    base_generator_type generator(seed);
+    real_generator_type random(generator, boost::uniform_real<>(-1.0, 1.0));
+
+    bg::clear(result);
+    double x = 0.0, y = 0.0, direction = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        bg::append(result, bg::make<point_type>(x, y));
+        direction += 0.3 * random();
+        double const step = step_size * (0.5 + 0.5 * std::fabs(random()));
+        x += step * std::cos(direction);
+        y += step * std::sin(direction);
+    }
+}
+
+
+} // namespace benchmark
+
+
+#endif // BOOST_GEOMETRY_TEST_BENCHMARK_DATASETS_HPP
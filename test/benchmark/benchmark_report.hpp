@@ -0,0 +1,209 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Runs and times the cases of the benchmark suite, and reports them as text
+// and as JSON
+
+#ifndef BOOST_GEOMETRY_TEST_BENCHMARK_REPORT_HPP
+#define BOOST_GEOMETRY_TEST_BENCHMARK_REPORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/config.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/version.hpp>
+
+
+namespace benchmark
+{
+
+
+struct result
+{
+    std::string algorithm;
+    std::string dataset;
+    std::string strategy;
+    std::size_t size; // number of points of the input
+    std::vector<double> times; // in seconds, per run
+    double check; // result of the case, to verify the runs are comparable
+    bool consistent; // all runs had the same result
+
+    inline double min() const
+    {
+        return *std::min_element(times.begin(), times.end());
+    }
+
+    inline double median() const
+    {
+        std::vector<double> sorted = times;
+        std::sort(sorted.begin(), sorted.end());
+        std::size_t const n = sorted.size();
+        return n % 2 == 1 ? sorted[n / 2]
+            : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+    }
+
+    inline double mean() const
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < times.size(); i++)
+        {
+            sum += times[i];
+        }
+        return sum / times.size();
+    }
+};
+
+
+class report
+{
+public:
+    // Cases are only run if their algorithm or dataset contains filter.
+    // Results are listed as text on log.
+    inline report(int runs, std::string const& filter, std::ostream& log)
+        : m_runs(runs < 1 ? 1 : runs)
+        , m_filter(filter)
+        , m_log(log)
+    {}
+
+    inline bool selected(std::string const& algorithm,
+                         std::string const& dataset) const
+    {
+        return m_filter.empty()
+            || algorithm.find(m_filter) != std::string::npos
+            || dataset.find(m_filter) != std::string::npos;
+    }
+
+    // Runs the functor, which processes the whole dataset and returns a
+    // check value, once as a warm up and then the number of runs
+    template <typename Functor>
+    inline void run(std::string const& algorithm, std::string const& dataset,
+                    std::string const& strategy, std::size_t size,
+                    Functor const& functor)
+    {
+        typedef boost::chrono::high_resolution_clock clock_type;
+        typedef boost::chrono::duration<double> duration_type;
+
+        if (! selected(algorithm, dataset))
+        {
+            return;
+        }
+
+        result r;
+        r.algorithm = algorithm;
+        r.dataset = dataset;
+        r.strategy = strategy;
+        r.size = size;
+        r.check = functor();
+        r.consistent = true;
+        for (int i = 0; i < m_runs; i++)
+        {
+            clock_type::time_point const start = clock_type::now();
+            double const check = functor();
+            duration_type const d = clock_type::now() - start;
+            r.times.push_back(d.count());
+            if (check != r.check)
+            {
+                r.consistent = false;
+            }
+        }
+        m_results.push_back(r);
+
+        m_log << std::left
+                  << std::setw(16) << algorithm
+                  << std::setw(24) << dataset
+                  << std::setw(20) << strategy
+                  << std::right
+                  << std::setw(10) << size
+                  << std::setw(14) << r.median() << " s"
+                  << "   " << r.check
+                  << (r.consistent ? "" : " (inconsistent)")
+                  << std::endl;
+    }
+
+    inline std::vector<result> const& results() const
+    {
+        return m_results;
+    }
+
+    inline void write_json(std::ostream& out, std::string const& parameters) const
+    {
+        out << std::setprecision(std::numeric_limits<double>::digits10 + 2);
+        out << "{" << std::endl
+            << "  \"suite\": \"boost-geometry-benchmark\"," << std::endl
+            << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\"," << std::endl
+            << "  \"compiler\": " << quoted(BOOST_COMPILER) << "," << std::endl
+            << "  \"platform\": " << quoted(BOOST_PLATFORM) << "," << std::endl
+            << "  \"parameters\": " << quoted(parameters) << "," << std::endl
+            << "  \"runs\": " << m_runs << "," << std::endl
+            << "  \"results\": [" << std::endl;
+        for (std::size_t i = 0; i < m_results.size(); i++)
+        {
+            result const& r = m_results[i];
+            out << "    {"
+                << "\"algorithm\": " << quoted(r.algorithm)
+                << ", \"dataset\": " << quoted(r.dataset)
+                << ", \"strategy\": " << quoted(r.strategy)
+                << ", \"size\": " << r.size
+                << ", \"min\": " << r.min()
+                << ", \"median\": " << r.median()
+                << ", \"mean\": " << r.mean()
+                << ", \"check\": ";
+            if (boost::math::isfinite(r.check))
+            {
+                out << r.check;
+            }
+            else
+            {
+                out << "null";
+            }
+            out << ", \"consistent\": " << (r.consistent ? "true" : "false")
+                << "}" << (i + 1 < m_results.size() ? "," : "") << std::endl;
+        }
+        out << "  ]" << std::endl
+            << "}" << std::endl;
+    }
+
+private:
+    static inline std::string quoted(std::string const& s)
+    {
+        std::string text = "\"";
+        for (std::size_t i = 0; i < s.size(); i++)
+        {
+            char const c = s[i];
+            if (c == '"' || c == '\\')
+            {
+                text += '\\';
+                text += c;
+            }
+            else if (static_cast<unsigned char>(c) >= 0x20)
+            {
+                text += c;
+            }
+        }
+        return text + "\"";
+    }
+
+    int m_runs;
+    std::string m_filter;
+    std::ostream& m_log;
+    std::vector<result> m_results;
+};
+
+
+} // namespace benchmark
+
+
+#endif // BOOST_GEOMETRY_TEST_BENCHMARK_REPORT_HPP
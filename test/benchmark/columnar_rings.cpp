@@ -0,0 +1,139 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares envelope, area, perimeter and centroid per ring, for a vector of
+// rings, with envelope_n, area_n, perimeter_n and centroid_n for the same
+// rings stored as columns.
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/extensions/algorithms/columnar_rings.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::ring<point_type> ring_type;
+typedef bg::model::box<point_type> box_type;
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    std::size_t const n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    std::size_t const threads = argc > 2 ? std::atoi(argv[2]) : 1;
+
+    // Star shaped rings of 4 up to 40 points
+    std::vector<ring_type> rings(n);
+    std::vector<double> x, y;
+    std::vector<std::size_t> offsets(1, 0);
+    unsigned int state = 12345;
+    for (std::size_t r = 0; r < n; r++)
+    {
+        std::size_t const count = 4 + r % 37;
+        for (std::size_t i = 0; i <= count; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            double const radius = 100.0 + (state >> 16) % 300;
+            double const angle = -2.0 * 3.14159265358979 * i / count;
+            point_type const p = i == count ? rings[r].front()
+                : point_type(1000.0 * (r % 1000) + radius * std::cos(angle),
+                             1000.0 * (r / 1000) + radius * std::sin(angle));
+            rings[r].push_back(p);
+            x.push_back(bg::get<0>(p));
+            y.push_back(bg::get<1>(p));
+        }
+        offsets.push_back(x.size());
+    }
+
+    std::vector<double> min_x(n), min_y(n), max_x(n), max_y(n);
+    std::vector<double> a1(n), p1(n), cx1(n), cy1(n);
+    std::vector<double> a2(n), p2(n), cx2(n), cy2(n);
+
+    clock_type::time_point start = clock_type::now();
+    for (std::size_t r = 0; r < n; r++)
+    {
+        box_type box;
+        bg::envelope(rings[r], box);
+        min_x[r] = bg::get<bg::min_corner, 0>(box);
+        min_y[r] = bg::get<bg::min_corner, 1>(box);
+        max_x[r] = bg::get<bg::max_corner, 0>(box);
+        max_y[r] = bg::get<bg::max_corner, 1>(box);
+    }
+    duration_type const e1 = clock_type::now() - start;
+
+    start = clock_type::now();
+    for (std::size_t r = 0; r < n; r++)
+    {
+        a1[r] = bg::area(rings[r]);
+    }
+    duration_type const t_a1 = clock_type::now() - start;
+
+    start = clock_type::now();
+    for (std::size_t r = 0; r < n; r++)
+    {
+        p1[r] = bg::perimeter(rings[r]);
+    }
+    duration_type const t_p1 = clock_type::now() - start;
+
+    start = clock_type::now();
+    for (std::size_t r = 0; r < n; r++)
+    {
+        point_type c;
+        bg::centroid(rings[r], c);
+        cx1[r] = bg::get<0>(c);
+        cy1[r] = bg::get<1>(c);
+    }
+    duration_type const t_c1 = clock_type::now() - start;
+
+    bg::columnar_rings<double> const columns(&x[0], &y[0], &offsets[0], n);
+    std::vector<double> min_x2(n), min_y2(n), max_x2(n), max_y2(n);
+
+    start = clock_type::now();
+    bg::envelope_n(columns, &min_x2[0], &min_y2[0], &max_x2[0], &max_y2[0],
+                   threads);
+    duration_type const e2 = clock_type::now() - start;
+
+    start = clock_type::now();
+    bg::area_n(columns, &a2[0], threads);
+    duration_type const t_a2 = clock_type::now() - start;
+
+    start = clock_type::now();
+    bg::perimeter_n(columns, &p2[0], threads);
+    duration_type const t_p2 = clock_type::now() - start;
+
+    start = clock_type::now();
+    bg::centroid_n(columns, &cx2[0], &cy2[0], threads);
+    duration_type const t_c2 = clock_type::now() - start;
+
+    bool const same = min_x == min_x2 && min_y == min_y2 && max_x == max_x2
+        && max_y == max_y2 && a1 == a2 && p1 == p2 && cx1 == cx2 && cy1 == cy2;
+
+    std::cout << "columnar rings, " << n << " rings, " << x.size()
+              << " points, " << threads << " thread(s)" << std::endl
+              << "  envelope:       " << e1.count() << " s, "
+              << e2.count() << " s, speedup " << e1.count() / e2.count() << std::endl
+              << "  area:           " << t_a1.count() << " s, "
+              << t_a2.count() << " s, speedup " << t_a1.count() / t_a2.count() << std::endl
+              << "  perimeter:      " << t_p1.count() << " s, "
+              << t_p2.count() << " s, speedup " << t_p1.count() / t_p2.count() << std::endl
+              << "  centroid:       " << t_c1.count() << " s, "
+              << t_c2.count() << " s, speedup " << t_c1.count() / t_c2.count() << std::endl
+              << "  same result:    " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
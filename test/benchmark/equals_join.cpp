@@ -0,0 +1,94 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares finding the equal pairs of two sets of parcels by calling equals
+// for all pairs, with equals_join, which only calls equals for the pairs
+// having the same fingerprint. The parcels of the second set have another
+// start point, and one of each ten is different.
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/extensions/algorithms/equals_fingerprint.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef std::vector<std::pair<std::size_t, std::size_t> > pairs_type;
+
+
+std::vector<polygon_type> make_parcels(int n, int start, bool modify)
+{
+    std::vector<polygon_type> result;
+    for (int i = 0; i < n; i++)
+    {
+        double const x = i % 100, y = i / 100;
+        double const dx = modify && i % 10 == 0 ? 0.5 : 0.0;
+        point_type const corners[4] = { point_type(x, y), point_type(x, y + 1),
+            point_type(x + 1 + dx, y + 1), point_type(x + 1, y) };
+        polygon_type parcel;
+        for (int j = 0; j <= 4; j++)
+        {
+            bg::exterior_ring(parcel).push_back(corners[(start + j) % 4]);
+        }
+        result.push_back(parcel);
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const n = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+    std::vector<polygon_type> const parcels1 = make_parcels(n, 0, false);
+    std::vector<polygon_type> const parcels2 = make_parcels(n, 2, true);
+
+    pairs_type pairs1, pairs2;
+
+    clock_type::time_point start = clock_type::now();
+    for (std::size_t i = 0; i < parcels1.size(); i++)
+    {
+        for (std::size_t j = 0; j < parcels2.size(); j++)
+        {
+            if (bg::equals(parcels1[i], parcels2[j]))
+            {
+                pairs1.push_back(std::make_pair(i, j));
+            }
+        }
+    }
+    duration_type const t1 = clock_type::now() - start;
+
+    start = clock_type::now();
+    bg::equals_join(parcels1, parcels2, std::back_inserter(pairs2));
+    duration_type const t2 = clock_type::now() - start;
+
+    bool const same = pairs1 == pairs2;
+
+    std::cout << "equals, " << n << " x " << n << " parcels, "
+              << pairs2.size() << " equal pairs" << std::endl
+              << "  all pairs:      " << t1.count() << " s" << std::endl
+              << "  equals_join:    " << t2.count() << " s" << std::endl
+              << "  speedup:        " << t1.count() / t2.count() << std::endl
+              << "  same result:    " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares calculating geodesic distances pair by pair, by the strategies
+// vincenty, thomas and andoyer, with calculating them in batches.
+// The batches are only vectorized if vectorized trigonometric functions are
+// available, e.g. for gcc/glibc: cxxflags="-O3 -mavx2 -ffast-math"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+typedef bg::srs::spheroid<double> spheroid_type;
+
+
+std::vector<point_type> make_points(int count, unsigned int seed)
+{
+    std::vector<point_type> result;
+    result.reserve(count);
+    unsigned int state = seed;
+    for (int i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        double const lon = ((state >> 8) % 360000) / 1000.0 - 180.0;
+        state = state * 1103515245u + 12345u;
+        double const lat = ((state >> 8) % 180000) / 1000.0 - 90.0;
+        result.push_back(point_type(lon, lat));
+    }
+    return result;
+}
+
+
+template <typename Strategy>
+bool run(std::string const& name, Strategy const& strategy,
+         std::vector<point_type> const& points1,
+         std::vector<point_type> const& points2,
+         int runs)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    std::size_t const count = points1.size();
+    std::vector<double> scalar(count), batch(count);
+
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        clock_type::time_point start = clock_type::now();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            scalar[i] = strategy.apply(points1[i], points2[i]);
+        }
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        strategy.apply_batch(points1.begin(), points1.end(), points2.begin(),
+                             batch.begin());
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    double max_difference = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const d = std::fabs(scalar[i] - batch[i])
+                       / (std::max)(1.0, std::fabs(scalar[i]));
+        max_difference = (std::max)(max_difference, d);
+    }
+
+    std::cout << name << std::endl
+              << "  pair by pair:   " << t1 / runs << " s" << std::endl
+              << "  batch:          " << t2 / runs << " s" << std::endl
+              << "  speedup:        " << t1 / t2 << std::endl
+              << "  max relative difference: " << max_difference << std::endl;
+
+    return max_difference <= 1e-10;
+}
+
+
+int main(int argc, char** argv)
+{
+    int const count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::vector<point_type> const points1 = make_points(count, 1);
+    std::vector<point_type> const points2 = make_points(count, 2);
+
+    bool ok = true;
+    ok = run("vincenty", bg::strategy::distance::vincenty<spheroid_type>(),
+             points1, points2, runs) && ok;
+    ok = run("thomas", bg::strategy::distance::thomas<spheroid_type>(),
+             points1, points2, runs) && ok;
+    ok = run("andoyer", bg::strategy::distance::andoyer<spheroid_type>(),
+             points1, points2, runs) && ok;
+
+    std::cout << "same result:    " << (ok ? "yes" : "no") << std::endl;
+
+    return ok ? 0 : 1;
+}
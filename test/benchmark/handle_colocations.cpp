@@ -0,0 +1,321 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares handle_colocations with the former way of clustering: a map of
+// turn operations per segment, and a map with a cluster per segment and
+// fraction. Input are two grids of parcels, sharing all their edges in
+// one direction, as adjacent parcels in cadastral data, which gives many
+// colocated turns.
+
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/algorithms/detail/overlay/handle_colocations.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+typedef bg::signed_size_type signed_size_type;
+typedef std::map<signed_size_type, std::set<signed_size_type> > clusters_type;
+
+
+namespace former
+{
+
+struct turn_operation_index
+{
+    turn_operation_index(signed_size_type ti, signed_size_type oi)
+        : turn_index(ti)
+        , op_index(oi)
+    {}
+
+    signed_size_type turn_index;
+    signed_size_type op_index;
+};
+
+template <typename Turns>
+struct less_by_fraction
+{
+    less_by_fraction(Turns const& turns) : m_turns(turns) {}
+
+    bool operator()(turn_operation_index const& left,
+                    turn_operation_index const& right) const
+    {
+        typename Turns::value_type const& lt = m_turns[left.turn_index];
+        typename Turns::value_type const& rt = m_turns[right.turn_index];
+        if (! (lt.operations[left.op_index].fraction
+               == rt.operations[right.op_index].fraction))
+        {
+            return lt.operations[left.op_index].fraction
+                < rt.operations[right.op_index].fraction;
+        }
+        bool const lxx = lt.both(bg::detail::overlay::operation_blocked);
+        bool const rxx = rt.both(bg::detail::overlay::operation_blocked);
+        if (lxx != rxx)
+        {
+            return lxx;
+        }
+        bool const luu = lt.both(bg::detail::overlay::operation_union);
+        bool const ruu = rt.both(bg::detail::overlay::operation_union);
+        if (luu != ruu)
+        {
+            return luu;
+        }
+        return lt.operations[1 - left.op_index].seg_id
+            < rt.operations[1 - right.op_index].seg_id;
+    }
+
+    Turns const& m_turns;
+};
+
+template <typename Ratio>
+struct key
+{
+    key(bg::segment_identifier const& id, Ratio const& fr)
+        : seg_id(id), fraction(fr)
+    {}
+
+    bool operator<(key const& other) const
+    {
+        return seg_id == other.seg_id
+            ? fraction < other.fraction
+            : seg_id < other.seg_id;
+    }
+
+    bg::segment_identifier seg_id;
+    Ratio fraction;
+};
+
+template <typename Op, typename Map>
+signed_size_type get_id(Op const& op, Map const& map)
+{
+    typename Map::const_iterator it
+        = map.find(typename Map::key_type(op.seg_id, op.fraction));
+    return it == map.end() ? -1 : it->second;
+}
+
+template <typename Op, typename Map>
+void set_id(Op const& op, Map& map, signed_size_type id)
+{
+    map[typename Map::key_type(op.seg_id, op.fraction)] = id;
+}
+
+// The former handle_colocations, without the debug output
+template <typename Turns>
+bool handle_colocations(Turns& turns, clusters_type& clusters)
+{
+    typedef typename Turns::value_type turn_type;
+    typedef std::map
+        <
+            bg::segment_identifier, std::vector<turn_operation_index>
+        > map_type;
+    typedef std::map
+        <
+            key<typename turn_type::segment_ratio_type>, signed_size_type
+        > cluster_map_type;
+
+    map_type map;
+    for (std::size_t i = 0; i < turns.size(); i++)
+    {
+        map[turns[i].operations[0].seg_id].push_back(turn_operation_index(i, 0));
+        map[turns[i].operations[1].seg_id].push_back(turn_operation_index(i, 1));
+    }
+
+    bool colocations = false;
+    for (typename map_type::iterator it = map.begin(); it != map.end(); ++it)
+    {
+        if (it->second.size() > 1u)
+        {
+            colocations = true;
+        }
+        std::sort(it->second.begin(), it->second.end(),
+                  less_by_fraction<Turns>(turns));
+    }
+    if (! colocations)
+    {
+        return false;
+    }
+
+    cluster_map_type cluster_map;
+    signed_size_type cluster_id = 0;
+    for (typename map_type::const_iterator it = map.begin(); it != map.end(); ++it)
+    {
+        std::vector<turn_operation_index> const& ops = it->second;
+        turn_operation_index ref = ops.front();
+        signed_size_type ref_id = -1;
+        for (std::size_t i = 1; i < ops.size(); i++)
+        {
+            turn_type& ref_turn = turns[ref.turn_index];
+            turn_type& turn = turns[ops[i].turn_index];
+            if (! (ref_turn.operations[ref.op_index].fraction
+                   == turn.operations[ops[i].op_index].fraction))
+            {
+                ref = ops[i];
+                ref_id = -1;
+                continue;
+            }
+            if (ref_id == -1)
+            {
+                signed_size_type const cid0 = get_id(ref_turn.operations[0], cluster_map);
+                signed_size_type const cid1 = get_id(ref_turn.operations[1], cluster_map);
+                if (cid0 == -1 && cid1 == -1)
+                {
+                    ref_id = ++cluster_id;
+                    set_id(ref_turn.operations[0], cluster_map, ref_id);
+                    set_id(ref_turn.operations[1], cluster_map, ref_id);
+                }
+                else if (cid0 == -1)
+                {
+                    ref_id = cid1;
+                    set_id(ref_turn.operations[0], cluster_map, ref_id);
+                }
+                else
+                {
+                    ref_id = cid0;
+                    if (cid1 == -1)
+                    {
+                        set_id(ref_turn.operations[1], cluster_map, ref_id);
+                    }
+                }
+            }
+            if (get_id(turn.operations[1 - ops[i].op_index], cluster_map) == -1)
+            {
+                set_id(turn.operations[1 - ops[i].op_index], cluster_map, ref_id);
+            }
+            if (ref_turn.both(bg::detail::overlay::operation_blocked))
+            {
+                turn.discarded = true;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < turns.size(); i++)
+    {
+        if (turns[i].discarded)
+        {
+            continue;
+        }
+        for (int j = 0; j < 2; j++)
+        {
+            signed_size_type const id = get_id(turns[i].operations[j], cluster_map);
+            if (id != -1)
+            {
+                turns[i].cluster_id = id;
+                clusters[id].insert(i);
+            }
+        }
+    }
+    bg::detail::overlay::remove_clusters(turns, clusters);
+    return true;
+}
+
+} // namespace former
+
+
+// Parcels of one by one, in rows of n parcels
+multi_polygon_type make_parcels(int n, double dx)
+{
+    multi_polygon_type result;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            polygon_type parcel;
+            bg::exterior_ring(parcel).push_back(point_type(dx + i, j));
+            bg::exterior_ring(parcel).push_back(point_type(dx + i, j + 1));
+            bg::exterior_ring(parcel).push_back(point_type(dx + i + 1, j + 1));
+            bg::exterior_ring(parcel).push_back(point_type(dx + i + 1, j));
+            bg::exterior_ring(parcel).push_back(point_type(dx + i, j));
+            result.push_back(parcel);
+        }
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const n = argc > 1 ? std::atoi(argv[1]) : 100;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    // The second grid is shifted half a parcel, horizontal edges are shared
+    multi_polygon_type const parcels1 = make_parcels(n, 0.0);
+    multi_polygon_type const parcels2 = make_parcels(n, 0.5);
+
+    typedef bg::detail::no_rescale_policy robust_policy_type;
+    typedef bg::detail::overlay::traversal_turn_info
+        <
+            point_type,
+            bg::segment_ratio_type<point_type, robust_policy_type>::type
+        > turn_info;
+    typedef std::deque<turn_info> turns_type;
+
+    robust_policy_type robust_policy;
+    turns_type turns;
+    bg::detail::get_turns::no_interrupt_policy policy;
+    bg::get_turns
+        <
+            false, false,
+            bg::detail::overlay::assign_null_policy
+        >(parcels1, parcels2, robust_policy, turns, policy);
+
+    turns_type turns1, turns2;
+    clusters_type clusters1, clusters2;
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        turns1 = turns;
+        clusters1.clear();
+        clock_type::time_point start = clock_type::now();
+        former::handle_colocations(turns1, clusters1);
+        duration_type d1 = clock_type::now() - start;
+
+        turns2 = turns;
+        clusters2.clear();
+        start = clock_type::now();
+        bg::detail::overlay::handle_colocations<false, false>(turns2,
+                clusters2, parcels1, parcels2);
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    bool same = clusters1 == clusters2;
+    for (std::size_t i = 0; same && i < turns.size(); i++)
+    {
+        same = turns1[i].cluster_id == turns2[i].cluster_id
+            && turns1[i].discarded == turns2[i].discarded;
+    }
+
+    std::cout << "handle_colocations, " << n << " x " << n << " parcels, "
+              << turns.size() << " turns, "
+              << clusters2.size() << " clusters" << std::endl
+              << "  maps:           " << t1 / runs << " s" << std::endl
+              << "  sorted vector:  " << t2 / runs << " s" << std::endl
+              << "  speedup:        " << t1 / t2 << std::endl
+              << "  same result:    " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
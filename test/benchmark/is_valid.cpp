@@ -0,0 +1,98 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares is_valid with parallel_is_valid for a multi-polygon of many
+// parcels, each with a hole touching its exterior ring. Adjacent parcels
+// touch each other at their corners.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/extensions/algorithms/parallel_is_valid.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+multi_polygon_type make_parcels(int n)
+{
+    multi_polygon_type result;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            double const x = 2.0 * i + (j % 2);
+            double const y = j;
+            polygon_type parcel;
+            bg::exterior_ring(parcel).push_back(point_type(x, y));
+            bg::exterior_ring(parcel).push_back(point_type(x, y + 1));
+            bg::exterior_ring(parcel).push_back(point_type(x + 1, y + 1));
+            bg::exterior_ring(parcel).push_back(point_type(x + 1, y));
+            bg::exterior_ring(parcel).push_back(point_type(x, y));
+
+            bg::interior_rings(parcel).resize(1);
+            bg::interior_rings(parcel).front().push_back(point_type(x, y + 0.5));
+            bg::interior_rings(parcel).front().push_back(point_type(x + 0.5, y + 0.2));
+            bg::interior_rings(parcel).front().push_back(point_type(x + 0.8, y + 0.5));
+            bg::interior_rings(parcel).front().push_back(point_type(x + 0.5, y + 0.8));
+            bg::interior_rings(parcel).front().push_back(point_type(x, y + 0.5));
+            result.push_back(parcel);
+        }
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const n = argc > 1 ? std::atoi(argv[1]) : 100;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 5;
+    std::size_t const threads = argc > 3 ? std::atoi(argv[3]) : 0;
+
+    multi_polygon_type const parcels = make_parcels(n);
+
+    std::string message1, message2;
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        clock_type::time_point start = clock_type::now();
+        bg::is_valid(parcels, message1);
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        bg::parallel_is_valid(parcels, message2, threads);
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    bool const same = message1 == message2;
+
+    std::cout << "is_valid, " << n << " x " << n << " parcels with a hole: "
+              << message1 << std::endl
+              << "  serial:         " << t1 / runs << " s" << std::endl
+              << "  parallel:       " << t2 / runs << " s" << std::endl
+              << "  speedup:        " << t1 / t2 << std::endl
+              << "  same result:    " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares projecting points one by one (projection::forward) with
+// projecting them in batches (projection::forward_n), for projections
+// having a branch free batch version.
+// The batches are only vectorized if vectorized trigonometric functions are
+// available, e.g. for gcc/glibc: cxxflags="-O3 -mavx2 -ffast-math"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/extensions/gis/latlong/point_ll.hpp>
+#include <boost/geometry/extensions/gis/projections/factory.hpp>
+#include <boost/geometry/extensions/gis/projections/parameters.hpp>
+#include <boost/geometry/extensions/gis/projections/projection.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::ll::point<bg::degree, double> lonlat_type;
+typedef bg::model::d2::point_xy<double> xy_type;
+typedef bg::projections::projection<lonlat_type, xy_type> projection_type;
+
+
+bool run(std::string const& parameters,
+         std::vector<double> const& lon, std::vector<double> const& lat,
+         int runs)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    bg::projections::parameters params
+        = bg::projections::detail::pj_init_plus(parameters);
+    bg::projections::factory<lonlat_type, xy_type, bg::projections::parameters> pf;
+    boost::shared_ptr<projection_type> prj(pf.create_new(params));
+
+    std::size_t const count = lon.size();
+    std::vector<xy_type> single(count);
+    std::vector<double> x(count), y(count);
+
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        clock_type::time_point start = clock_type::now();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            lonlat_type ll;
+            ll.lon(lon[i]);
+            ll.lat(lat[i]);
+            prj->forward(ll, single[i]);
+        }
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        prj->forward_n(&lon[0], &lat[0], &x[0], &y[0], count);
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    double max_difference = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const dx = std::fabs(bg::get<0>(single[i]) - x[i]);
+        double const dy = std::fabs(bg::get<1>(single[i]) - y[i]);
+        max_difference = (std::max)(max_difference, (std::max)(dx, dy));
+    }
+
+    std::cout << parameters << std::endl
+              << "  point by point: " << t1 / runs << " s" << std::endl
+              << "  batch:          " << t2 / runs << " s" << std::endl
+              << "  speedup:        " << t1 / t2 << std::endl
+              << "  max difference: " << max_difference << " m" << std::endl;
+
+    // Millimeters
+    return max_difference <= 1.0e-3;
+}
+
+
+int main(int argc, char** argv)
+{
+    int const count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    // Points in Europe, where all projections below are valid
+    std::vector<double> lon, lat;
+    unsigned int state = 1;
+    for (int i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        lon.push_back(((state >> 8) % 40000) / 1000.0 - 10.0);
+        state = state * 1103515245u + 12345u;
+        lat.push_back(((state >> 8) % 30000) / 1000.0 + 35.0);
+    }
+
+    bool ok = true;
+    ok = run("+proj=merc +ellps=WGS84 +units=m", lon, lat, runs) && ok;
+    ok = run("+proj=tmerc +ellps=WGS84 +units=m +lon_0=9", lon, lat, runs) && ok;
+    ok = run("+proj=etmerc +ellps=WGS84 +units=m +lon_0=9", lon, lat, runs) && ok;
+    ok = run("+proj=lcc +ellps=WGS84 +units=m +lat_1=35 +lat_2=65 +lon_0=10", lon, lat, runs) && ok;
+    ok = run("+proj=aea +ellps=WGS84 +units=m +lat_1=43 +lat_2=62 +lon_0=10", lon, lat, runs) && ok;
+    ok = run("+proj=laea +ellps=WGS84 +units=m +lat_0=52 +lon_0=10", lon, lat, runs) && ok;
+    ok = run("+proj=stere +ellps=WGS84 +units=m +lat_0=52 +lon_0=10", lon, lat, runs) && ok;
+
+    std::cout << "same result:    " << (ok ? "yes" : "no") << std::endl;
+
+    return ok ? 0 : 1;
+}
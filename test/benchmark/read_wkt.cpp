@@ -0,0 +1,144 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares read_wkt with the former way of parsing: boost::tokenizer with
+// a lexical_cast per coordinate, on large polygons
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <boost/chrono.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/tokenizer.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+
+// The former implementation, reduced to polygons without error handling
+void tokenizer_read(std::string const& wkt, polygon_type& polygon)
+{
+    typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
+    tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+
+    bg::clear(polygon);
+    int ring_index = -1;
+    int depth = 0;
+    bg::model::ring<point_type>* ring = NULL;
+    for (tokenizer::iterator it = tokens.begin(); it != tokens.end(); )
+    {
+        if (*it == "(")
+        {
+            if (++depth == 2)
+            {
+                if (++ring_index == 0)
+                {
+                    ring = &bg::exterior_ring(polygon);
+                }
+                else
+                {
+                    bg::interior_rings(polygon).resize(ring_index);
+                    ring = &bg::interior_rings(polygon).back();
+                }
+            }
+            ++it;
+        }
+        else if (*it == ")")
+        {
+            depth--;
+            ++it;
+        }
+        else if (*it == "," || depth < 2)
+        {
+            ++it;
+        }
+        else
+        {
+            point_type p;
+            bg::set<0>(p, boost::lexical_cast<double>(*it++));
+            bg::set<1>(p, boost::lexical_cast<double>(*it++));
+            ring->push_back(p);
+        }
+    }
+}
+
+
+std::string make_polygon_wkt(int point_count, int holes)
+{
+    std::ostringstream out;
+    out.precision(15);
+    out << "POLYGON((";
+    for (int i = 0; i <= point_count; i++)
+    {
+        double const angle = (i % point_count) * 2.0 * 3.14159265358979 / point_count;
+        double const radius = 1000.0 + 10.0 * std::sin(angle * 37.0);
+        out << (i > 0 ? "," : "")
+            << 150000.0 + radius * std::cos(angle) << " "
+            << 450000.0 + radius * std::sin(angle);
+    }
+    out << ")";
+    for (int h = 0; h < holes; h++)
+    {
+        double const x = 150000.0 - 500.0 + h * 10.0;
+        out << ",(" << x << " 450000.5," << x + 5.25 << " 450000.5,"
+            << x + 5.25 << " 450005.125," << x << " 450000.5)";
+    }
+    out << ")";
+    return out.str();
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const point_count = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    std::string const wkt = make_polygon_wkt(point_count, 50);
+    std::cout << "WKT size: " << wkt.size() << " bytes, "
+              << point_count << " points" << std::endl;
+
+    polygon_type p1, p2;
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        clock_type::time_point start = clock_type::now();
+        tokenizer_read(wkt, p1);
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        bg::read_wkt(wkt, p2);
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    bool const same = bg::num_points(p1) == bg::num_points(p2)
+        && bg::equals(p1, p2);
+
+    std::cout << "tokenizer + lexical_cast: " << t1 / runs << " s" << std::endl
+              << "read_wkt:                 " << t2 / runs << " s" << std::endl
+              << "speedup:                  " << t1 / t2 << std::endl
+              << "same result:              " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
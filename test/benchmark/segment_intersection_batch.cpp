@@ -0,0 +1,143 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares relating each segment to a block of segments (as get_turns does
+// for two sections) by relate_cartesian_segments, pair by pair, with
+// filtering disjoint pairs in one pass by segment_batch first, and relating
+// the other pairs pair by pair.
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/strategies/cartesian/cart_intersect_batch.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::referring_segment<point_type const> segment_type;
+
+static const std::size_t block_size = 10;
+
+
+std::vector<point_type> make_points(int count, unsigned int seed,
+                                    double dx, double dy)
+{
+    // Random walk, as a linestring, with short steps
+    std::vector<point_type> result;
+    result.reserve(count);
+    unsigned int state = seed;
+    double x = dx, y = dy;
+    for (int i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        x += ((state >> 8) % 2001) / 1000.0 - 1.0;
+        state = state * 1103515245u + 12345u;
+        y += ((state >> 8) % 2001) / 1000.0 - 1.0;
+        result.push_back(point_type(x, y));
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    typedef bg::strategy::intersection::relate_cartesian_segments
+        <
+            bg::policies::relate::segments_direction
+        > strategy_type;
+
+    int const count = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int const runs = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    // The same walk, shifted, so blocks overlap as sections in get_turns
+    std::vector<point_type> const points1 = make_points(count, 1, 0.0, 0.0);
+    std::vector<point_type> const points2 = make_points(count, 1, 0.3, 0.2);
+    bg::detail::no_rescale_policy robust_policy;
+
+    std::size_t scalar_count = 0, batch_count = 0, filtered_count = 0;
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        scalar_count = 0;
+        batch_count = 0;
+        filtered_count = 0;
+
+        clock_type::time_point start = clock_type::now();
+        for (std::size_t b = 0; b + block_size < points2.size(); b += block_size)
+        {
+            for (std::size_t i = b; i + 1 < b + block_size; i++)
+            {
+                segment_type const a(points1[i], points1[i + 1]);
+                for (std::size_t j = b; j < b + block_size; j++)
+                {
+                    segment_type const s(points2[j], points2[j + 1]);
+                    if (strategy_type::apply(a, s, robust_policy).how != 'd')
+                    {
+                        scalar_count++;
+                    }
+                }
+            }
+        }
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        for (std::size_t b = 0; b + block_size < points2.size(); b += block_size)
+        {
+            bg::strategy::intersection::detail::segment_batch<block_size> batch;
+            for (std::size_t j = b; j < b + block_size; j++)
+            {
+                batch.push_back(points2[j], points2[j + 1]);
+            }
+
+            unsigned char disjoint[block_size];
+            for (std::size_t i = b; i + 1 < b + block_size; i++)
+            {
+                batch.filter(points1[i], points1[i + 1], disjoint);
+
+                segment_type const a(points1[i], points1[i + 1]);
+                for (std::size_t j = b; j < b + block_size; j++)
+                {
+                    if (disjoint[j - b])
+                    {
+                        filtered_count++;
+                        continue;
+                    }
+                    segment_type const s(points2[j], points2[j + 1]);
+                    if (strategy_type::apply(a, s, robust_policy).how != 'd')
+                    {
+                        batch_count++;
+                    }
+                }
+            }
+        }
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    bool const ok = scalar_count == batch_count;
+
+    std::cout << "segment intersection, blocks of " << block_size << std::endl
+              << "  pair by pair:   " << t1 / runs << " s" << std::endl
+              << "  batch filter:   " << t2 / runs << " s" << std::endl
+              << "  speedup:        " << t1 / t2 << std::endl
+              << "  filtered pairs: " << filtered_count << std::endl
+              << "  same result:    " << (ok ? "yes" : "no") << std::endl;
+
+    return ok ? 0 : 1;
+}
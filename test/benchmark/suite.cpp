@@ -0,0 +1,759 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmark suite of the main algorithms and strategies, on generated
+// datasets: random stars, star_comb, recursive polygons, a grid of parcels,
+// random points and a random walk. Times are reported per case, and written
+// as JSON to track performance over releases.
+//
+// Usage: suite [--runs n] [--scale n] [--filter text] [--json filename]
+//   --runs    number of timed runs per case (default 5)
+//   --scale   multiplies the sizes of the datasets (default 1)
+//   --filter  only runs cases of which the algorithm or dataset contains text
+//   --json    writes the results to filename, or to stdout if it is "-"
+//
+// The check values of the cases (areas, counts, lengths) should be the same
+// for all runs on all platforms. If they change, the times are not comparable.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include "benchmark_datasets.hpp"
+#include "benchmark_report.hpp"
+
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::box<point_type> box_type;
+typedef std::vector<polygon_type> parcels_type;
+
+typedef bg::model::point
+    <
+        double, 2, bg::cs::spherical_equatorial<bg::degree>
+    > spherical_point_type;
+typedef bg::model::polygon<spherical_point_type> spherical_polygon_type;
+
+
+struct intersection_operation
+{
+    template <typename G1, typename G2>
+    static inline void apply(G1 const& g1, G2 const& g2, multi_polygon_type& out)
+    {
+        bg::intersection(g1, g2, out);
+    }
+};
+
+struct union_operation
+{
+    template <typename G1, typename G2>
+    static inline void apply(G1 const& g1, G2 const& g2, multi_polygon_type& out)
+    {
+        bg::union_(g1, g2, out);
+    }
+};
+
+struct difference_operation
+{
+    template <typename G1, typename G2>
+    static inline void apply(G1 const& g1, G2 const& g2, multi_polygon_type& out)
+    {
+        bg::difference(g1, g2, out);
+    }
+};
+
+struct sym_difference_operation
+{
+    template <typename G1, typename G2>
+    static inline void apply(G1 const& g1, G2 const& g2, multi_polygon_type& out)
+    {
+        bg::sym_difference(g1, g2, out);
+    }
+};
+
+
+// Cases return a check value, which is the area, length, or count of
+// their output
+
+template <typename Operation, typename Geometry1, typename Geometry2>
+struct overlay_case
+{
+    Geometry1 const& geometry1;
+    Geometry2 const& geometry2;
+
+    overlay_case(Geometry1 const& g1, Geometry2 const& g2)
+        : geometry1(g1), geometry2(g2)
+    {}
+
+    double operator()() const
+    {
+        multi_polygon_type result;
+        Operation::apply(geometry1, geometry2, result);
+        return bg::area(result);
+    }
+};
+
+// Intersects each parcel with the clip polygon
+struct clip_case
+{
+    parcels_type const& parcels;
+    polygon_type const& clip;
+
+    clip_case(parcels_type const& p, polygon_type const& c)
+        : parcels(p), clip(c)
+    {}
+
+    double operator()() const
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < parcels.size(); i++)
+        {
+            multi_polygon_type result;
+            bg::intersection(parcels[i], clip, result);
+            sum += bg::area(result);
+        }
+        return sum;
+    }
+};
+
+template <typename Geometry, typename JoinStrategy>
+struct buffer_case
+{
+    Geometry const& geometry;
+    double distance;
+    JoinStrategy join;
+
+    buffer_case(Geometry const& g, double d, JoinStrategy const& j)
+        : geometry(g), distance(d), join(j)
+    {}
+
+    double operator()() const
+    {
+        multi_polygon_type result;
+        bg::buffer(geometry, result,
+            bg::strategy::buffer::distance_symmetric<double>(distance),
+            bg::strategy::buffer::side_straight(),
+            join,
+            bg::strategy::buffer::end_round(36),
+            bg::strategy::buffer::point_circle(36));
+        return bg::area(result);
+    }
+};
+
+// Counts the points within any of the polygons
+template <typename Strategy>
+struct within_case
+{
+    multi_point_type const& points;
+    multi_polygon_type const& polygons;
+
+    within_case(multi_point_type const& p, multi_polygon_type const& mp)
+        : points(p), polygons(mp)
+    {}
+
+    double operator()() const
+    {
+        Strategy const strategy;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            for (std::size_t j = 0; j < polygons.size(); j++)
+            {
+                if (bg::within(points[i], polygons[j], strategy))
+                {
+                    count++;
+                    break;
+                }
+            }
+        }
+        return static_cast<double>(count);
+    }
+};
+
+// Sums the distances of all points to the geometry
+template <typename Geometry>
+struct distance_case
+{
+    multi_point_type const& points;
+    Geometry const& geometry;
+
+    distance_case(multi_point_type const& p, Geometry const& g)
+        : points(p), geometry(g)
+    {}
+
+    double operator()() const
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            sum += bg::distance(points[i], geometry);
+        }
+        return sum;
+    }
+};
+
+// Sums the distances between consecutive points, using the strategy
+template <typename Point, typename Strategy>
+struct point_distance_case
+{
+    std::vector<Point> const& points;
+    Strategy strategy;
+
+    point_distance_case(std::vector<Point> const& p, Strategy const& s)
+        : points(p), strategy(s)
+    {}
+
+    double operator()() const
+    {
+        double sum = 0;
+        for (std::size_t i = 1; i < points.size(); i++)
+        {
+            sum += bg::distance(points[i - 1], points[i], strategy);
+        }
+        return sum;
+    }
+};
+
+struct simplify_case
+{
+    linestring_type const& linestring;
+    double tolerance;
+
+    simplify_case(linestring_type const& ls, double t)
+        : linestring(ls), tolerance(t)
+    {}
+
+    double operator()() const
+    {
+        linestring_type result;
+        bg::simplify(linestring, result, tolerance);
+        return static_cast<double>(result.size());
+    }
+};
+
+// Sums the areas of all polygons
+template <typename Polygons>
+struct area_case
+{
+    Polygons const& polygons;
+
+    explicit area_case(Polygons const& p)
+        : polygons(p)
+    {}
+
+    double operator()() const
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            sum += bg::area(polygons[i]);
+        }
+        return sum;
+    }
+};
+
+// Counts the valid polygons
+template <typename Polygons>
+struct is_valid_case
+{
+    Polygons const& polygons;
+
+    explicit is_valid_case(Polygons const& p)
+        : polygons(p)
+    {}
+
+    double operator()() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            if (bg::is_valid(polygons[i]))
+            {
+                count++;
+            }
+        }
+        return static_cast<double>(count);
+    }
+};
+
+template <typename Geometry>
+struct convex_hull_case
+{
+    Geometry const& geometry;
+
+    explicit convex_hull_case(Geometry const& g)
+        : geometry(g)
+    {}
+
+    double operator()() const
+    {
+        polygon_type hull;
+        bg::convex_hull(geometry, hull);
+        return bg::area(hull);
+    }
+};
+
+// Sums the widths of the envelopes of all parcels
+struct envelope_case
+{
+    parcels_type const& parcels;
+
+    explicit envelope_case(parcels_type const& p)
+        : parcels(p)
+    {}
+
+    double operator()() const
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < parcels.size(); i++)
+        {
+            box_type const box = bg::return_envelope<box_type>(parcels[i]);
+            sum += bg::get<bg::max_corner, 0>(box) - bg::get<bg::min_corner, 0>(box);
+        }
+        return sum;
+    }
+};
+
+// Counts the pairs of horizontally adjacent parcels which touch
+struct touches_case
+{
+    parcels_type const& parcels;
+    std::size_t cell_count;
+
+    touches_case(parcels_type const& p, std::size_t n)
+        : parcels(p), cell_count(n)
+    {}
+
+    double operator()() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i + 1 < parcels.size(); i++)
+        {
+            if ((i + 1) % cell_count != 0 && bg::touches(parcels[i], parcels[i + 1]))
+            {
+                count++;
+            }
+        }
+        return static_cast<double>(count);
+    }
+};
+
+// Counts the stars of the first set intersecting a star of the second set
+struct intersects_case
+{
+    multi_polygon_type const& stars1;
+    multi_polygon_type const& stars2;
+
+    intersects_case(multi_polygon_type const& s1, multi_polygon_type const& s2)
+        : stars1(s1), stars2(s2)
+    {}
+
+    double operator()() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < stars1.size() && i < stars2.size(); i++)
+        {
+            if (bg::intersects(stars1[i], stars2[i]))
+            {
+                count++;
+            }
+        }
+        return static_cast<double>(count);
+    }
+};
+
+struct read_wkt_case
+{
+    std::vector<std::string> const& wkts;
+
+    explicit read_wkt_case(std::vector<std::string> const& w)
+        : wkts(w)
+    {}
+
+    double operator()() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < wkts.size(); i++)
+        {
+            polygon_type polygon;
+            bg::read_wkt(wkts[i], polygon);
+            count += bg::num_points(polygon);
+        }
+        return static_cast<double>(count);
+    }
+};
+
+struct write_wkt_case
+{
+    parcels_type const& parcels;
+
+    explicit write_wkt_case(parcels_type const& p)
+        : parcels(p)
+    {}
+
+    double operator()() const
+    {
+        std::ostringstream out;
+        for (std::size_t i = 0; i < parcels.size(); i++)
+        {
+            out << bg::wkt(parcels[i]) << std::endl;
+        }
+        return static_cast<double>(out.str().size());
+    }
+};
+
+typedef std::pair<box_type, std::size_t> rtree_value_type;
+
+// Builds an rtree of the envelopes, by packing or by inserting one by one
+template <typename Parameters>
+struct rtree_build_case
+{
+    std::vector<rtree_value_type> const& values;
+    bool pack;
+
+    rtree_build_case(std::vector<rtree_value_type> const& v, bool p)
+        : values(v), pack(p)
+    {}
+
+    double operator()() const
+    {
+        typedef bgi::rtree<rtree_value_type, Parameters> rtree_type;
+        if (pack)
+        {
+            rtree_type const rtree(values.begin(), values.end());
+            return static_cast<double>(rtree.size());
+        }
+        rtree_type rtree;
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            rtree.insert(values[i]);
+        }
+        return static_cast<double>(rtree.size());
+    }
+};
+
+// Counts the envelopes intersecting, and the nearest envelopes of, the points
+template <typename Parameters>
+struct rtree_query_case
+{
+    typedef bgi::rtree<rtree_value_type, Parameters> rtree_type;
+
+    rtree_type rtree;
+    multi_point_type const& points;
+    bool nearest;
+
+    rtree_query_case(std::vector<rtree_value_type> const& v,
+                     multi_point_type const& p, bool n)
+        : rtree(v.begin(), v.end()), points(p), nearest(n)
+    {}
+
+    double operator()() const
+    {
+        std::size_t count = 0;
+        std::vector<rtree_value_type> result;
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            result.clear();
+            if (nearest)
+            {
+                rtree.query(bgi::nearest(points[i], 5), std::back_inserter(result));
+            }
+            else
+            {
+                rtree.query(bgi::intersects(points[i]), std::back_inserter(result));
+            }
+            count += result.size();
+        }
+        return static_cast<double>(count);
+    }
+};
+
+
+template <typename Range>
+inline std::size_t total_points(Range const& range)
+{
+    std::size_t result = 0;
+    for (typename Range::const_iterator it = range.begin(); it != range.end(); ++it)
+    {
+        result += bg::num_points(*it);
+    }
+    return result;
+}
+
+inline std::string dataset_name(std::string const& name, int parameter)
+{
+    std::ostringstream out;
+    out << name << "_" << parameter;
+    return out.str();
+}
+
+
+int main(int argc, char** argv)
+{
+    int runs = 5;
+    int scale = 1;
+    std::string filter, json;
+    for (int i = 1; i < argc; i += 2)
+    {
+        std::string const option = argv[i];
+        bool const has_value = i + 1 < argc;
+        if (has_value && option == "--runs") { runs = std::atoi(argv[i + 1]); }
+        else if (has_value && option == "--scale") { scale = std::atoi(argv[i + 1]); }
+        else if (has_value && option == "--filter") { filter = argv[i + 1]; }
+        else if (has_value && option == "--json") { json = argv[i + 1]; }
+        else
+        {
+            // Unknown options, and options without value, are not ignored
+            std::cerr << "Usage: " << argv[0]
+                << " [--runs n] [--scale n] [--filter text] [--json filename]"
+                << std::endl;
+            return 1;
+        }
+    }
+    if (scale < 1)
+    {
+        scale = 1;
+    }
+
+    // If JSON is written to stdout, results are listed on stderr
+    benchmark::report report(runs, filter, json == "-" ? std::cerr : std::cout);
+
+    // Datasets
+    int const star_cells = 10 * scale;
+    multi_polygon_type stars1, stars2;
+    benchmark::random_stars(stars1, star_cells, 50, 1);
+    benchmark::random_stars(stars2, star_cells, 50, 2);
+    std::string const stars_name = dataset_name("random_stars", star_cells);
+
+    int const teeth = 50 * scale;
+    polygon_type star, comb;
+    benchmark::star_comb(star, comb, teeth);
+    std::string const star_comb_name = dataset_name("star_comb", teeth);
+
+    int const level = 9 + scale;
+    multi_polygon_type recursive1, recursive2;
+    benchmark::recursive_polygons(recursive1, level, 40 * scale, 1);
+    benchmark::recursive_polygons(recursive2, level, 40 * scale, 2);
+    std::string const recursive_name = dataset_name("recursive_polygons", level);
+
+    int const grid_cells = 50 * scale;
+    parcels_type parcels;
+    benchmark::grid(parcels, grid_cells, 4, 0.2, 1);
+    std::string const grid_name = dataset_name("grid", grid_cells);
+    polygon_type clip;
+    benchmark::make_star(bg::exterior_ring(clip), 100,
+                         50.0 * grid_cells, 50.0 * grid_cells,
+                         50.0 * grid_cells, 30.0 * grid_cells);
+
+    multi_point_type star_points;
+    benchmark::random_points(star_points, 10000 * scale,
+                             0, 0, 10.0 * star_cells, 10.0 * star_cells, 3);
+    multi_point_type grid_points;
+    benchmark::random_points(grid_points, 10000 * scale,
+                             0, 0, 100.0 * grid_cells, 100.0 * grid_cells, 4);
+
+    linestring_type walk;
+    benchmark::random_walk(walk, 100000 * scale, 1.0, 5);
+    std::string const walk_name = dataset_name("random_walk", 100000 * scale);
+    linestring_type const short_walk(walk.begin(), walk.begin() + 10000 * scale);
+
+    multi_point_type walk_points;
+    benchmark::random_points(walk_points, 1000 * scale, -100, -100, 100, 100, 6);
+    multi_point_type distance_points(walk_points.begin(),
+                                     walk_points.begin() + 100 * scale);
+
+    std::vector<spherical_point_type> spherical_points;
+    benchmark::random_points(spherical_points, 100000 * scale, -180, -80, 180, 80, 7);
+    std::vector<point_type> cartesian_points;
+    benchmark::random_points(cartesian_points, 100000 * scale, -180, -80, 180, 80, 7);
+
+    std::vector<spherical_polygon_type> spherical_stars(100 * scale);
+    for (std::size_t i = 0; i < spherical_stars.size(); i++)
+    {
+        benchmark::make_star(bg::exterior_ring(spherical_stars[i]), 200,
+                             -170.0 + 340.0 * i / spherical_stars.size(), 0.0,
+                             5.0, 2.0);
+    }
+
+    std::vector<std::string> wkts;
+    for (std::size_t i = 0; i < parcels.size(); i++)
+    {
+        std::ostringstream out;
+        out << bg::wkt(parcels[i]);
+        wkts.push_back(out.str());
+    }
+
+    std::vector<rtree_value_type> envelopes;
+    for (std::size_t i = 0; i < parcels.size(); i++)
+    {
+        envelopes.push_back(std::make_pair(
+            bg::return_envelope<box_type>(parcels[i]), i));
+    }
+
+    std::size_t const stars_size = total_points(stars1) + total_points(stars2);
+    std::size_t const star_comb_size = bg::num_points(star) + bg::num_points(comb);
+    std::size_t const recursive_size = total_points(recursive1) + total_points(recursive2);
+    std::size_t const grid_size = total_points(parcels);
+
+    // Overlay
+    report.run("intersection", stars_name, "default", stars_size,
+        overlay_case<intersection_operation, multi_polygon_type, multi_polygon_type>(stars1, stars2));
+    report.run("union", stars_name, "default", stars_size,
+        overlay_case<union_operation, multi_polygon_type, multi_polygon_type>(stars1, stars2));
+    report.run("difference", stars_name, "default", stars_size,
+        overlay_case<difference_operation, multi_polygon_type, multi_polygon_type>(stars1, stars2));
+    report.run("sym_difference", stars_name, "default", stars_size,
+        overlay_case<sym_difference_operation, multi_polygon_type, multi_polygon_type>(stars1, stars2));
+
+    report.run("intersection", star_comb_name, "default", star_comb_size,
+        overlay_case<intersection_operation, polygon_type, polygon_type>(star, comb));
+    report.run("union", star_comb_name, "default", star_comb_size,
+        overlay_case<union_operation, polygon_type, polygon_type>(star, comb));
+    report.run("difference", star_comb_name, "default", star_comb_size,
+        overlay_case<difference_operation, polygon_type, polygon_type>(star, comb));
+
+    report.run("intersection", recursive_name, "default", recursive_size,
+        overlay_case<intersection_operation, multi_polygon_type, multi_polygon_type>(recursive1, recursive2));
+    report.run("union", recursive_name, "default", recursive_size,
+        overlay_case<union_operation, multi_polygon_type, multi_polygon_type>(recursive1, recursive2));
+
+    report.run("intersection", grid_name, "clip_per_parcel",
+        grid_size + bg::num_points(clip), clip_case(parcels, clip));
+
+    // Buffer
+    report.run("buffer", stars_name, "join_round",
+        total_points(stars1),
+        buffer_case<multi_polygon_type, bg::strategy::buffer::join_round>
+            (stars1, 0.5, bg::strategy::buffer::join_round(36)));
+    report.run("buffer", stars_name, "join_miter",
+        total_points(stars1),
+        buffer_case<multi_polygon_type, bg::strategy::buffer::join_miter>
+            (stars1, 0.5, bg::strategy::buffer::join_miter()));
+    report.run("buffer", dataset_name("random_walk", 10000 * scale), "join_round",
+        short_walk.size(),
+        buffer_case<linestring_type, bg::strategy::buffer::join_round>
+            (short_walk, 2.0, bg::strategy::buffer::join_round(36)));
+    report.run("buffer", dataset_name("random_points", 1000 * scale), "point_circle",
+        walk_points.size(),
+        buffer_case<multi_point_type, bg::strategy::buffer::join_round>
+            (walk_points, 5.0, bg::strategy::buffer::join_round(36)));
+
+    // Within, for all point-in-polygon strategies
+    report.run("within", stars_name, "winding", star_points.size() + total_points(stars1),
+        within_case<bg::strategy::within::winding<point_type> >(star_points, stars1));
+    report.run("within", stars_name, "franklin", star_points.size() + total_points(stars1),
+        within_case<bg::strategy::within::franklin<point_type> >(star_points, stars1));
+    report.run("within", stars_name, "crossings_multiply", star_points.size() + total_points(stars1),
+        within_case<bg::strategy::within::crossings_multiply<point_type> >(star_points, stars1));
+
+    // Distance
+    report.run("distance", walk_name, "projected_point", distance_points.size() + walk.size(),
+        distance_case<linestring_type>(distance_points, walk));
+    report.run("distance", stars_name, "projected_point", distance_points.size() + total_points(stars1),
+        distance_case<multi_polygon_type>(distance_points, stars1));
+    report.run("distance", dataset_name("random_points", 100000 * scale), "pythagoras",
+        cartesian_points.size(),
+        point_distance_case<point_type, bg::strategy::distance::pythagoras<> >
+            (cartesian_points, bg::strategy::distance::pythagoras<>()));
+    report.run("distance", dataset_name("random_points", 100000 * scale), "haversine",
+        spherical_points.size(),
+        point_distance_case<spherical_point_type, bg::strategy::distance::haversine<double> >
+            (spherical_points, bg::strategy::distance::haversine<double>(6371000.0)));
+
+    // Simplify
+    report.run("simplify", walk_name, "douglas_peucker_0.5", walk.size(),
+        simplify_case(walk, 0.5));
+    report.run("simplify", walk_name, "douglas_peucker_5", walk.size(),
+        simplify_case(walk, 5.0));
+
+    // Area, cartesian and spherical
+    report.run("area", grid_name, "surveyor", grid_size,
+        area_case<parcels_type>(parcels));
+    report.run("area", dataset_name("spherical_stars", 100 * scale), "huiller",
+        total_points(spherical_stars),
+        area_case<std::vector<spherical_polygon_type> >(spherical_stars));
+
+    // Validity, envelope, convex hull
+    report.run("is_valid", grid_name, "default", grid_size,
+        is_valid_case<parcels_type>(parcels));
+    report.run("is_valid", recursive_name, "default", total_points(recursive1),
+        is_valid_case<multi_polygon_type>(recursive1));
+    report.run("envelope", grid_name, "default", grid_size,
+        envelope_case(parcels));
+    report.run("convex_hull", stars_name, "graham_andrew", total_points(stars1),
+        convex_hull_case<multi_polygon_type>(stars1));
+    report.run("convex_hull", walk_name, "graham_andrew", walk.size(),
+        convex_hull_case<linestring_type>(walk));
+
+    // Relations
+    report.run("intersects", stars_name, "default", stars_size,
+        intersects_case(stars1, stars2));
+    report.run("touches", grid_name, "default", grid_size,
+        touches_case(parcels, grid_cells));
+
+    // IO
+    report.run("read_wkt", grid_name, "default", grid_size,
+        read_wkt_case(wkts));
+    report.run("write_wkt", grid_name, "default", grid_size,
+        write_wkt_case(parcels));
+
+    // Spatial index
+    report.run("rtree_pack", grid_name, "rstar_16", envelopes.size(),
+        rtree_build_case<bgi::rstar<16> >(envelopes, true));
+    report.run("rtree_insert", grid_name, "rstar_16", envelopes.size(),
+        rtree_build_case<bgi::rstar<16> >(envelopes, false));
+    report.run("rtree_insert", grid_name, "quadratic_16", envelopes.size(),
+        rtree_build_case<bgi::quadratic<16> >(envelopes, false));
+    report.run("rtree_insert", grid_name, "linear_16", envelopes.size(),
+        rtree_build_case<bgi::linear<16> >(envelopes, false));
+    if (report.selected("rtree_query", grid_name))
+    {
+        report.run("rtree_query", grid_name, "intersects", grid_points.size(),
+            rtree_query_case<bgi::rstar<16> >(envelopes, grid_points, false));
+        report.run("rtree_query", grid_name, "nearest_5", grid_points.size(),
+            rtree_query_case<bgi::rstar<16> >(envelopes, grid_points, true));
+    }
+
+    if (! json.empty())
+    {
+        std::ostringstream parameters;
+        parameters << "scale=" << scale;
+        if (! filter.empty())
+        {
+            parameters << " filter=" << filter;
+        }
+
+        if (json == "-")
+        {
+            report.write_json(std::cout, parameters.str());
+        }
+        else
+        {
+            std::ofstream out(json.c_str());
+            report.write_json(out, parameters.str());
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares writing a batch of polygons as WKB by write_wkb, byte by byte
+// through a back_inserter, with writing them into one contiguous buffer
+// by wkb_batch_writer
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_writer.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+
+std::vector<polygon_type> make_polygons(int polygon_count, int point_count)
+{
+    std::vector<polygon_type> result(polygon_count);
+    for (int p = 0; p < polygon_count; p++)
+    {
+        double const cx = 150000.0 + (p % 100) * 2500.0;
+        double const cy = 450000.0 + (p / 100) * 2500.0;
+        for (int i = 0; i <= point_count; i++)
+        {
+            double const angle = (i % point_count) * 2.0 * 3.14159265358979 / point_count;
+            double const radius = 1000.0 + 10.0 * std::sin(angle * 37.0);
+            bg::exterior_ring(result[p]).push_back(point_type(
+                cx + radius * std::cos(angle), cy + radius * std::sin(angle)));
+        }
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const polygon_count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int const point_count = argc > 2 ? std::atoi(argv[2]) : 100;
+    int const runs = argc > 3 ? std::atoi(argv[3]) : 10;
+
+    std::vector<polygon_type> const polygons
+        = make_polygons(polygon_count, point_count);
+
+    std::vector<unsigned char> wkb1;
+    std::vector<std::size_t> offsets1;
+    bg::wkb_batch_writer batch;
+    double t1 = 0, t2 = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        clock_type::time_point start = clock_type::now();
+        wkb1.clear();
+        offsets1.assign(1, 0);
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            bg::write_wkb(polygons[i], std::back_inserter(wkb1));
+            offsets1.push_back(wkb1.size());
+        }
+        duration_type d1 = clock_type::now() - start;
+
+        start = clock_type::now();
+        batch.clear();
+        batch.append_range(polygons);
+        duration_type d2 = clock_type::now() - start;
+
+        t1 += d1.count();
+        t2 += d2.count();
+    }
+
+    bool const same = wkb1 == batch.buffer() && offsets1 == batch.offsets();
+
+    std::cout << "WKB size: " << wkb1.size() << " bytes, "
+              << polygon_count << " polygons" << std::endl
+              << "write_wkb:        " << t1 / runs << " s" << std::endl
+              << "wkb_batch_writer: " << t2 / runs << " s" << std::endl
+              << "speedup:          " << t1 / t2 << std::endl
+              << "same result:      " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares streaming a large multi-polygon as WKT into a std::ostringstream
+// with writing it into a string buffer by wkt_writer
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <boost/chrono.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+namespace bg = boost::geometry;
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+
+multi_polygon_type make_multi_polygon(int polygon_count, int point_count)
+{
+    multi_polygon_type result;
+    result.resize(polygon_count);
+    for (int p = 0; p < polygon_count; p++)
+    {
+        double const cx = 150000.0 + (p % 100) * 2500.0;
+        double const cy = 450000.0 + (p / 100) * 2500.0;
+        bg::model::ring<point_type>& ring = bg::exterior_ring(result[p]);
+        for (int i = 0; i <= point_count; i++)
+        {
+            double const angle = (i % point_count) * 2.0 * 3.14159265358979 / point_count;
+            double const radius = 1000.0 + 10.0 * std::sin(angle * 37.0);
+            ring.push_back(point_type(cx + radius * std::cos(angle),
+                                      cy + radius * std::sin(angle)));
+        }
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef boost::chrono::high_resolution_clock clock_type;
+    typedef boost::chrono::duration<double> duration_type;
+
+    int const polygon_count = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int const point_count = argc > 2 ? std::atoi(argv[2]) : 1000;
+    int const runs = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    multi_polygon_type const mp = make_multi_polygon(polygon_count, point_count);
+
+    bool same = true;
+    int const precisions[] = { 6, 15 };
+    for (int i = 0; i < 2; i++)
+    {
+        int const precision = precisions[i];
+        bg::wkt_writer writer(precision);
+        std::string streamed;
+        double t1 = 0, t2 = 0;
+        for (int r = 0; r < runs; r++)
+        {
+            clock_type::time_point start = clock_type::now();
+            std::ostringstream out;
+            out.precision(precision);
+            out << bg::wkt(mp);
+            streamed = out.str();
+            duration_type d1 = clock_type::now() - start;
+
+            start = clock_type::now();
+            std::string const& written = writer.write(mp);
+            duration_type d2 = clock_type::now() - start;
+
+            same = same && written == streamed;
+            t1 += d1.count();
+            t2 += d2.count();
+        }
+
+        std::cout << "precision " << precision << ", WKT size: "
+                  << streamed.size() << " bytes" << std::endl
+                  << "  std::ostringstream: " << t1 / runs << " s" << std::endl
+                  << "  wkt_writer:         " << t2 / runs << " s" << std::endl
+                  << "  speedup:            " << t1 / t2 << std::endl;
+    }
+
+    {
+        bg::wkt_writer writer(bg::wkt_writer::shortest);
+        clock_type::time_point start = clock_type::now();
+        for (int r = 0; r < runs; r++)
+        {
+            writer.write(mp);
+        }
+        duration_type d = clock_type::now() - start;
+        std::cout << "shortest notation:    " << d.count() / runs << " s" << std::endl;
+    }
+
+    std::cout << "same result:          " << (same ? "yes" : "no") << std::endl;
+
+    return same ? 0 : 1;
+}
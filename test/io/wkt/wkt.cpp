@@ -19,6 +19,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -44,6 +45,10 @@ void check_wkt(G const& geometry, std::string const& expected)
     out << bg::wkt(geometry);
     BOOST_CHECK_EQUAL(boost::to_upper_copy(out.str()),
                       boost::to_upper_copy(expected));
+
+    // The buffered writer writes the same as the stream
+    bg::wkt_writer writer;
+    BOOST_CHECK_EQUAL(writer.write(geometry), out.str());
 }
 
 template <typename G>
@@ -146,6 +151,18 @@ void test_wkt_output_iterator(std::string const& wkt)
 
 
 
+template <typename G>
+void test_read_wkt_range(std::string const& wkt, std::size_t length,
+                         std::string const& expected)
+{
+    // Parse only the first characters, directly from the buffer
+    G geometry;
+    bg::read_wkt(wkt.c_str(), wkt.c_str() + length, geometry);
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    BOOST_CHECK_EQUAL(out.str(), expected);
+}
+
 #ifndef GEOMETRY_TEST_MULTI
 template <typename T>
 void test_order_closure()
@@ -222,6 +239,12 @@ void test_all()
     test_relaxed_wkt<bg::model::polygon<P> >("POLYGON( ( ) , ( ) , ( ) )",
                 "POLYGON((),(),())");
 
+    // Any whitespace separates tokens
+    test_relaxed_wkt<bg::model::linestring<P> >("LINESTRING\t(1\t1,\r\n2 2 ,\n3\t3)",
+                "LINESTRING(1 1,2 2,3 3)");
+    test_relaxed_wkt<bg::model::linestring<P> >("linestring(+1 1,2 2)",
+                "LINESTRING(1 1,2 2)");
+
     // Wrong WKT's
     test_wrong_wkt<P>("POINT(1 2", "expected ')'");
     test_wrong_wkt<P>("POINT 1 2)", "expected '('");
@@ -246,7 +269,16 @@ void test_all()
                                || ! boost::is_fundamental<T>::type::value ) )
     {
         test_wkt<P>("POINT(1.1 2.1)", 1);
+        test_relaxed_wkt<P>("POINT(1.5e2 -.25)", "POINT(150 -0.25)");
+        test_wrong_wkt<P>("POINT(1.5e 2)", "bad lexical cast");
+        test_wrong_wkt<P>("POINT(1.5.2 2)", "bad lexical cast");
     }
+    else
+    {
+        test_wrong_wkt<P>("POINT(1.5 2)", "bad lexical cast");
+    }
+
+    test_read_wkt_range<P>("POINT(1 2) trailing", 10, "POINT(1 2)");
 
     // Deprecated:
     // test_wkt_output_iterator<bg::model::linestring<P> >("LINESTRING(1 1,2 2,3 3)");
@@ -256,11 +288,106 @@ void test_all()
 }
 #endif
 
+template <typename T>
+void check_wkt_writer(bg::model::point<T, 2, bg::cs::cartesian> const& p)
+{
+    for (int precision = 0; precision <= 17; precision++)
+    {
+        std::ostringstream out;
+        out.precision(precision);
+        out << bg::wkt(p);
+        BOOST_CHECK_EQUAL(bg::wkt_writer(precision).write(p), out.str());
+
+        std::ostringstream fixed;
+        fixed << std::fixed;
+        fixed.precision(precision);
+        fixed << bg::wkt(p);
+        BOOST_CHECK_EQUAL(bg::wkt_writer(bg::wkt_writer::fixed, precision)
+                            .write(p), fixed.str());
+    }
+
+    // Shortest notation reads back to the same point
+    bg::model::point<T, 2, bg::cs::cartesian> q;
+    bg::read_wkt(bg::wkt_writer(bg::wkt_writer::shortest).write(p), q);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), bg::get<0>(q));
+    BOOST_CHECK_EQUAL(bg::get<1>(p), bg::get<1>(q));
+}
+
+// Values near the limits of the coordinate type
+inline void add_extreme_values(std::vector<double>& values)
+{
+    values.push_back(1e300);
+    values.push_back(-2.5e-300);
+}
+
+inline void add_extreme_values(std::vector<float>& values)
+{
+    values.push_back(1e30f);
+    values.push_back(-2.5e-30f);
+}
+
+template <typename T>
+void test_wkt_writer()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> P;
+
+    double const common[] = { 0, 1, -1, 0.5, -0.25, 1.0 / 3.0, 100, 123456,
+                              1234567, 1e15, 1e16, 1e-5, 1.5e-7, 155000.123456,
+                              -98765.4321, 4.35e12 };
+    std::vector<T> values;
+    for (std::size_t i = 0; i < sizeof(common) / sizeof(common[0]); i++)
+    {
+        values.push_back(static_cast<T>(common[i]));
+    }
+    add_extreme_values(values);
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        check_wkt_writer(P(values[i], -values[count - i - 1]));
+    }
+
+    unsigned int seed = 12345;
+    for (int i = 0; i < 1000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        T const x = (seed % 100000000) / T(1000);
+        seed = seed * 1103515245u + 12345u;
+        T const y = std::ldexp(T(seed % 1000000) / 1000000, int(seed % 64) - 32);
+        check_wkt_writer(P(x, -y));
+    }
+
+    {
+        P p(1.1, 2.5);
+        BOOST_CHECK_EQUAL(bg::wkt_writer(bg::wkt_writer::shortest).write(p),
+                          "POINT(1.1 2.5)");
+    }
+
+    // The writer appends to the buffer, and can be reused
+    {
+        bg::model::multi_polygon<bg::model::polygon<P> > mp;
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 1.5,1.5 1.5,1.5 0,0 0)),"
+                     "((2 2,2 3,3 3,3 2,2 2),(2.25 2.25,2.5 2.25,2.5 2.5,2.25 2.25)))", mp);
+        bg::wkt_writer writer(bg::wkt_writer::fixed, 2);
+        std::string buffer = "1;";
+        writer.append(mp, buffer);
+        buffer += "\n2;";
+        writer.append(bg::model::box<P>(P(0, 0), P(1, 1)), buffer);
+        BOOST_CHECK_EQUAL(buffer, "1;MULTIPOLYGON(((0.00 0.00,0.00 1.50,1.50 1.50,1.50 0.00,0.00 0.00)),"
+                     "((2.00 2.00,2.00 3.00,3.00 3.00,3.00 2.00,2.00 2.00),"
+                     "(2.25 2.25,2.50 2.25,2.50 2.50,2.25 2.25)))\n"
+                     "2;POLYGON((0.00 0.00,0.00 1.00,1.00 1.00,1.00 0.00,0.00 0.00))");
+    }
+}
+
 int test_main(int, char* [])
 {
     test_all<double>();
     test_all<int>();
 
+    test_wkt_writer<double>();
+    test_wkt_writer<float>();
+
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();
 #endif
@@ -0,0 +1,175 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/inverse_batch.hpp>
+#include <boost/geometry/algorithms/make.hpp>
+#include <boost/geometry/core/srs.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/geographic/distance_andoyer.hpp>
+#include <boost/geometry/strategies/geographic/distance_thomas.hpp>
+#include <boost/geometry/strategies/geographic/distance_vincenty.hpp>
+
+
+// Deterministic pseudo random coordinates, including special cases
+template <typename Point>
+std::vector<Point> make_points(std::size_t count, unsigned int seed)
+{
+    typedef typename bg::coordinate_type<Point>::type coordinate_type;
+
+    std::vector<Point> result;
+    unsigned int state = seed;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        int const lon = static_cast<int>((state >> 8) % 3600) - 1800;
+        state = state * 1103515245u + 12345u;
+        int const lat = static_cast<int>((state >> 8) % 1800) - 900;
+        result.push_back(bg::make<Point>(coordinate_type(lon / 10.0),
+                                         coordinate_type(lat / 10.0)));
+    }
+
+    // Special pairs, together with the points of seed 1: equal points,
+    // points on the poles, crossing the antimeridian, nearly antipodal points
+    if (count >= 10 && seed == 2)
+    {
+        result[0] = bg::make<Point>(coordinate_type(4), coordinate_type(52));
+        result[3] = bg::make<Point>(coordinate_type(0), coordinate_type(90));
+        result[5] = bg::make<Point>(coordinate_type(179), coordinate_type(10));
+        result[7] = bg::make<Point>(coordinate_type(0), coordinate_type(0));
+        result[8] = bg::make<Point>(coordinate_type(0), coordinate_type(-90));
+    }
+    else if (count >= 10)
+    {
+        result[0] = bg::make<Point>(coordinate_type(4), coordinate_type(52));
+        result[3] = bg::make<Point>(coordinate_type(30), coordinate_type(-90));
+        result[5] = bg::make<Point>(coordinate_type(-179), coordinate_type(11));
+        result[7] = bg::make<Point>(coordinate_type(179), coordinate_type(1));
+        result[8] = bg::make<Point>(coordinate_type(0), coordinate_type(90));
+    }
+    return result;
+}
+
+template <typename T>
+void check_equal(std::string const& name, std::size_t i,
+                 T const& expected, T const& detected, double tolerance)
+{
+    double const diff = bg::math::abs(double(expected) - double(detected));
+    double const scale = (std::max)(1.0, bg::math::abs(double(expected)));
+    BOOST_CHECK_MESSAGE(diff <= tolerance * scale,
+        name << " pair " << i << " expected: " << expected
+             << " detected: " << detected);
+}
+
+template <typename Strategy, typename Point>
+void test_strategy(std::string const& name, Strategy const& strategy,
+                   std::vector<Point> const& points1,
+                   std::vector<Point> const& points2,
+                   double tolerance)
+{
+    typedef typename bg::strategy::distance::services::return_type
+        <
+            Strategy, Point, Point
+        >::type return_type;
+
+    std::vector<return_type> batch;
+    strategy.apply_batch(points1.begin(), points1.end(), points2.begin(),
+                         std::back_inserter(batch));
+
+    BOOST_CHECK_EQUAL(batch.size(), points1.size());
+    for (std::size_t i = 0; i < batch.size() && i < points1.size(); i++)
+    {
+        return_type const expected = strategy.apply(points1[i], points2[i]);
+        check_equal(name, i, expected, batch[i], tolerance);
+    }
+}
+
+template <typename CT>
+void test_vincenty_azimuth(std::size_t count)
+{
+    typedef bg::detail::vincenty_inverse<CT, true, true> inverse_type;
+
+    bg::srs::spheroid<CT> const spheroid;
+    CT const d2r = bg::math::d2r<CT>();
+
+    std::vector<CT> lon1, lat1, lon2, lat2;
+    unsigned int state = 7;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        CT c[4];
+        for (int j = 0; j < 4; j++)
+        {
+            state = state * 1103515245u + 12345u;
+            c[j] = CT(static_cast<int>((state >> 8) % 1800) - 900) / CT(10);
+        }
+        lon1.push_back(c[0] * 2 * d2r);
+        lat1.push_back(c[1] * d2r);
+        lon2.push_back(i % 9 == 0 ? lon1.back() : c[2] * 2 * d2r);
+        lat2.push_back(i % 9 == 0 ? lat1.back() : c[3] * d2r);
+    }
+
+    std::vector<CT> distance(count), azimuth(count);
+    bg::detail::inverse_batch<inverse_type>::apply(&lon1[0], &lat1[0],
+            &lon2[0], &lat2[0], count, spheroid, &distance[0], &azimuth[0]);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        typename inverse_type::result_type const expected
+            = inverse_type::apply(lon1[i], lat1[i], lon2[i], lat2[i], spheroid);
+        check_equal("vincenty distance", i, expected.distance, distance[i], 1e-12);
+        check_equal("vincenty azimuth", i, expected.azimuth, azimuth[i], 1e-12);
+    }
+}
+
+template <typename Point>
+void test_all(double tolerance)
+{
+    typedef bg::srs::spheroid<double> spheroid_type;
+
+    // A count which is not a multiple of the number of lanes
+    // and more than one block of the strategies
+    std::size_t const count = 1003;
+    std::vector<Point> const points1 = make_points<Point>(count, 1);
+    std::vector<Point> const points2 = make_points<Point>(count, 2);
+
+    test_strategy("vincenty", bg::strategy::distance::vincenty<spheroid_type>(),
+                  points1, points2, tolerance);
+    test_strategy("andoyer", bg::strategy::distance::andoyer<spheroid_type>(),
+                  points1, points2, tolerance);
+    test_strategy("thomas", bg::strategy::distance::thomas<spheroid_type>(),
+                  points1, points2, tolerance);
+
+    // Less than a block of lanes
+    std::vector<Point> const few1(points1.begin(), points1.begin() + 3);
+    std::vector<Point> const few2(points2.begin(), points2.begin() + 3);
+    test_strategy("vincenty few", bg::strategy::distance::vincenty<spheroid_type>(),
+                  few1, few2, tolerance);
+
+    // Nothing
+    std::vector<Point> const none;
+    test_strategy("vincenty none", bg::strategy::distance::vincenty<spheroid_type>(),
+                  none, none, tolerance);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >(1e-12);
+    test_all<bg::model::point<float, 2, bg::cs::geographic<bg::degree> > >(1e-5);
+    test_all<bg::model::point<int, 2, bg::cs::geographic<bg::degree> > >(1e-12);
+
+    test_vincenty_azimuth<double>(1001);
+
+    return 0;
+}
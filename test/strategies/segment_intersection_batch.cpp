@@ -0,0 +1,180 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/cartesian/cart_intersect.hpp>
+#include <boost/geometry/strategies/cartesian/cart_intersect_batch.hpp>
+
+#include <boost/geometry/policies/relate/direction.hpp>
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+
+// Deterministic pseudo random numbers in [0, 1)
+struct generator
+{
+    generator() : state(12345u) {}
+
+    double operator()()
+    {
+        state = state * 1103515245u + 12345u;
+        return ((state >> 8) % 1000000) / 1000000.0;
+    }
+
+    unsigned int state;
+};
+
+// Coordinates of the segments of one case
+struct segments
+{
+    std::vector<double> x1, y1, x2, y2;
+
+    void add(double ax1, double ay1, double ax2, double ay2)
+    {
+        x1.push_back(ax1);
+        y1.push_back(ay1);
+        x2.push_back(ax2);
+        y2.push_back(ay2);
+    }
+};
+
+// Relates each segment with all segments, with the filter and with the
+// strategy. Pairs marked as disjoint by the filter must be disjoint
+// according to the strategy. Returns the fraction of the disjoint pairs
+// which is marked by the filter
+template <typename Point>
+double test_segments(std::string const& caseid, segments const& s)
+{
+    typedef bg::model::referring_segment<Point const> segment_type;
+    typedef bg::strategy::intersection::relate_cartesian_segments
+        <
+            bg::policies::relate::segments_direction
+        > strategy_type;
+
+    bg::detail::no_rescale_policy robust_policy;
+
+    std::size_t const n = s.x1.size();
+    std::vector<unsigned char> disjoint(n);
+
+    std::size_t disjoint_count = 0, filtered_count = 0, error_count = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        bg::strategy::intersection::detail::segment_batch_filter::apply(
+            s.x1[i], s.y1[i], s.x2[i], s.y2[i],
+            &s.x1[0], &s.y1[0], &s.x2[0], &s.y2[0], n, &disjoint[0]);
+
+        Point const a1(s.x1[i], s.y1[i]);
+        Point const a2(s.x2[i], s.y2[i]);
+        segment_type const a(a1, a2);
+        for (std::size_t j = 0; j < n; j++)
+        {
+            Point const b1(s.x1[j], s.y1[j]);
+            Point const b2(s.x2[j], s.y2[j]);
+            segment_type const b(b1, b2);
+
+            bool const is_disjoint
+                = strategy_type::apply(a, b, robust_policy).how == 'd';
+            if (is_disjoint)
+            {
+                disjoint_count++;
+            }
+            if (disjoint[j])
+            {
+                filtered_count++;
+                if (! is_disjoint)
+                {
+                    error_count++;
+                }
+            }
+        }
+    }
+
+    BOOST_CHECK_MESSAGE(error_count == 0,
+        caseid << " pairs wrongly filtered as disjoint: " << error_count);
+
+    return disjoint_count == 0 ? 1.0
+        : static_cast<double>(filtered_count) / disjoint_count;
+}
+
+void test_all()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::point<boost::long_long_type, 2, bg::cs::cartesian> robust_point_type;
+
+    generator random;
+
+    // Random segments, mostly disjoint
+    {
+        segments s;
+        for (int i = 0; i < 300; i++)
+        {
+            double const x = random() * 100.0;
+            double const y = random() * 100.0;
+            s.add(x, y, x + random() * 10.0 - 5.0, y + random() * 10.0 - 5.0);
+        }
+        double const fraction = test_segments<point_type>("random", s);
+        BOOST_CHECK_MESSAGE(fraction > 0.95, "random filtered: " << fraction);
+    }
+
+    // Segments on a small integer grid: touching, collinear, degenerate
+    {
+        segments s;
+        for (int i = 0; i < 300; i++)
+        {
+            s.add(static_cast<int>(random() * 6), static_cast<int>(random() * 6),
+                  static_cast<int>(random() * 6), static_cast<int>(random() * 6));
+        }
+        test_segments<point_type>("grid", s);
+        test_segments<robust_point_type>("grid_robust", s);
+    }
+
+    // (Nearly) collinear segments, on and near the line y = 0.3 x
+    {
+        double const eps = std::numeric_limits<double>::epsilon();
+        segments s;
+        for (int i = 0; i < 200; i++)
+        {
+            double const x1 = random() * 1000.0;
+            double const x2 = random() * 1000.0;
+            double const d1 = (static_cast<int>(random() * 9) - 4) * eps * 100.0;
+            double const d2 = (static_cast<int>(random() * 9) - 4) * eps * 100.0;
+            s.add(x1, 0.3 * x1 + d1, x2, 0.3 * x2 + d2);
+        }
+        test_segments<point_type>("collinear", s);
+    }
+
+    // Large robust coordinates, as after rescaling
+    {
+        segments s;
+        for (int i = 0; i < 200; i++)
+        {
+            double const x = static_cast<int>(random() * 1.0e7);
+            double const y = static_cast<int>(random() * 1.0e7);
+            s.add(x, y, x + static_cast<int>(random() * 1.0e6),
+                  y + static_cast<int>(random() * 1.0e6));
+        }
+        double const fraction = test_segments<robust_point_type>("robust", s);
+        BOOST_CHECK_MESSAGE(fraction > 0.95, "robust filtered: " << fraction);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all();
+    return 0;
+}
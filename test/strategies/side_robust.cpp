@@ -0,0 +1,102 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <limits>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/cartesian/side_robust.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/util/precise_math.hpp>
+
+
+namespace bg = boost::geometry;
+
+template <typename Point>
+void test_basic()
+{
+    typedef bg::strategy::side::side_robust<> side;
+
+    Point const p1(0, 0);
+    Point const p2(10, 10);
+
+    BOOST_CHECK_EQUAL( 1, side::apply(p1, p2, Point(0, 10)));
+    BOOST_CHECK_EQUAL(-1, side::apply(p1, p2, Point(10, 0)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p2, Point(5, 5)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p2, Point(20, 20)));
+    BOOST_CHECK_EQUAL( 0, side::apply(p1, p1, Point(20, 30)));
+}
+
+// Points near (0.5, 0.5), in steps of one ulp, with respect to the line
+// y = x through (12, 12) and (24, 24) (as in Kettner et al., "Classroom
+// examples of robustness problems in geometric computations").
+// All coordinates are exact, so the exact side is the sign of j - i.
+void test_near_collinear()
+{
+    typedef bg::model::d2::point_xy<double> point;
+    typedef bg::strategy::side::side_robust<> side;
+
+    double const ulp = std::numeric_limits<double>::epsilon() / 2.0;
+    point const p1(12, 12);
+    point const p2(24, 24);
+
+    int errors = 0;
+    for (int i = 0; i < 64; i++)
+    {
+        for (int j = 0; j < 64; j++)
+        {
+            point const p(0.5 + i * ulp, 0.5 + j * ulp);
+            int const expected = j > i ? 1 : j < i ? -1 : 0;
+            if (side::apply(p1, p2, p) != expected
+                || side::apply(p2, p1, p) != -expected
+                || side::apply(p, p1, p2) != expected
+                || side::apply(p2, p, p1) != expected)
+            {
+                errors++;
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(errors, 0);
+}
+
+// Determinants needing all stages of the adaptive evaluation
+void test_adaptive()
+{
+    namespace pm = bg::detail::precise_math;
+
+    double const ulp = std::numeric_limits<double>::epsilon();
+
+    // Exactly collinear, but not representable differences
+    BOOST_CHECK_EQUAL(pm::orient2d(0.1, 0.1, 0.3, 0.3, 1.0e20, 1.0e20), 0.0);
+    // Sign verified with exact rational arithmetic
+    BOOST_CHECK(pm::orient2d(1.0 + ulp, 1.0, 1.0e-30, 0.0, 1.0e30, 1.0e30) < 0.0);
+
+    // Permutations of a nearly collinear triple give consistent signs
+    double const ax = 0.1, ay = 0.2;
+    double const bx = 0.7, by = 1.4 + ulp;
+    double const cx = 1.0e-17, cy = 2.0e-17;
+    double const abc = pm::orient2d(ax, ay, bx, by, cx, cy);
+    double const bca = pm::orient2d(bx, by, cx, cy, ax, ay);
+    double const acb = pm::orient2d(ax, ay, cx, cy, bx, by);
+    BOOST_CHECK((abc > 0) == (bca > 0));
+    BOOST_CHECK((abc > 0) == (acb < 0));
+    BOOST_CHECK(abc > 0);
+}
+
+int test_main(int, char* [])
+{
+    test_basic<bg::model::d2::point_xy<double> >();
+    test_basic<bg::model::d2::point_xy<float> >();
+    test_basic<bg::model::d2::point_xy<int> >();
+    test_near_collinear();
+    test_adaptive();
+
+    return 0;
+}